@@ -0,0 +1,237 @@
+#include "broker-client.h"
+#include <algorithm>
+
+BrokerProducer::BrokerProducer(std::shared_ptr<grpc::Channel> channel, ProducerSettings settings)
+	: m_stub(MessageBroker::NewStub(std::move(channel))), m_settings(std::move(settings)), m_batcher(m_settings.maxBatch, m_settings.maxBatchBytes, m_settings.linger)
+{
+	m_settings.maxInFlight = std::max<size_t>(m_settings.maxInFlight, 1);
+	m_lingerer = std::thread([this] { Linger(); });
+}
+
+BrokerProducer::~BrokerProducer()
+{
+	Flush();
+	{
+		std::lock_guard lock{ m_mutex };
+		m_stopping = true;
+		m_wakeUp.notify_all();
+	}
+	m_lingerer.join();
+}
+
+void BrokerProducer::Send(std::string_view topic, std::string content, std::string key)
+{
+	Message message;
+	message.set_topic(topic.data(), topic.size());
+	message.set_content(std::move(content));
+	message.set_key(std::move(key));
+	Send(std::move(message));
+}
+
+void BrokerProducer::Send(Message message)
+{
+	std::unique_lock lock{ m_mutex };
+	const auto wasEmpty = !m_batcher.Deadline();
+	if (auto batch = m_batcher.Add(std::move(message), MessageBatcher::Clock::now()))
+	{
+		SendBatch(lock, std::move(*batch));
+	}
+	else if (wasEmpty)
+	{
+		// the lingerer waits for the deadline of the new batch
+		m_wakeUp.notify_all();
+	}
+}
+
+void BrokerProducer::Flush()
+{
+	std::unique_lock lock{ m_mutex };
+	if (auto batch = m_batcher.Seal())
+	{
+		SendBatch(lock, std::move(*batch));
+	}
+	m_wakeUp.wait(lock, [this] { return !m_stats.inFlight; });
+}
+
+ProducerStats BrokerProducer::Stats() const
+{
+	std::lock_guard lock{ m_mutex };
+	return m_stats;
+}
+
+// under the lock, which is released while the call starts: other batches can be sealed meanwhile.
+// Batches are numbered here, when they have just been sealed, and their calls start in that order: waiting for room in flight releases the lock,
+// thus without numbers a later batch of another thread could overtake this one
+void BrokerProducer::SendBatch(std::unique_lock<std::mutex>& lock, SendRequest batch)
+{
+	const auto sequence = m_sealed++;
+	m_wakeUp.wait(lock, [&] { return m_started == sequence && m_stats.inFlight < m_settings.maxInFlight; });
+	++m_stats.inFlight;
+	lock.unlock();
+	auto* call = new Call;
+	call->request = std::move(batch);
+#ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+	m_stub->async()->Send(&call->context, &call->request, &call->response, [this, call](grpc::Status status) {
+#else
+	m_stub->experimental_async()->Send(&call->context, &call->request, &call->response, [this, call](grpc::Status status) {
+#endif
+		Done(call, status);
+	});
+	lock.lock();
+	++m_started;
+	m_wakeUp.notify_all();
+}
+
+// on a gRPC thread. Once the batch is not counted in flight anymore the producer might go away, thus that's the last thing done here
+void BrokerProducer::Done(Call* call, const grpc::Status& status)
+{
+	if (!status.ok() && m_settings.onError)
+	{
+		m_settings.onError(status, call->request);
+	}
+	const auto messages = static_cast<uint64_t>(call->request.messages().size());
+	delete call;
+	std::lock_guard lock{ m_mutex };
+	if (status.ok())
+	{
+		m_stats.sent += messages;
+	}
+	else
+	{
+		m_stats.failed += messages;
+		m_stats.lastError = status.error_message();
+	}
+	--m_stats.inFlight;
+	m_wakeUp.notify_all();
+}
+
+void BrokerProducer::Linger()
+{
+	std::unique_lock lock{ m_mutex };
+	while (!m_stopping)
+	{
+		const auto deadline = m_batcher.Deadline();
+		if (!deadline)
+		{
+			m_wakeUp.wait(lock);
+		}
+		else if (MessageBatcher::Clock::now() < *deadline)
+		{
+			m_wakeUp.wait_until(lock, *deadline);
+		}
+		else if (auto batch = m_batcher.Seal())
+		{
+			SendBatch(lock, std::move(*batch));
+		}
+	}
+}
+
+BrokerConsumer::BrokerConsumer(std::shared_ptr<grpc::Channel> channel, ReceiveRequest request, OnMessage onMessage, ConsumerSettings settings)
+	: m_stub(MessageBroker::NewStub(std::move(channel))), m_request(std::move(request)), m_onMessage(std::move(onMessage)), m_settings(settings)
+{
+	m_reader = std::thread([this] { Run(); });
+}
+
+BrokerConsumer::~BrokerConsumer()
+{
+	{
+		std::lock_guard lock{ m_mutex };
+		m_stopping = true;
+		if (m_context)
+		{
+			m_context->TryCancel();
+		}
+		m_wakeUp.notify_all();
+	}
+	m_reader.join();
+}
+
+ConsumerStats BrokerConsumer::Stats() const
+{
+	std::lock_guard lock{ m_mutex };
+	auto stats = m_stats;
+	stats.received = m_received.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void BrokerConsumer::Run()
+{
+	auto backoff = m_settings.minBackoff;
+	while (true)
+	{
+		grpc::ClientContext context;
+		{
+			std::lock_guard lock{ m_mutex };
+			if (m_stopping)
+			{
+				return;
+			}
+			m_context = &context;
+			++m_stats.connections;
+		}
+		const auto reader = m_stub->Receive(&context, NextRequest());
+		if (ReadMessages(*reader))
+		{
+			backoff = m_settings.minBackoff;
+		}
+		const auto status = reader->Finish();
+		std::unique_lock lock{ m_mutex };
+		m_context = nullptr;
+		if (m_stopping)
+		{
+			return;
+		}
+		m_stats.lastError = status.error_message();
+		if (status.error_code() == grpc::StatusCode::INVALID_ARGUMENT)
+		{
+			m_stats.stopped = true;
+			return;
+		}
+		m_wakeUp.wait_for(lock, backoff, [this] { return m_stopping; });
+		backoff = std::min<std::chrono::milliseconds>(backoff * 2, m_settings.maxBackoff);
+	}
+}
+
+// the same request every time, except for where logged topics start from
+ReceiveRequest BrokerConsumer::NextRequest() const
+{
+	auto request = m_request;
+	if (m_settings.resume && request.group().empty())
+	{
+		for (const auto& [topic, offset] : m_nextOffsets)
+		{
+			(*request.mutable_start_offsets())[topic] = offset;
+		}
+	}
+	return request;
+}
+
+// true if something has been read (that is, the stream has been up for a while)
+bool BrokerConsumer::ReadMessages(grpc::ClientReader<ReceiveResponse>& reader)
+{
+	ReceiveResponse response;
+	bool read = false;
+	while (reader.Read(&response))
+	{
+		read = true;
+		if (response.has_message())
+		{
+			Deliver(response.message());
+		}
+		for (const auto& message : response.messages())
+		{
+			Deliver(message);
+		}
+	}
+	return read;
+}
+
+void BrokerConsumer::Deliver(const Message& message)
+{
+	if (message.has_offset())
+	{
+		m_nextOffsets[message.topic()] = message.offset() + 1;
+	}
+	m_received.fetch_add(1, std::memory_order_relaxed);
+	m_onMessage(message);
+}
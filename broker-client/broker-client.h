@@ -0,0 +1,129 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <grpcpp/grpcpp.h>
+#include "../generated/broker.grpc.pb.h"
+#include "message-batcher.h"
+
+struct ProducerSettings
+{
+	// a batch is sent as soon as it has this many messages or bytes (0 means no limit), or when its first message has waited for "linger"
+	size_t maxBatch = 100;
+	size_t maxBatchBytes = 64 * 1024;
+	std::chrono::microseconds linger{ 1000 };
+	// batches sent and not answered yet: when there are this many, Send waits (1 keeps batches in order, whatever the threads sending)
+	size_t maxInFlight = 4;
+	// called (on a gRPC thread) with every batch the broker has not taken
+	std::function<void(const grpc::Status&, const SendRequest&)> onError;
+};
+
+struct ProducerStats
+{
+	uint64_t sent = 0; // messages taken by the broker
+	uint64_t failed = 0;
+	size_t inFlight = 0; // batches
+	std::string lastError;
+};
+
+/* A producer batching messages into "Send" requests (see MessageBatcher), with a few of them in flight at once on the callback API.
+   Send never waits for the broker, unless "maxInFlight" batches are in flight already: that's the backpressure of a producer faster than the broker.
+   Batches are sent in the order they are sealed, even when many threads call Send. Still, batches in flight might be taken by the broker in any order,
+   thus only the messages of a batch keep their order (unless maxInFlight is 1).
+   A thread of the producer sends the batches that linger. Send, Flush and Stats can be called by any thread.
+*/
+class BrokerProducer
+{
+public:
+	explicit BrokerProducer(std::shared_ptr<grpc::Channel> channel, ProducerSettings settings = {});
+	BrokerProducer(const BrokerProducer&) = delete;
+	BrokerProducer& operator=(const BrokerProducer&) = delete;
+	// what is still batched is sent (see Flush)
+	~BrokerProducer();
+
+	void Send(std::string_view topic, std::string content, std::string key = {});
+	void Send(Message message);
+	// sends what is batched and waits for every batch in flight
+	void Flush();
+	[[nodiscard]] ProducerStats Stats() const;
+private:
+	struct Call
+	{
+		grpc::ClientContext context;
+		SendRequest request;
+		SendResponse response;
+	};
+
+	void SendBatch(std::unique_lock<std::mutex>& lock, SendRequest batch);
+	void Done(Call* call, const grpc::Status& status);
+	void Linger();
+
+	std::unique_ptr<MessageBroker::Stub> m_stub;
+	ProducerSettings m_settings;
+	mutable std::mutex m_mutex;
+	std::condition_variable m_wakeUp;
+	MessageBatcher m_batcher;
+	ProducerStats m_stats;
+	uint64_t m_sealed = 0; // batches, the sequence number of the next one
+	uint64_t m_started = 0; // batches whose call has started, the next one to start is the one with this sequence number
+	bool m_stopping = false;
+	std::thread m_lingerer;
+};
+
+struct ConsumerSettings
+{
+	std::chrono::milliseconds minBackoff{ 100 };
+	std::chrono::milliseconds maxBackoff{ 5000 };
+	// reconnecting resumes logged topics from the message after the last one delivered (see ReceiveRequest.start_offsets), consumer groups excluded
+	bool resume = true;
+};
+
+struct ConsumerStats
+{
+	uint64_t received = 0;
+	uint64_t connections = 0;
+	bool stopped = false; // the broker refused the request, connecting again would not help
+	std::string lastError;
+};
+
+/* A consumer of "Receive" that survives the broker going away: it connects again (with a backoff) and subscribes the same request again.
+   Messages are handed to "onMessage" one at a time, on the thread of the consumer, batched ones included (see ReceiveRequest.max_batch).
+   Compressed contents are not inflated (see ReceiveRequest.compression).
+*/
+class BrokerConsumer
+{
+public:
+	using OnMessage = std::function<void(const Message&)>;
+
+	BrokerConsumer(std::shared_ptr<grpc::Channel> channel, ReceiveRequest request, OnMessage onMessage, ConsumerSettings settings = {});
+	BrokerConsumer(const BrokerConsumer&) = delete;
+	BrokerConsumer& operator=(const BrokerConsumer&) = delete;
+	~BrokerConsumer();
+
+	[[nodiscard]] ConsumerStats Stats() const;
+private:
+	void Run();
+	ReceiveRequest NextRequest() const;
+	bool ReadMessages(grpc::ClientReader<ReceiveResponse>& reader);
+	void Deliver(const Message& message);
+
+	std::unique_ptr<MessageBroker::Stub> m_stub;
+	ReceiveRequest m_request;
+	OnMessage m_onMessage;
+	ConsumerSettings m_settings;
+	std::unordered_map<std::string, uint64_t> m_nextOffsets; // by topic, only the thread of the consumer touches them
+	std::atomic<uint64_t> m_received = 0;
+	mutable std::mutex m_mutex;
+	std::condition_variable m_wakeUp;
+	ConsumerStats m_stats;
+	bool m_stopping = false;
+	grpc::ClientContext* m_context = nullptr; // to cancel the stream when stopping
+	std::thread m_reader;
+};
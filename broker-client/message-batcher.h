@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include "../generated/broker.pb.h"
+
+/* Accumulates messages into SendRequest batches (see BrokerProducer): a batch is sealed as soon as it has "maxMessages" messages
+   or "maxBytes" bytes, or when its first message has waited for "linger" (see Deadline). It is not thread-safe.
+*/
+class MessageBatcher
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	MessageBatcher(size_t maxMessages, size_t maxBytes, std::chrono::microseconds linger)
+		: m_maxMessages(maxMessages ? maxMessages : 1), m_maxBytes(maxBytes), m_linger(linger)
+	{
+	}
+
+	// the batch this message fills up, if any
+	std::optional<SendRequest> Add(Message message, Clock::time_point now)
+	{
+		if (m_batch.messages().empty())
+		{
+			m_deadline = now + m_linger;
+		}
+		m_bytes += message.ByteSizeLong();
+		m_batch.add_messages()->Swap(&message);
+		if (static_cast<size_t>(m_batch.messages().size()) >= m_maxMessages || (m_maxBytes && m_bytes >= m_maxBytes))
+		{
+			return Seal();
+		}
+		return std::nullopt;
+	}
+
+	// the current batch, whatever its size (nothing if it is empty)
+	std::optional<SendRequest> Seal()
+	{
+		if (m_batch.messages().empty())
+		{
+			return std::nullopt;
+		}
+		std::optional<SendRequest> batch{ std::in_place };
+		batch->Swap(&m_batch);
+		m_bytes = 0;
+		m_deadline.reset();
+		return batch;
+	}
+
+	// when the current batch has to be sealed, nothing if it is empty
+	[[nodiscard]] std::optional<Clock::time_point> Deadline() const
+	{
+		return m_deadline;
+	}
+private:
+	size_t m_maxMessages;
+	size_t m_maxBytes; // 0 means no limit
+	std::chrono::microseconds m_linger;
+	SendRequest m_batch;
+	size_t m_bytes = 0;
+	std::optional<Clock::time_point> m_deadline;
+};
@@ -6,45 +6,55 @@
 #include "broker.grpc.pb.h"
 
 #include <functional>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/channel_interface.h>
-#include <grpcpp/impl/codegen/client_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
-#include <grpcpp/impl/codegen/rpc_service_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
 
 static const char* MessageBroker_method_names[] = {
   "/MessageBroker/Send",
   "/MessageBroker/Receive",
+  "/MessageBroker/Resolve",
+  "/MessageBroker/Publish",
+  "/MessageBroker/Subscribe",
+  "/MessageBroker/Stats",
+  "/MessageBroker/Dictionaries",
 };
 
 std::unique_ptr< MessageBroker::Stub> MessageBroker::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
   (void)options;
-  std::unique_ptr< MessageBroker::Stub> stub(new MessageBroker::Stub(channel));
+  std::unique_ptr< MessageBroker::Stub> stub(new MessageBroker::Stub(channel, options));
   return stub;
 }
 
-MessageBroker::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel)
-  : channel_(channel), rpcmethod_Send_(MessageBroker_method_names[0], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_Receive_(MessageBroker_method_names[1], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+MessageBroker::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_Send_(MessageBroker_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Receive_(MessageBroker_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_Resolve_(MessageBroker_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Publish_(MessageBroker_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_Subscribe_(MessageBroker_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_Stats_(MessageBroker_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_Dictionaries_(MessageBroker_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status MessageBroker::Stub::Send(::grpc::ClientContext* context, const ::SendRequest& request, ::SendResponse* response) {
   return ::grpc::internal::BlockingUnaryCall< ::SendRequest, ::SendResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Send_, context, request, response);
 }
 
-void MessageBroker::Stub::experimental_async::Send(::grpc::ClientContext* context, const ::SendRequest* request, ::SendResponse* response, std::function<void(::grpc::Status)> f) {
+void MessageBroker::Stub::async::Send(::grpc::ClientContext* context, const ::SendRequest* request, ::SendResponse* response, std::function<void(::grpc::Status)> f) {
   ::grpc::internal::CallbackUnaryCall< ::SendRequest, ::SendResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Send_, context, request, response, std::move(f));
 }
 
-void MessageBroker::Stub::experimental_async::Send(::grpc::ClientContext* context, const ::SendRequest* request, ::SendResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+void MessageBroker::Stub::async::Send(::grpc::ClientContext* context, const ::SendRequest* request, ::SendResponse* response, ::grpc::ClientUnaryReactor* reactor) {
   ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Send_, context, request, response, reactor);
 }
 
@@ -63,7 +73,7 @@ void MessageBroker::Stub::experimental_async::Send(::grpc::ClientContext* contex
   return ::grpc::internal::ClientReaderFactory< ::ReceiveResponse>::Create(channel_.get(), rpcmethod_Receive_, context, request);
 }
 
-void MessageBroker::Stub::experimental_async::Receive(::grpc::ClientContext* context, const ::ReceiveRequest* request, ::grpc::experimental::ClientReadReactor< ::ReceiveResponse>* reactor) {
+void MessageBroker::Stub::async::Receive(::grpc::ClientContext* context, const ::ReceiveRequest* request, ::grpc::ClientReadReactor< ::ReceiveResponse>* reactor) {
   ::grpc::internal::ClientCallbackReaderFactory< ::ReceiveResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_Receive_, context, request, reactor);
 }
 
@@ -75,6 +85,107 @@ void MessageBroker::Stub::experimental_async::Receive(::grpc::ClientContext* con
   return ::grpc::internal::ClientAsyncReaderFactory< ::ReceiveResponse>::Create(channel_.get(), cq, rpcmethod_Receive_, context, request, false, nullptr);
 }
 
+::grpc::Status MessageBroker::Stub::Resolve(::grpc::ClientContext* context, const ::ResolveRequest& request, ::ResolveResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::ResolveRequest, ::ResolveResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Resolve_, context, request, response);
+}
+
+void MessageBroker::Stub::async::Resolve(::grpc::ClientContext* context, const ::ResolveRequest* request, ::ResolveResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::ResolveRequest, ::ResolveResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Resolve_, context, request, response, std::move(f));
+}
+
+void MessageBroker::Stub::async::Resolve(::grpc::ClientContext* context, const ::ResolveRequest* request, ::ResolveResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Resolve_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::ResolveResponse>* MessageBroker::Stub::PrepareAsyncResolveRaw(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::ResolveResponse, ::ResolveRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Resolve_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::ResolveResponse>* MessageBroker::Stub::AsyncResolveRaw(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncResolveRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReaderWriter< ::SendRequest, ::PublishAck>* MessageBroker::Stub::PublishRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::SendRequest, ::PublishAck>::Create(channel_.get(), rpcmethod_Publish_, context);
+}
+
+void MessageBroker::Stub::async::Publish(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::SendRequest,::PublishAck>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::SendRequest,::PublishAck>::Create(stub_->channel_.get(), stub_->rpcmethod_Publish_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::SendRequest, ::PublishAck>* MessageBroker::Stub::AsyncPublishRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::SendRequest, ::PublishAck>::Create(channel_.get(), cq, rpcmethod_Publish_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::SendRequest, ::PublishAck>* MessageBroker::Stub::PrepareAsyncPublishRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::SendRequest, ::PublishAck>::Create(channel_.get(), cq, rpcmethod_Publish_, context, false, nullptr);
+}
+
+::grpc::ClientReaderWriter< ::SubscribeRequest, ::ReceiveResponse>* MessageBroker::Stub::SubscribeRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::SubscribeRequest, ::ReceiveResponse>::Create(channel_.get(), rpcmethod_Subscribe_, context);
+}
+
+void MessageBroker::Stub::async::Subscribe(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::SubscribeRequest,::ReceiveResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::SubscribeRequest,::ReceiveResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_Subscribe_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::SubscribeRequest, ::ReceiveResponse>* MessageBroker::Stub::AsyncSubscribeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::SubscribeRequest, ::ReceiveResponse>::Create(channel_.get(), cq, rpcmethod_Subscribe_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::SubscribeRequest, ::ReceiveResponse>* MessageBroker::Stub::PrepareAsyncSubscribeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::SubscribeRequest, ::ReceiveResponse>::Create(channel_.get(), cq, rpcmethod_Subscribe_, context, false, nullptr);
+}
+
+::grpc::Status MessageBroker::Stub::Stats(::grpc::ClientContext* context, const ::StatsRequest& request, ::StatsResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::StatsRequest, ::StatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Stats_, context, request, response);
+}
+
+void MessageBroker::Stub::async::Stats(::grpc::ClientContext* context, const ::StatsRequest* request, ::StatsResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::StatsRequest, ::StatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Stats_, context, request, response, std::move(f));
+}
+
+void MessageBroker::Stub::async::Stats(::grpc::ClientContext* context, const ::StatsRequest* request, ::StatsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Stats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::StatsResponse>* MessageBroker::Stub::PrepareAsyncStatsRaw(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::StatsResponse, ::StatsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Stats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::StatsResponse>* MessageBroker::Stub::AsyncStatsRaw(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncStatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status MessageBroker::Stub::Dictionaries(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::DictionariesResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::DictionariesRequest, ::DictionariesResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Dictionaries_, context, request, response);
+}
+
+void MessageBroker::Stub::async::Dictionaries(::grpc::ClientContext* context, const ::DictionariesRequest* request, ::DictionariesResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::DictionariesRequest, ::DictionariesResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Dictionaries_, context, request, response, std::move(f));
+}
+
+void MessageBroker::Stub::async::Dictionaries(::grpc::ClientContext* context, const ::DictionariesRequest* request, ::DictionariesResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Dictionaries_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::DictionariesResponse>* MessageBroker::Stub::PrepareAsyncDictionariesRaw(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::DictionariesResponse, ::DictionariesRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Dictionaries_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::DictionariesResponse>* MessageBroker::Stub::AsyncDictionariesRaw(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncDictionariesRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 MessageBroker::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       MessageBroker_method_names[0],
@@ -96,6 +207,56 @@ MessageBroker::Service::Service() {
              ::grpc::ServerWriter<::ReceiveResponse>* writer) {
                return service->Receive(ctx, req, writer);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MessageBroker_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MessageBroker::Service, ::ResolveRequest, ::ResolveResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MessageBroker::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::ResolveRequest* req,
+             ::ResolveResponse* resp) {
+               return service->Resolve(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MessageBroker_method_names[3],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< MessageBroker::Service, ::SendRequest, ::PublishAck>(
+          [](MessageBroker::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::PublishAck,
+             ::SendRequest>* stream) {
+               return service->Publish(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MessageBroker_method_names[4],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< MessageBroker::Service, ::SubscribeRequest, ::ReceiveResponse>(
+          [](MessageBroker::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::ReceiveResponse,
+             ::SubscribeRequest>* stream) {
+               return service->Subscribe(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MessageBroker_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MessageBroker::Service, ::StatsRequest, ::StatsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MessageBroker::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::StatsRequest* req,
+             ::StatsResponse* resp) {
+               return service->Stats(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MessageBroker_method_names[6],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< MessageBroker::Service, ::DictionariesRequest, ::DictionariesResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](MessageBroker::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::DictionariesRequest* req,
+             ::DictionariesResponse* resp) {
+               return service->Dictionaries(ctx, req, resp);
+             }, this)));
 }
 
 MessageBroker::Service::~Service() {
@@ -115,4 +276,37 @@ MessageBroker::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status MessageBroker::Service::Resolve(::grpc::ServerContext* context, const ::ResolveRequest* request, ::ResolveResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MessageBroker::Service::Publish(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::PublishAck, ::SendRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MessageBroker::Service::Subscribe(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::ReceiveResponse, ::SubscribeRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MessageBroker::Service::Stats(::grpc::ServerContext* context, const ::StatsRequest* request, ::StatsResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MessageBroker::Service::Dictionaries(::grpc::ServerContext* context, const ::DictionariesRequest* request, ::DictionariesResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
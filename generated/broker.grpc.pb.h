@@ -7,24 +7,23 @@
 #include "broker.pb.h"
 
 #include <functional>
-#include <grpc/impl/codegen/port_platform.h>
-#include <grpcpp/impl/codegen/async_generic_service.h>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/client_context.h>
-#include <grpcpp/impl/codegen/completion_queue.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
 #include <grpcpp/impl/codegen/proto_utils.h>
-#include <grpcpp/impl/codegen/rpc_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
 #include <grpcpp/impl/codegen/status.h>
-#include <grpcpp/impl/codegen/stub_options.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
 
 class MessageBroker final {
  public:
@@ -50,38 +49,95 @@ class MessageBroker final {
     std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::ReceiveResponse>> PrepareAsyncReceive(::grpc::ClientContext* context, const ::ReceiveRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::ReceiveResponse>>(PrepareAsyncReceiveRaw(context, request, cq));
     }
-    class experimental_async_interface {
+    // turns topic names into ids that can be used in place of names in Send (it does not create topics, see ResolveResponse)
+    virtual ::grpc::Status Resolve(::grpc::ClientContext* context, const ::ResolveRequest& request, ::ResolveResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ResolveResponse>> AsyncResolve(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ResolveResponse>>(AsyncResolveRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ResolveResponse>> PrepareAsyncResolve(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::ResolveResponse>>(PrepareAsyncResolveRaw(context, request, cq));
+    }
+    // for high-rate producers: the same as Send on a long-lived stream. Acks are cumulative and they are sent every N messages or after a time window
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::SendRequest, ::PublishAck>> Publish(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::SendRequest, ::PublishAck>>(PublishRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::SendRequest, ::PublishAck>> AsyncPublish(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::SendRequest, ::PublishAck>>(AsyncPublishRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::SendRequest, ::PublishAck>> PrepareAsyncPublish(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::SendRequest, ::PublishAck>>(PrepareAsyncPublishRaw(context, cq));
+    }
+    // the same as Receive, except that topics can be subscribed and unsubscribed at any time on the same stream (see SubscribeRequest)
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::SubscribeRequest, ::ReceiveResponse>> Subscribe(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::SubscribeRequest, ::ReceiveResponse>>(SubscribeRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::SubscribeRequest, ::ReceiveResponse>> AsyncSubscribe(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::SubscribeRequest, ::ReceiveResponse>>(AsyncSubscribeRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::SubscribeRequest, ::ReceiveResponse>> PrepareAsyncSubscribe(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::SubscribeRequest, ::ReceiveResponse>>(PrepareAsyncSubscribeRaw(context, cq));
+    }
+    // what the broker is doing: throughput per topic, subscribers and their outbound queues, dispatcher threads and delivery latency
+    virtual ::grpc::Status Stats(::grpc::ClientContext* context, const ::StatsRequest& request, ::StatsResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::StatsResponse>> AsyncStats(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::StatsResponse>>(AsyncStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::StatsResponse>> PrepareAsyncStats(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::StatsResponse>>(PrepareAsyncStatsRaw(context, request, cq));
+    }
+    // the dictionaries compressed messages refer to (see Message.dictionary), a dictionary never changes once it is used
+    virtual ::grpc::Status Dictionaries(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::DictionariesResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::DictionariesResponse>> AsyncDictionaries(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::DictionariesResponse>>(AsyncDictionariesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::DictionariesResponse>> PrepareAsyncDictionaries(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::DictionariesResponse>>(PrepareAsyncDictionariesRaw(context, request, cq));
+    }
+    class async_interface {
      public:
-      virtual ~experimental_async_interface() {}
+      virtual ~async_interface() {}
       virtual void Send(::grpc::ClientContext* context, const ::SendRequest* request, ::SendResponse* response, std::function<void(::grpc::Status)>) = 0;
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       virtual void Send(::grpc::ClientContext* context, const ::SendRequest* request, ::SendResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      #else
-      virtual void Send(::grpc::ClientContext* context, const ::SendRequest* request, ::SendResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
-      #endif
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       virtual void Receive(::grpc::ClientContext* context, const ::ReceiveRequest* request, ::grpc::ClientReadReactor< ::ReceiveResponse>* reactor) = 0;
-      #else
-      virtual void Receive(::grpc::ClientContext* context, const ::ReceiveRequest* request, ::grpc::experimental::ClientReadReactor< ::ReceiveResponse>* reactor) = 0;
-      #endif
+      // turns topic names into ids that can be used in place of names in Send (it does not create topics, see ResolveResponse)
+      virtual void Resolve(::grpc::ClientContext* context, const ::ResolveRequest* request, ::ResolveResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Resolve(::grpc::ClientContext* context, const ::ResolveRequest* request, ::ResolveResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // for high-rate producers: the same as Send on a long-lived stream. Acks are cumulative and they are sent every N messages or after a time window
+      virtual void Publish(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::SendRequest,::PublishAck>* reactor) = 0;
+      // the same as Receive, except that topics can be subscribed and unsubscribed at any time on the same stream (see SubscribeRequest)
+      virtual void Subscribe(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::SubscribeRequest,::ReceiveResponse>* reactor) = 0;
+      // what the broker is doing: throughput per topic, subscribers and their outbound queues, dispatcher threads and delivery latency
+      virtual void Stats(::grpc::ClientContext* context, const ::StatsRequest* request, ::StatsResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Stats(::grpc::ClientContext* context, const ::StatsRequest* request, ::StatsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      // the dictionaries compressed messages refer to (see Message.dictionary), a dictionary never changes once it is used
+      virtual void Dictionaries(::grpc::ClientContext* context, const ::DictionariesRequest* request, ::DictionariesResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void Dictionaries(::grpc::ClientContext* context, const ::DictionariesRequest* request, ::DictionariesResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-    typedef class experimental_async_interface async_interface;
-    #endif
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-    async_interface* async() { return experimental_async(); }
-    #endif
-    virtual class experimental_async_interface* experimental_async() { return nullptr; }
-  private:
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::SendResponse>* AsyncSendRaw(::grpc::ClientContext* context, const ::SendRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::SendResponse>* PrepareAsyncSendRaw(::grpc::ClientContext* context, const ::SendRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientReaderInterface< ::ReceiveResponse>* ReceiveRaw(::grpc::ClientContext* context, const ::ReceiveRequest& request) = 0;
     virtual ::grpc::ClientAsyncReaderInterface< ::ReceiveResponse>* AsyncReceiveRaw(::grpc::ClientContext* context, const ::ReceiveRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
     virtual ::grpc::ClientAsyncReaderInterface< ::ReceiveResponse>* PrepareAsyncReceiveRaw(::grpc::ClientContext* context, const ::ReceiveRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ResolveResponse>* AsyncResolveRaw(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::ResolveResponse>* PrepareAsyncResolveRaw(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::SendRequest, ::PublishAck>* PublishRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::SendRequest, ::PublishAck>* AsyncPublishRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::SendRequest, ::PublishAck>* PrepareAsyncPublishRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::SubscribeRequest, ::ReceiveResponse>* SubscribeRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::SubscribeRequest, ::ReceiveResponse>* AsyncSubscribeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::SubscribeRequest, ::ReceiveResponse>* PrepareAsyncSubscribeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::StatsResponse>* AsyncStatsRaw(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::StatsResponse>* PrepareAsyncStatsRaw(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::DictionariesResponse>* AsyncDictionariesRaw(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::DictionariesResponse>* PrepareAsyncDictionariesRaw(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel);
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
     ::grpc::Status Send(::grpc::ClientContext* context, const ::SendRequest& request, ::SendResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::SendResponse>> AsyncSend(::grpc::ClientContext* context, const ::SendRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::SendResponse>>(AsyncSendRaw(context, request, cq));
@@ -98,38 +154,94 @@ class MessageBroker final {
     std::unique_ptr< ::grpc::ClientAsyncReader< ::ReceiveResponse>> PrepareAsyncReceive(::grpc::ClientContext* context, const ::ReceiveRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReader< ::ReceiveResponse>>(PrepareAsyncReceiveRaw(context, request, cq));
     }
-    class experimental_async final :
-      public StubInterface::experimental_async_interface {
+    ::grpc::Status Resolve(::grpc::ClientContext* context, const ::ResolveRequest& request, ::ResolveResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ResolveResponse>> AsyncResolve(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ResolveResponse>>(AsyncResolveRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ResolveResponse>> PrepareAsyncResolve(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::ResolveResponse>>(PrepareAsyncResolveRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::SendRequest, ::PublishAck>> Publish(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::SendRequest, ::PublishAck>>(PublishRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::SendRequest, ::PublishAck>> AsyncPublish(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::SendRequest, ::PublishAck>>(AsyncPublishRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::SendRequest, ::PublishAck>> PrepareAsyncPublish(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::SendRequest, ::PublishAck>>(PrepareAsyncPublishRaw(context, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::SubscribeRequest, ::ReceiveResponse>> Subscribe(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::SubscribeRequest, ::ReceiveResponse>>(SubscribeRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::SubscribeRequest, ::ReceiveResponse>> AsyncSubscribe(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::SubscribeRequest, ::ReceiveResponse>>(AsyncSubscribeRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::SubscribeRequest, ::ReceiveResponse>> PrepareAsyncSubscribe(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::SubscribeRequest, ::ReceiveResponse>>(PrepareAsyncSubscribeRaw(context, cq));
+    }
+    ::grpc::Status Stats(::grpc::ClientContext* context, const ::StatsRequest& request, ::StatsResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::StatsResponse>> AsyncStats(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::StatsResponse>>(AsyncStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::StatsResponse>> PrepareAsyncStats(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::StatsResponse>>(PrepareAsyncStatsRaw(context, request, cq));
+    }
+    ::grpc::Status Dictionaries(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::DictionariesResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::DictionariesResponse>> AsyncDictionaries(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::DictionariesResponse>>(AsyncDictionariesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::DictionariesResponse>> PrepareAsyncDictionaries(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::DictionariesResponse>>(PrepareAsyncDictionariesRaw(context, request, cq));
+    }
+    class async final :
+      public StubInterface::async_interface {
      public:
       void Send(::grpc::ClientContext* context, const ::SendRequest* request, ::SendResponse* response, std::function<void(::grpc::Status)>) override;
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       void Send(::grpc::ClientContext* context, const ::SendRequest* request, ::SendResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      #else
-      void Send(::grpc::ClientContext* context, const ::SendRequest* request, ::SendResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
-      #endif
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       void Receive(::grpc::ClientContext* context, const ::ReceiveRequest* request, ::grpc::ClientReadReactor< ::ReceiveResponse>* reactor) override;
-      #else
-      void Receive(::grpc::ClientContext* context, const ::ReceiveRequest* request, ::grpc::experimental::ClientReadReactor< ::ReceiveResponse>* reactor) override;
-      #endif
+      void Resolve(::grpc::ClientContext* context, const ::ResolveRequest* request, ::ResolveResponse* response, std::function<void(::grpc::Status)>) override;
+      void Resolve(::grpc::ClientContext* context, const ::ResolveRequest* request, ::ResolveResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Publish(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::SendRequest,::PublishAck>* reactor) override;
+      void Subscribe(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::SubscribeRequest,::ReceiveResponse>* reactor) override;
+      void Stats(::grpc::ClientContext* context, const ::StatsRequest* request, ::StatsResponse* response, std::function<void(::grpc::Status)>) override;
+      void Stats(::grpc::ClientContext* context, const ::StatsRequest* request, ::StatsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void Dictionaries(::grpc::ClientContext* context, const ::DictionariesRequest* request, ::DictionariesResponse* response, std::function<void(::grpc::Status)>) override;
+      void Dictionaries(::grpc::ClientContext* context, const ::DictionariesRequest* request, ::DictionariesResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
-      explicit experimental_async(Stub* stub): stub_(stub) { }
+      explicit async(Stub* stub): stub_(stub) { }
       Stub* stub() { return stub_; }
       Stub* stub_;
     };
-    class experimental_async_interface* experimental_async() override { return &async_stub_; }
+    class async* async() override { return &async_stub_; }
 
    private:
     std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class experimental_async async_stub_{this};
+    class async async_stub_{this};
     ::grpc::ClientAsyncResponseReader< ::SendResponse>* AsyncSendRaw(::grpc::ClientContext* context, const ::SendRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::SendResponse>* PrepareAsyncSendRaw(::grpc::ClientContext* context, const ::SendRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientReader< ::ReceiveResponse>* ReceiveRaw(::grpc::ClientContext* context, const ::ReceiveRequest& request) override;
     ::grpc::ClientAsyncReader< ::ReceiveResponse>* AsyncReceiveRaw(::grpc::ClientContext* context, const ::ReceiveRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
     ::grpc::ClientAsyncReader< ::ReceiveResponse>* PrepareAsyncReceiveRaw(::grpc::ClientContext* context, const ::ReceiveRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ResolveResponse>* AsyncResolveRaw(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::ResolveResponse>* PrepareAsyncResolveRaw(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::SendRequest, ::PublishAck>* PublishRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::SendRequest, ::PublishAck>* AsyncPublishRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::SendRequest, ::PublishAck>* PrepareAsyncPublishRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::SubscribeRequest, ::ReceiveResponse>* SubscribeRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::SubscribeRequest, ::ReceiveResponse>* AsyncSubscribeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::SubscribeRequest, ::ReceiveResponse>* PrepareAsyncSubscribeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::StatsResponse>* AsyncStatsRaw(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::StatsResponse>* PrepareAsyncStatsRaw(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::DictionariesResponse>* AsyncDictionariesRaw(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::DictionariesResponse>* PrepareAsyncDictionariesRaw(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Send_;
     const ::grpc::internal::RpcMethod rpcmethod_Receive_;
+    const ::grpc::internal::RpcMethod rpcmethod_Resolve_;
+    const ::grpc::internal::RpcMethod rpcmethod_Publish_;
+    const ::grpc::internal::RpcMethod rpcmethod_Subscribe_;
+    const ::grpc::internal::RpcMethod rpcmethod_Stats_;
+    const ::grpc::internal::RpcMethod rpcmethod_Dictionaries_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -139,6 +251,16 @@ class MessageBroker final {
     virtual ~Service();
     virtual ::grpc::Status Send(::grpc::ServerContext* context, const ::SendRequest* request, ::SendResponse* response);
     virtual ::grpc::Status Receive(::grpc::ServerContext* context, const ::ReceiveRequest* request, ::grpc::ServerWriter< ::ReceiveResponse>* writer);
+    // turns topic names into ids that can be used in place of names in Send (it does not create topics, see ResolveResponse)
+    virtual ::grpc::Status Resolve(::grpc::ServerContext* context, const ::ResolveRequest* request, ::ResolveResponse* response);
+    // for high-rate producers: the same as Send on a long-lived stream. Acks are cumulative and they are sent every N messages or after a time window
+    virtual ::grpc::Status Publish(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::PublishAck, ::SendRequest>* stream);
+    // the same as Receive, except that topics can be subscribed and unsubscribed at any time on the same stream (see SubscribeRequest)
+    virtual ::grpc::Status Subscribe(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::ReceiveResponse, ::SubscribeRequest>* stream);
+    // what the broker is doing: throughput per topic, subscribers and their outbound queues, dispatcher threads and delivery latency
+    virtual ::grpc::Status Stats(::grpc::ServerContext* context, const ::StatsRequest* request, ::StatsResponse* response);
+    // the dictionaries compressed messages refer to (see Message.dictionary), a dictionary never changes once it is used
+    virtual ::grpc::Status Dictionaries(::grpc::ServerContext* context, const ::DictionariesRequest* request, ::DictionariesResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_Send : public BaseClass {
@@ -180,38 +302,124 @@ class MessageBroker final {
       ::grpc::Service::RequestAsyncServerStreaming(1, context, request, writer, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Send<WithAsyncMethod_Receive<Service > > AsyncService;
   template <class BaseClass>
-  class ExperimentalWithCallbackMethod_Send : public BaseClass {
+  class WithAsyncMethod_Resolve : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Resolve() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_Resolve() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Resolve(::grpc::ServerContext* /*context*/, const ::ResolveRequest* /*request*/, ::ResolveResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestResolve(::grpc::ServerContext* context, ::ResolveRequest* request, ::grpc::ServerAsyncResponseWriter< ::ResolveResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Publish : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Publish() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_Publish() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Publish(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::PublishAck, ::SendRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPublish(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::PublishAck, ::SendRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(3, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Subscribe : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithCallbackMethod_Send() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodCallback(0,
+    WithAsyncMethod_Subscribe() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_Subscribe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Subscribe(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::ReceiveResponse, ::SubscribeRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribe(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::ReceiveResponse, ::SubscribeRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Stats() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_Stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Stats(::grpc::ServerContext* /*context*/, const ::StatsRequest* /*request*/, ::StatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStats(::grpc::ServerContext* context, ::StatsRequest* request, ::grpc::ServerAsyncResponseWriter< ::StatsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Dictionaries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Dictionaries() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_Dictionaries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Dictionaries(::grpc::ServerContext* /*context*/, const ::DictionariesRequest* /*request*/, ::DictionariesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestDictionaries(::grpc::ServerContext* context, ::DictionariesRequest* request, ::grpc::ServerAsyncResponseWriter< ::DictionariesResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Send<WithAsyncMethod_Receive<WithAsyncMethod_Resolve<WithAsyncMethod_Publish<WithAsyncMethod_Subscribe<WithAsyncMethod_Stats<WithAsyncMethod_Dictionaries<Service > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_Send : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Send() {
+      ::grpc::Service::MarkMethodCallback(0,
           new ::grpc::internal::CallbackUnaryHandler< ::SendRequest, ::SendResponse>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const ::SendRequest* request, ::SendResponse* response) { return this->Send(context, request, response); }));}
+                   ::grpc::CallbackServerContext* context, const ::SendRequest* request, ::SendResponse* response) { return this->Send(context, request, response); }));}
     void SetMessageAllocatorFor_Send(
-        ::grpc::experimental::MessageAllocator< ::SendRequest, ::SendResponse>* allocator) {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+        ::grpc::MessageAllocator< ::SendRequest, ::SendResponse>* allocator) {
       ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-    #else
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(0);
-    #endif
       static_cast<::grpc::internal::CallbackUnaryHandler< ::SendRequest, ::SendResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~ExperimentalWithCallbackMethod_Send() override {
+    ~WithCallbackMethod_Send() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -219,37 +427,21 @@ class MessageBroker final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerUnaryReactor* Send(
-      ::grpc::CallbackServerContext* /*context*/, const ::SendRequest* /*request*/, ::SendResponse* /*response*/)
-    #else
-    virtual ::grpc::experimental::ServerUnaryReactor* Send(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::SendRequest* /*request*/, ::SendResponse* /*response*/)
-    #endif
-      { return nullptr; }
+      ::grpc::CallbackServerContext* /*context*/, const ::SendRequest* /*request*/, ::SendResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithCallbackMethod_Receive : public BaseClass {
+  class WithCallbackMethod_Receive : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithCallbackMethod_Receive() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodCallback(1,
+    WithCallbackMethod_Receive() {
+      ::grpc::Service::MarkMethodCallback(1,
           new ::grpc::internal::CallbackServerStreamingHandler< ::ReceiveRequest, ::ReceiveResponse>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const ::ReceiveRequest* request) { return this->Receive(context, request); }));
+                   ::grpc::CallbackServerContext* context, const ::ReceiveRequest* request) { return this->Receive(context, request); }));
     }
-    ~ExperimentalWithCallbackMethod_Receive() override {
+    ~WithCallbackMethod_Receive() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -257,20 +449,138 @@ class MessageBroker final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerWriteReactor< ::ReceiveResponse>* Receive(
-      ::grpc::CallbackServerContext* /*context*/, const ::ReceiveRequest* /*request*/)
-    #else
-    virtual ::grpc::experimental::ServerWriteReactor< ::ReceiveResponse>* Receive(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::ReceiveRequest* /*request*/)
-    #endif
+      ::grpc::CallbackServerContext* /*context*/, const ::ReceiveRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Resolve : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Resolve() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::ResolveRequest, ::ResolveResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::ResolveRequest* request, ::ResolveResponse* response) { return this->Resolve(context, request, response); }));}
+    void SetMessageAllocatorFor_Resolve(
+        ::grpc::MessageAllocator< ::ResolveRequest, ::ResolveResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::ResolveRequest, ::ResolveResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Resolve() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Resolve(::grpc::ServerContext* /*context*/, const ::ResolveRequest* /*request*/, ::ResolveResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Resolve(
+      ::grpc::CallbackServerContext* /*context*/, const ::ResolveRequest* /*request*/, ::ResolveResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Publish : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Publish() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackBidiHandler< ::SendRequest, ::PublishAck>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->Publish(context); }));
+    }
+    ~WithCallbackMethod_Publish() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Publish(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::PublishAck, ::SendRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::SendRequest, ::PublishAck>* Publish(
+      ::grpc::CallbackServerContext* /*context*/)
       { return nullptr; }
   };
-  #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_Send<ExperimentalWithCallbackMethod_Receive<Service > > CallbackService;
-  #endif
-
-  typedef ExperimentalWithCallbackMethod_Send<ExperimentalWithCallbackMethod_Receive<Service > > ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_Subscribe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Subscribe() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::SubscribeRequest, ::ReceiveResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->Subscribe(context); }));
+    }
+    ~WithCallbackMethod_Subscribe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Subscribe(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::ReceiveResponse, ::SubscribeRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::SubscribeRequest, ::ReceiveResponse>* Subscribe(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Stats() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::StatsRequest, ::StatsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::StatsRequest* request, ::StatsResponse* response) { return this->Stats(context, request, response); }));}
+    void SetMessageAllocatorFor_Stats(
+        ::grpc::MessageAllocator< ::StatsRequest, ::StatsResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::StatsRequest, ::StatsResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Stats(::grpc::ServerContext* /*context*/, const ::StatsRequest* /*request*/, ::StatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Stats(
+      ::grpc::CallbackServerContext* /*context*/, const ::StatsRequest* /*request*/, ::StatsResponse* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Dictionaries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Dictionaries() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::DictionariesRequest, ::DictionariesResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::DictionariesRequest* request, ::DictionariesResponse* response) { return this->Dictionaries(context, request, response); }));}
+    void SetMessageAllocatorFor_Dictionaries(
+        ::grpc::MessageAllocator< ::DictionariesRequest, ::DictionariesResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::DictionariesRequest, ::DictionariesResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_Dictionaries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Dictionaries(::grpc::ServerContext* /*context*/, const ::DictionariesRequest* /*request*/, ::DictionariesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Dictionaries(
+      ::grpc::CallbackServerContext* /*context*/, const ::DictionariesRequest* /*request*/, ::DictionariesResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_Send<WithCallbackMethod_Receive<WithCallbackMethod_Resolve<WithCallbackMethod_Publish<WithCallbackMethod_Subscribe<WithCallbackMethod_Stats<WithCallbackMethod_Dictionaries<Service > > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Send : public BaseClass {
    private:
@@ -306,6 +616,91 @@ class MessageBroker final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_Resolve : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Resolve() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_Resolve() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Resolve(::grpc::ServerContext* /*context*/, const ::ResolveRequest* /*request*/, ::ResolveResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Publish : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Publish() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_Publish() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Publish(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::PublishAck, ::SendRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Subscribe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Subscribe() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_Subscribe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Subscribe(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::ReceiveResponse, ::SubscribeRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Stats() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_Stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Stats(::grpc::ServerContext* /*context*/, const ::StatsRequest* /*request*/, ::StatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_Dictionaries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_Dictionaries() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_Dictionaries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Dictionaries(::grpc::ServerContext* /*context*/, const ::DictionariesRequest* /*request*/, ::DictionariesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Send : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -346,27 +741,117 @@ class MessageBroker final {
     }
   };
   template <class BaseClass>
-  class ExperimentalWithRawCallbackMethod_Send : public BaseClass {
+  class WithRawMethod_Resolve : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Resolve() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_Resolve() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Resolve(::grpc::ServerContext* /*context*/, const ::ResolveRequest* /*request*/, ::ResolveResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestResolve(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Publish : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Publish() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_Publish() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Publish(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::PublishAck, ::SendRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestPublish(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(3, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Subscribe : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithRawCallbackMethod_Send() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodRawCallback(0,
+    WithRawMethod_Subscribe() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_Subscribe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Subscribe(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::ReceiveResponse, ::SubscribeRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribe(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Stats() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_Stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Stats(::grpc::ServerContext* /*context*/, const ::StatsRequest* /*request*/, ::StatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Dictionaries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Dictionaries() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_Dictionaries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Dictionaries(::grpc::ServerContext* /*context*/, const ::DictionariesRequest* /*request*/, ::DictionariesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestDictionaries(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Send : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Send() {
+      ::grpc::Service::MarkMethodRawCallback(0,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Send(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Send(context, request, response); }));
     }
-    ~ExperimentalWithRawCallbackMethod_Send() override {
+    ~WithRawCallbackMethod_Send() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -374,37 +859,21 @@ class MessageBroker final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerUnaryReactor* Send(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
-    #else
-    virtual ::grpc::experimental::ServerUnaryReactor* Send(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
-    #endif
-      { return nullptr; }
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithRawCallbackMethod_Receive : public BaseClass {
+  class WithRawCallbackMethod_Receive : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithRawCallbackMethod_Receive() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodRawCallback(1,
+    WithRawCallbackMethod_Receive() {
+      ::grpc::Service::MarkMethodRawCallback(1,
           new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const::grpc::ByteBuffer* request) { return this->Receive(context, request); }));
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->Receive(context, request); }));
     }
-    ~ExperimentalWithRawCallbackMethod_Receive() override {
+    ~WithRawCallbackMethod_Receive() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -412,16 +881,122 @@ class MessageBroker final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* Receive(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
-    #else
-    virtual ::grpc::experimental::ServerWriteReactor< ::grpc::ByteBuffer>* Receive(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
-    #endif
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Resolve : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Resolve() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Resolve(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Resolve() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Resolve(::grpc::ServerContext* /*context*/, const ::ResolveRequest* /*request*/, ::ResolveResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Resolve(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Publish : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Publish() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->Publish(context); }));
+    }
+    ~WithRawCallbackMethod_Publish() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Publish(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::PublishAck, ::SendRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* Publish(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Subscribe : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Subscribe() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->Subscribe(context); }));
+    }
+    ~WithRawCallbackMethod_Subscribe() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Subscribe(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::ReceiveResponse, ::SubscribeRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* Subscribe(
+      ::grpc::CallbackServerContext* /*context*/)
       { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_Stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Stats() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Stats(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Stats(::grpc::ServerContext* /*context*/, const ::StatsRequest* /*request*/, ::StatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Stats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Dictionaries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Dictionaries() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Dictionaries(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_Dictionaries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Dictionaries(::grpc::ServerContext* /*context*/, const ::DictionariesRequest* /*request*/, ::DictionariesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* Dictionaries(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Send : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -448,7 +1023,88 @@ class MessageBroker final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedSend(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::SendRequest,::SendResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_Send<Service > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Resolve : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Resolve() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::ResolveRequest, ::ResolveResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::ResolveRequest, ::ResolveResponse>* streamer) {
+                       return this->StreamedResolve(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Resolve() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Resolve(::grpc::ServerContext* /*context*/, const ::ResolveRequest* /*request*/, ::ResolveResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedResolve(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::ResolveRequest,::ResolveResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Stats() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::StatsRequest, ::StatsResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::StatsRequest, ::StatsResponse>* streamer) {
+                       return this->StreamedStats(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Stats(::grpc::ServerContext* /*context*/, const ::StatsRequest* /*request*/, ::StatsResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::StatsRequest,::StatsResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_Dictionaries : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_Dictionaries() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::DictionariesRequest, ::DictionariesResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::DictionariesRequest, ::DictionariesResponse>* streamer) {
+                       return this->StreamedDictionaries(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_Dictionaries() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Dictionaries(::grpc::ServerContext* /*context*/, const ::DictionariesRequest* /*request*/, ::DictionariesResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedDictionaries(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::DictionariesRequest,::DictionariesResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_Send<WithStreamedUnaryMethod_Resolve<WithStreamedUnaryMethod_Stats<WithStreamedUnaryMethod_Dictionaries<Service > > > > StreamedUnaryService;
   template <class BaseClass>
   class WithSplitStreamingMethod_Receive : public BaseClass {
    private:
@@ -477,7 +1133,7 @@ class MessageBroker final {
     virtual ::grpc::Status StreamedReceive(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::ReceiveRequest,::ReceiveResponse>* server_split_streamer) = 0;
   };
   typedef WithSplitStreamingMethod_Receive<Service > SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Send<WithSplitStreamingMethod_Receive<Service > > StreamedService;
+  typedef WithStreamedUnaryMethod_Send<WithSplitStreamingMethod_Receive<WithStreamedUnaryMethod_Resolve<WithStreamedUnaryMethod_Stats<WithStreamedUnaryMethod_Dictionaries<Service > > > > > StreamedService;
 };
 
 
@@ -16,265 +16,1215 @@
 #include <google/protobuf/port_def.inc>
 
 PROTOBUF_PRAGMA_INIT_SEG
-constexpr Message::Message(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : topic_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , content_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string){}
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+PROTOBUF_CONSTEXPR Message_HeadersEntry_DoNotUse::Message_HeadersEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Message_HeadersEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Message_HeadersEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Message_HeadersEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Message_HeadersEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Message_HeadersEntry_DoNotUseDefaultTypeInternal _Message_HeadersEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Message::Message(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.headers_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.topic_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.deflated_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.origin_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.topic_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.offset_)*/uint64_t{0u}
+  , /*decltype(_impl_.retain_)*/false
+  , /*decltype(_impl_.dictionary_)*/0u} {}
 struct MessageDefaultTypeInternal {
-  constexpr MessageDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR MessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~MessageDefaultTypeInternal() {}
   union {
     Message _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT MessageDefaultTypeInternal _Message_default_instance_;
-constexpr SendRequest::SendRequest(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : messages_(){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageDefaultTypeInternal _Message_default_instance_;
+PROTOBUF_CONSTEXPR SendRequest::SendRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct SendRequestDefaultTypeInternal {
-  constexpr SendRequestDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR SendRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~SendRequestDefaultTypeInternal() {}
   union {
     SendRequest _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT SendRequestDefaultTypeInternal _SendRequest_default_instance_;
-constexpr SendResponse::SendResponse(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendRequestDefaultTypeInternal _SendRequest_default_instance_;
+PROTOBUF_CONSTEXPR SendResponse::SendResponse(
+    ::_pbi::ConstantInitialized) {}
 struct SendResponseDefaultTypeInternal {
-  constexpr SendResponseDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR SendResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~SendResponseDefaultTypeInternal() {}
   union {
     SendResponse _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT SendResponseDefaultTypeInternal _SendResponse_default_instance_;
-constexpr ReceiveRequest::ReceiveRequest(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : topics_(){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendResponseDefaultTypeInternal _SendResponse_default_instance_;
+PROTOBUF_CONSTEXPR PublishAck::PublishAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.acknowledged_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PublishAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PublishAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PublishAckDefaultTypeInternal() {}
+  union {
+    PublishAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PublishAckDefaultTypeInternal _PublishAck_default_instance_;
+PROTOBUF_CONSTEXPR ResolveRequest::ResolveRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.topics_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResolveRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResolveRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResolveRequestDefaultTypeInternal() {}
+  union {
+    ResolveRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResolveRequestDefaultTypeInternal _ResolveRequest_default_instance_;
+PROTOBUF_CONSTEXPR ResolveResponse::ResolveResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.topic_ids_)*/{}
+  , /*decltype(_impl_._topic_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResolveResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResolveResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResolveResponseDefaultTypeInternal() {}
+  union {
+    ResolveResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResolveResponseDefaultTypeInternal _ResolveResponse_default_instance_;
+PROTOBUF_CONSTEXPR ReceiveRequest_StartOffsetsEntry_DoNotUse::ReceiveRequest_StartOffsetsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct ReceiveRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReceiveRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReceiveRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    ReceiveRequest_StartOffsetsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReceiveRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal _ReceiveRequest_StartOffsetsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR ReceiveRequest_FiltersEntry_DoNotUse::ReceiveRequest_FiltersEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct ReceiveRequest_FiltersEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReceiveRequest_FiltersEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReceiveRequest_FiltersEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    ReceiveRequest_FiltersEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReceiveRequest_FiltersEntry_DoNotUseDefaultTypeInternal _ReceiveRequest_FiltersEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR ReceiveRequest::ReceiveRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.topics_)*/{}
+  , /*decltype(_impl_.start_offsets_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.filters_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.group_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.federation_peer_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.max_batch_)*/0u
+  , /*decltype(_impl_.linger_us_)*/0u
+  , /*decltype(_impl_.max_queue_)*/0u
+  , /*decltype(_impl_.overflow_policy_)*/0
+  , /*decltype(_impl_.group_balancing_)*/0
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_.conflation_)*/0
+  , /*decltype(_impl_.max_rate_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct ReceiveRequestDefaultTypeInternal {
-  constexpr ReceiveRequestDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR ReceiveRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~ReceiveRequestDefaultTypeInternal() {}
   union {
     ReceiveRequest _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ReceiveRequestDefaultTypeInternal _ReceiveRequest_default_instance_;
-constexpr ReceiveResponse::ReceiveResponse(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : message_(nullptr){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReceiveRequestDefaultTypeInternal _ReceiveRequest_default_instance_;
+PROTOBUF_CONSTEXPR SubscribeRequest_StartOffsetsEntry_DoNotUse::SubscribeRequest_StartOffsetsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct SubscribeRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubscribeRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubscribeRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    SubscribeRequest_StartOffsetsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscribeRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal _SubscribeRequest_StartOffsetsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR SubscribeRequest_FiltersEntry_DoNotUse::SubscribeRequest_FiltersEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct SubscribeRequest_FiltersEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubscribeRequest_FiltersEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubscribeRequest_FiltersEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    SubscribeRequest_FiltersEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscribeRequest_FiltersEntry_DoNotUseDefaultTypeInternal _SubscribeRequest_FiltersEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR SubscribeRequest::SubscribeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.subscribe_)*/{}
+  , /*decltype(_impl_.unsubscribe_)*/{}
+  , /*decltype(_impl_.start_offsets_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.filters_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.delivery_)*/nullptr
+  , /*decltype(_impl_.acks_)*/nullptr
+  , /*decltype(_impl_.ack_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SubscribeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubscribeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubscribeRequestDefaultTypeInternal() {}
+  union {
+    SubscribeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscribeRequestDefaultTypeInternal _SubscribeRequest_default_instance_;
+PROTOBUF_CONSTEXPR AckSettings::AckSettings(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.session_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.window_)*/0u
+  , /*decltype(_impl_.timeout_ms_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AckSettingsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AckSettingsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AckSettingsDefaultTypeInternal() {}
+  union {
+    AckSettings _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AckSettingsDefaultTypeInternal _AckSettings_default_instance_;
+PROTOBUF_CONSTEXPR ReceiveResponse::ReceiveResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.sequence_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct ReceiveResponseDefaultTypeInternal {
-  constexpr ReceiveResponseDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR ReceiveResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~ReceiveResponseDefaultTypeInternal() {}
   union {
     ReceiveResponse _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ReceiveResponseDefaultTypeInternal _ReceiveResponse_default_instance_;
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_broker_2eproto[5];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_broker_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_broker_2eproto = nullptr;
-
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_broker_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  ~0u,  // no _has_bits_
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReceiveResponseDefaultTypeInternal _ReceiveResponse_default_instance_;
+PROTOBUF_CONSTEXPR StatsRequest::StatsRequest(
+    ::_pbi::ConstantInitialized) {}
+struct StatsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsRequestDefaultTypeInternal() {}
+  union {
+    StatsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+PROTOBUF_CONSTEXPR TopicStats::TopicStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.topic_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.topic_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.messages_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.messages_per_second_)*/0
+  , /*decltype(_impl_.bytes_per_second_)*/0
+  , /*decltype(_impl_.subscribers_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TopicStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TopicStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TopicStatsDefaultTypeInternal() {}
+  union {
+    TopicStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TopicStatsDefaultTypeInternal _TopicStats_default_instance_;
+PROTOBUF_CONSTEXPR SubscriberStats::SubscriberStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.topics_)*/uint64_t{0u}
+  , /*decltype(_impl_.patterns_)*/uint64_t{0u}
+  , /*decltype(_impl_.groups_)*/uint64_t{0u}
+  , /*decltype(_impl_.queue_depth_)*/uint64_t{0u}
+  , /*decltype(_impl_.queue_capacity_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_queue_depth_)*/uint64_t{0u}
+  , /*decltype(_impl_.dropped_)*/uint64_t{0u}
+  , /*decltype(_impl_.conflated_)*/uint64_t{0u}
+  , /*decltype(_impl_.lightweight_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SubscriberStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubscriberStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubscriberStatsDefaultTypeInternal() {}
+  union {
+    SubscriberStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscriberStatsDefaultTypeInternal _SubscriberStats_default_instance_;
+PROTOBUF_CONSTEXPR DispatcherThreadStats::DispatcherThreadStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.thread_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.events_)*/uint64_t{0u}
+  , /*decltype(_impl_.busy_seconds_)*/0
+  , /*decltype(_impl_.utilization_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DispatcherThreadStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DispatcherThreadStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DispatcherThreadStatsDefaultTypeInternal() {}
+  union {
+    DispatcherThreadStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DispatcherThreadStatsDefaultTypeInternal _DispatcherThreadStats_default_instance_;
+PROTOBUF_CONSTEXPR LatencyHistogram_Bucket::LatencyHistogram_Bucket(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.up_to_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LatencyHistogram_BucketDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencyHistogram_BucketDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencyHistogram_BucketDefaultTypeInternal() {}
+  union {
+    LatencyHistogram_Bucket _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencyHistogram_BucketDefaultTypeInternal _LatencyHistogram_Bucket_default_instance_;
+PROTOBUF_CONSTEXPR LatencyHistogram::LatencyHistogram(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.buckets_)*/{}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.p50_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.p90_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.p99_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.p999_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LatencyHistogramDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LatencyHistogramDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LatencyHistogramDefaultTypeInternal() {}
+  union {
+    LatencyHistogram _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LatencyHistogramDefaultTypeInternal _LatencyHistogram_default_instance_;
+PROTOBUF_CONSTEXPR StatsResponse::StatsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.topics_)*/{}
+  , /*decltype(_impl_.subscribers_)*/{}
+  , /*decltype(_impl_.dispatcher_threads_)*/{}
+  , /*decltype(_impl_.publish_to_write_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsResponseDefaultTypeInternal() {}
+  union {
+    StatsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsResponseDefaultTypeInternal _StatsResponse_default_instance_;
+PROTOBUF_CONSTEXPR DictionariesRequest::DictionariesRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.topic_ids_)*/{}
+  , /*decltype(_impl_._topic_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DictionariesRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DictionariesRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DictionariesRequestDefaultTypeInternal() {}
+  union {
+    DictionariesRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DictionariesRequestDefaultTypeInternal _DictionariesRequest_default_instance_;
+PROTOBUF_CONSTEXPR Dictionary::Dictionary(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.topic_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DictionaryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DictionaryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DictionaryDefaultTypeInternal() {}
+  union {
+    Dictionary _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DictionaryDefaultTypeInternal _Dictionary_default_instance_;
+PROTOBUF_CONSTEXPR DictionariesResponse::DictionariesResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.dictionaries_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DictionariesResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DictionariesResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DictionariesResponseDefaultTypeInternal() {}
+  union {
+    DictionariesResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DictionariesResponseDefaultTypeInternal _DictionariesResponse_default_instance_;
+static ::_pb::Metadata file_level_metadata_broker_2eproto[25];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_broker_2eproto[4];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_broker_2eproto = nullptr;
+
+const uint32_t TableStruct_broker_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::Message_HeadersEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::Message_HeadersEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Message_HeadersEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::Message_HeadersEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::Message, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::Message, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::Message, topic_),
-  PROTOBUF_FIELD_OFFSET(::Message, content_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Message, _impl_.topic_),
+  PROTOBUF_FIELD_OFFSET(::Message, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::Message, _impl_.topic_id_),
+  PROTOBUF_FIELD_OFFSET(::Message, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::Message, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::Message, _impl_.retain_),
+  PROTOBUF_FIELD_OFFSET(::Message, _impl_.deflated_),
+  PROTOBUF_FIELD_OFFSET(::Message, _impl_.dictionary_),
+  PROTOBUF_FIELD_OFFSET(::Message, _impl_.origin_),
+  PROTOBUF_FIELD_OFFSET(::Message, _impl_.headers_),
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::SendRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::SendRequest, messages_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SendRequest, _impl_.messages_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::SendResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::PublishAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::PublishAck, _impl_.acknowledged_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ResolveRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ResolveRequest, _impl_.topics_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::ResolveResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ResolveResponse, _impl_.topic_ids_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest_StartOffsetsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest_StartOffsetsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest_StartOffsetsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest_StartOffsetsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest_FiltersEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest_FiltersEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest_FiltersEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest_FiltersEntry_DoNotUse, value_),
+  0,
+  1,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, topics_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.topics_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.max_batch_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.linger_us_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.max_queue_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.overflow_policy_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.start_offsets_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.group_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.group_balancing_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.federation_peer_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.conflation_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.max_rate_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveRequest, _impl_.filters_),
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest_StartOffsetsEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest_StartOffsetsEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest_StartOffsetsEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest_StartOffsetsEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest_FiltersEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest_FiltersEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest_FiltersEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest_FiltersEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest, _impl_.subscribe_),
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest, _impl_.unsubscribe_),
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest, _impl_.start_offsets_),
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest, _impl_.delivery_),
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest, _impl_.acks_),
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest, _impl_.ack_),
+  PROTOBUF_FIELD_OFFSET(::SubscribeRequest, _impl_.filters_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::AckSettings, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::AckSettings, _impl_.window_),
+  PROTOBUF_FIELD_OFFSET(::AckSettings, _impl_.timeout_ms_),
+  PROTOBUF_FIELD_OFFSET(::AckSettings, _impl_.session_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::ReceiveResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::ReceiveResponse, message_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::ReceiveResponse, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveResponse, _impl_.messages_),
+  PROTOBUF_FIELD_OFFSET(::ReceiveResponse, _impl_.sequence_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::StatsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TopicStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TopicStats, _impl_.topic_),
+  PROTOBUF_FIELD_OFFSET(::TopicStats, _impl_.topic_id_),
+  PROTOBUF_FIELD_OFFSET(::TopicStats, _impl_.messages_),
+  PROTOBUF_FIELD_OFFSET(::TopicStats, _impl_.bytes_),
+  PROTOBUF_FIELD_OFFSET(::TopicStats, _impl_.messages_per_second_),
+  PROTOBUF_FIELD_OFFSET(::TopicStats, _impl_.bytes_per_second_),
+  PROTOBUF_FIELD_OFFSET(::TopicStats, _impl_.subscribers_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::SubscriberStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SubscriberStats, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::SubscriberStats, _impl_.topics_),
+  PROTOBUF_FIELD_OFFSET(::SubscriberStats, _impl_.patterns_),
+  PROTOBUF_FIELD_OFFSET(::SubscriberStats, _impl_.groups_),
+  PROTOBUF_FIELD_OFFSET(::SubscriberStats, _impl_.queue_depth_),
+  PROTOBUF_FIELD_OFFSET(::SubscriberStats, _impl_.queue_capacity_),
+  PROTOBUF_FIELD_OFFSET(::SubscriberStats, _impl_.max_queue_depth_),
+  PROTOBUF_FIELD_OFFSET(::SubscriberStats, _impl_.dropped_),
+  PROTOBUF_FIELD_OFFSET(::SubscriberStats, _impl_.conflated_),
+  PROTOBUF_FIELD_OFFSET(::SubscriberStats, _impl_.lightweight_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::DispatcherThreadStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::DispatcherThreadStats, _impl_.thread_id_),
+  PROTOBUF_FIELD_OFFSET(::DispatcherThreadStats, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::DispatcherThreadStats, _impl_.busy_seconds_),
+  PROTOBUF_FIELD_OFFSET(::DispatcherThreadStats, _impl_.utilization_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::LatencyHistogram_Bucket, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::LatencyHistogram_Bucket, _impl_.up_to_ns_),
+  PROTOBUF_FIELD_OFFSET(::LatencyHistogram_Bucket, _impl_.count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::LatencyHistogram, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::LatencyHistogram, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::LatencyHistogram, _impl_.p50_ns_),
+  PROTOBUF_FIELD_OFFSET(::LatencyHistogram, _impl_.p90_ns_),
+  PROTOBUF_FIELD_OFFSET(::LatencyHistogram, _impl_.p99_ns_),
+  PROTOBUF_FIELD_OFFSET(::LatencyHistogram, _impl_.p999_ns_),
+  PROTOBUF_FIELD_OFFSET(::LatencyHistogram, _impl_.max_ns_),
+  PROTOBUF_FIELD_OFFSET(::LatencyHistogram, _impl_.buckets_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::StatsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::StatsResponse, _impl_.topics_),
+  PROTOBUF_FIELD_OFFSET(::StatsResponse, _impl_.subscribers_),
+  PROTOBUF_FIELD_OFFSET(::StatsResponse, _impl_.dispatcher_threads_),
+  PROTOBUF_FIELD_OFFSET(::StatsResponse, _impl_.publish_to_write_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::DictionariesRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::DictionariesRequest, _impl_.topic_ids_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::Dictionary, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::Dictionary, _impl_.topic_id_),
+  PROTOBUF_FIELD_OFFSET(::Dictionary, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::Dictionary, _impl_.data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::DictionariesResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::DictionariesResponse, _impl_.dictionaries_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::Message)},
-  { 7, -1, sizeof(::SendRequest)},
-  { 13, -1, sizeof(::SendResponse)},
-  { 18, -1, sizeof(::ReceiveRequest)},
-  { 24, -1, sizeof(::ReceiveResponse)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::Message_HeadersEntry_DoNotUse)},
+  { 10, 26, -1, sizeof(::Message)},
+  { 36, -1, -1, sizeof(::SendRequest)},
+  { 43, -1, -1, sizeof(::SendResponse)},
+  { 49, -1, -1, sizeof(::PublishAck)},
+  { 56, -1, -1, sizeof(::ResolveRequest)},
+  { 63, -1, -1, sizeof(::ResolveResponse)},
+  { 70, 78, -1, sizeof(::ReceiveRequest_StartOffsetsEntry_DoNotUse)},
+  { 80, 88, -1, sizeof(::ReceiveRequest_FiltersEntry_DoNotUse)},
+  { 90, -1, -1, sizeof(::ReceiveRequest)},
+  { 109, 117, -1, sizeof(::SubscribeRequest_StartOffsetsEntry_DoNotUse)},
+  { 119, 127, -1, sizeof(::SubscribeRequest_FiltersEntry_DoNotUse)},
+  { 129, -1, -1, sizeof(::SubscribeRequest)},
+  { 142, -1, -1, sizeof(::AckSettings)},
+  { 151, -1, -1, sizeof(::ReceiveResponse)},
+  { 160, -1, -1, sizeof(::StatsRequest)},
+  { 166, -1, -1, sizeof(::TopicStats)},
+  { 179, -1, -1, sizeof(::SubscriberStats)},
+  { 195, -1, -1, sizeof(::DispatcherThreadStats)},
+  { 205, -1, -1, sizeof(::LatencyHistogram_Bucket)},
+  { 213, -1, -1, sizeof(::LatencyHistogram)},
+  { 226, -1, -1, sizeof(::StatsResponse)},
+  { 236, -1, -1, sizeof(::DictionariesRequest)},
+  { 243, -1, -1, sizeof(::Dictionary)},
+  { 252, -1, -1, sizeof(::DictionariesResponse)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::_Message_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::_SendRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::_SendResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::_ReceiveRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::_ReceiveResponse_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::_Message_HeadersEntry_DoNotUse_default_instance_._instance,
+  &::_Message_default_instance_._instance,
+  &::_SendRequest_default_instance_._instance,
+  &::_SendResponse_default_instance_._instance,
+  &::_PublishAck_default_instance_._instance,
+  &::_ResolveRequest_default_instance_._instance,
+  &::_ResolveResponse_default_instance_._instance,
+  &::_ReceiveRequest_StartOffsetsEntry_DoNotUse_default_instance_._instance,
+  &::_ReceiveRequest_FiltersEntry_DoNotUse_default_instance_._instance,
+  &::_ReceiveRequest_default_instance_._instance,
+  &::_SubscribeRequest_StartOffsetsEntry_DoNotUse_default_instance_._instance,
+  &::_SubscribeRequest_FiltersEntry_DoNotUse_default_instance_._instance,
+  &::_SubscribeRequest_default_instance_._instance,
+  &::_AckSettings_default_instance_._instance,
+  &::_ReceiveResponse_default_instance_._instance,
+  &::_StatsRequest_default_instance_._instance,
+  &::_TopicStats_default_instance_._instance,
+  &::_SubscriberStats_default_instance_._instance,
+  &::_DispatcherThreadStats_default_instance_._instance,
+  &::_LatencyHistogram_Bucket_default_instance_._instance,
+  &::_LatencyHistogram_default_instance_._instance,
+  &::_StatsResponse_default_instance_._instance,
+  &::_DictionariesRequest_default_instance_._instance,
+  &::_Dictionary_default_instance_._instance,
+  &::_DictionariesResponse_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_broker_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\014broker.proto\")\n\007Message\022\r\n\005topic\030\001 \001(\t"
-  "\022\017\n\007content\030\002 \001(\t\")\n\013SendRequest\022\032\n\010mess"
-  "ages\030\001 \003(\0132\010.Message\"\016\n\014SendResponse\" \n\016"
-  "ReceiveRequest\022\016\n\006topics\030\001 \003(\t\",\n\017Receiv"
-  "eResponse\022\031\n\007message\030\001 \001(\0132\010.Message2h\n\r"
-  "MessageBroker\022%\n\004Send\022\014.SendRequest\032\r.Se"
-  "ndResponse\"\000\0220\n\007Receive\022\017.ReceiveRequest"
-  "\032\020.ReceiveResponse\"\0000\001b\006proto3"
+  "\n\014broker.proto\"\206\002\n\007Message\022\r\n\005topic\030\001 \001("
+  "\t\022\017\n\007content\030\002 \001(\014\022\020\n\010topic_id\030\003 \001(\004\022\023\n\006"
+  "offset\030\004 \001(\004H\000\210\001\001\022\013\n\003key\030\005 \001(\t\022\016\n\006retain"
+  "\030\006 \001(\010\022\020\n\010deflated\030\007 \001(\014\022\022\n\ndictionary\030\010"
+  " \001(\r\022\016\n\006origin\030\t \001(\t\022&\n\007headers\030\n \003(\0132\025."
+  "Message.HeadersEntry\032.\n\014HeadersEntry\022\013\n\003"
+  "key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001B\t\n\007_offset\""
+  ")\n\013SendRequest\022\032\n\010messages\030\001 \003(\0132\010.Messa"
+  "ge\"\016\n\014SendResponse\"\"\n\nPublishAck\022\024\n\014ackn"
+  "owledged\030\001 \001(\004\" \n\016ResolveRequest\022\016\n\006topi"
+  "cs\030\001 \003(\t\"$\n\017ResolveResponse\022\021\n\ttopic_ids"
+  "\030\001 \003(\004\"\264\006\n\016ReceiveRequest\022\016\n\006topics\030\001 \003("
+  "\t\022\021\n\tmax_batch\030\002 \001(\r\022\021\n\tlinger_us\030\003 \001(\r\022"
+  "\021\n\tmax_queue\030\004 \001(\r\0227\n\017overflow_policy\030\005 "
+  "\001(\0162\036.ReceiveRequest.OverflowPolicy\0228\n\rs"
+  "tart_offsets\030\006 \003(\0132!.ReceiveRequest.Star"
+  "tOffsetsEntry\022\r\n\005group\030\007 \001(\t\0227\n\017group_ba"
+  "lancing\030\010 \001(\0162\036.ReceiveRequest.GroupBala"
+  "ncing\0220\n\013compression\030\t \001(\0162\033.ReceiveRequ"
+  "est.Compression\022\027\n\017federation_peer\030\n \001(\t"
+  "\022.\n\nconflation\030\013 \001(\0162\032.ReceiveRequest.Co"
+  "nflation\022\020\n\010max_rate\030\014 \001(\r\022-\n\007filters\030\r "
+  "\003(\0132\034.ReceiveRequest.FiltersEntry\0323\n\021Sta"
+  "rtOffsetsEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001"
+  "(\004:\0028\001\032.\n\014FiltersEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005v"
+  "alue\030\002 \001(\t:\0028\001\"8\n\016GroupBalancing\022\017\n\013ROUN"
+  "D_ROBIN\020\000\022\025\n\021LEAST_OUTSTANDING\020\001\",\n\013Comp"
+  "ression\022\020\n\014UNCOMPRESSED\020\000\022\013\n\007DEFLATE\020\001\"P"
+  "\n\016OverflowPolicy\022\017\n\013DROP_OLDEST\020\000\022\017\n\013DRO"
+  "P_NEWEST\020\001\022\014\n\010CONFLATE\020\002\022\016\n\nDISCONNECT\020\003"
+  "\"C\n\nConflation\022\021\n\rNO_CONFLATION\020\000\022\014\n\010BY_"
+  "TOPIC\020\001\022\024\n\020BY_TOPIC_AND_KEY\020\002\"\330\002\n\020Subscr"
+  "ibeRequest\022\021\n\tsubscribe\030\001 \003(\t\022\023\n\013unsubsc"
+  "ribe\030\002 \003(\t\022:\n\rstart_offsets\030\003 \003(\0132#.Subs"
+  "cribeRequest.StartOffsetsEntry\022!\n\010delive"
+  "ry\030\004 \001(\0132\017.ReceiveRequest\022\032\n\004acks\030\005 \001(\0132"
+  "\014.AckSettings\022\013\n\003ack\030\006 \001(\004\022/\n\007filters\030\007 "
+  "\003(\0132\036.SubscribeRequest.FiltersEntry\0323\n\021S"
+  "tartOffsetsEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002"
+  " \001(\004:\0028\001\032.\n\014FiltersEntry\022\013\n\003key\030\001 \001(\t\022\r\n"
+  "\005value\030\002 \001(\t:\0028\001\"B\n\013AckSettings\022\016\n\006windo"
+  "w\030\001 \001(\r\022\022\n\ntimeout_ms\030\002 \001(\r\022\017\n\007session\030\003"
+  " \001(\t\"Z\n\017ReceiveResponse\022\031\n\007message\030\001 \001(\013"
+  "2\010.Message\022\032\n\010messages\030\002 \003(\0132\010.Message\022\020"
+  "\n\010sequence\030\003 \001(\004\"\016\n\014StatsRequest\"\232\001\n\nTop"
+  "icStats\022\r\n\005topic\030\001 \001(\t\022\020\n\010topic_id\030\002 \001(\004"
+  "\022\020\n\010messages\030\003 \001(\004\022\r\n\005bytes\030\004 \001(\004\022\033\n\023mes"
+  "sages_per_second\030\005 \001(\001\022\030\n\020bytes_per_seco"
+  "nd\030\006 \001(\001\022\023\n\013subscribers\030\007 \001(\004\"\316\001\n\017Subscr"
+  "iberStats\022\n\n\002id\030\001 \001(\004\022\016\n\006topics\030\002 \001(\004\022\020\n"
+  "\010patterns\030\003 \001(\004\022\016\n\006groups\030\004 \001(\004\022\023\n\013queue"
+  "_depth\030\005 \001(\004\022\026\n\016queue_capacity\030\006 \001(\004\022\027\n\017"
+  "max_queue_depth\030\007 \001(\004\022\017\n\007dropped\030\010 \001(\004\022\021"
+  "\n\tconflated\030\t \001(\004\022\023\n\013lightweight\030\n \001(\010\"e"
+  "\n\025DispatcherThreadStats\022\021\n\tthread_id\030\001 \001"
+  "(\t\022\016\n\006events\030\002 \001(\004\022\024\n\014busy_seconds\030\003 \001(\001"
+  "\022\023\n\013utilization\030\004 \001(\001\"\310\001\n\020LatencyHistogr"
+  "am\022\r\n\005count\030\001 \001(\004\022\016\n\006p50_ns\030\002 \001(\004\022\016\n\006p90"
+  "_ns\030\003 \001(\004\022\016\n\006p99_ns\030\004 \001(\004\022\017\n\007p999_ns\030\005 \001"
+  "(\004\022\016\n\006max_ns\030\006 \001(\004\022)\n\007buckets\030\007 \003(\0132\030.La"
+  "tencyHistogram.Bucket\032)\n\006Bucket\022\020\n\010up_to"
+  "_ns\030\001 \001(\004\022\r\n\005count\030\002 \001(\004\"\264\001\n\rStatsRespon"
+  "se\022\033\n\006topics\030\001 \003(\0132\013.TopicStats\022%\n\013subsc"
+  "ribers\030\002 \003(\0132\020.SubscriberStats\0222\n\022dispat"
+  "cher_threads\030\003 \003(\0132\026.DispatcherThreadSta"
+  "ts\022+\n\020publish_to_write\030\004 \001(\0132\021.LatencyHi"
+  "stogram\"(\n\023DictionariesRequest\022\021\n\ttopic_"
+  "ids\030\001 \003(\004\"8\n\nDictionary\022\020\n\010topic_id\030\001 \001("
+  "\004\022\n\n\002id\030\002 \001(\r\022\014\n\004data\030\003 \001(\014\"9\n\024Dictionar"
+  "iesResponse\022!\n\014dictionaries\030\001 \003(\0132\013.Dict"
+  "ionary2\345\002\n\rMessageBroker\022%\n\004Send\022\014.SendR"
+  "equest\032\r.SendResponse\"\000\0220\n\007Receive\022\017.Rec"
+  "eiveRequest\032\020.ReceiveResponse\"\0000\001\022.\n\007Res"
+  "olve\022\017.ResolveRequest\032\020.ResolveResponse\""
+  "\000\022*\n\007Publish\022\014.SendRequest\032\013.PublishAck\""
+  "\000(\0010\001\0226\n\tSubscribe\022\021.SubscribeRequest\032\020."
+  "ReceiveResponse\"\000(\0010\001\022(\n\005Stats\022\r.StatsRe"
+  "quest\032\016.StatsResponse\"\000\022=\n\014Dictionaries\022"
+  "\024.DictionariesRequest\032\025.DictionariesResp"
+  "onse\"\000b\006proto3"
   ;
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_broker_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_broker_2eproto = {
-  false, false, 310, descriptor_table_protodef_broker_2eproto, "broker.proto", 
-  &descriptor_table_broker_2eproto_once, nullptr, 0, 5,
-  schemas, file_default_instances, TableStruct_broker_2eproto::offsets,
-  file_level_metadata_broker_2eproto, file_level_enum_descriptors_broker_2eproto, file_level_service_descriptors_broker_2eproto,
-};
-PROTOBUF_ATTRIBUTE_WEAK ::PROTOBUF_NAMESPACE_ID::Metadata
-descriptor_table_broker_2eproto_metadata_getter(int index) {
-  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_broker_2eproto);
-  return descriptor_table_broker_2eproto.file_level_metadata[index];
+static ::_pbi::once_flag descriptor_table_broker_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_broker_2eproto = {
+    false, false, 3174, descriptor_table_protodef_broker_2eproto,
+    "broker.proto",
+    &descriptor_table_broker_2eproto_once, nullptr, 0, 25,
+    schemas, file_default_instances, TableStruct_broker_2eproto::offsets,
+    file_level_metadata_broker_2eproto, file_level_enum_descriptors_broker_2eproto,
+    file_level_service_descriptors_broker_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_broker_2eproto_getter() {
+  return &descriptor_table_broker_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_broker_2eproto(&descriptor_table_broker_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_broker_2eproto(&descriptor_table_broker_2eproto);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReceiveRequest_GroupBalancing_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_broker_2eproto);
+  return file_level_enum_descriptors_broker_2eproto[0];
+}
+bool ReceiveRequest_GroupBalancing_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReceiveRequest_GroupBalancing ReceiveRequest::ROUND_ROBIN;
+constexpr ReceiveRequest_GroupBalancing ReceiveRequest::LEAST_OUTSTANDING;
+constexpr ReceiveRequest_GroupBalancing ReceiveRequest::GroupBalancing_MIN;
+constexpr ReceiveRequest_GroupBalancing ReceiveRequest::GroupBalancing_MAX;
+constexpr int ReceiveRequest::GroupBalancing_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReceiveRequest_Compression_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_broker_2eproto);
+  return file_level_enum_descriptors_broker_2eproto[1];
+}
+bool ReceiveRequest_Compression_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReceiveRequest_Compression ReceiveRequest::UNCOMPRESSED;
+constexpr ReceiveRequest_Compression ReceiveRequest::DEFLATE;
+constexpr ReceiveRequest_Compression ReceiveRequest::Compression_MIN;
+constexpr ReceiveRequest_Compression ReceiveRequest::Compression_MAX;
+constexpr int ReceiveRequest::Compression_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReceiveRequest_OverflowPolicy_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_broker_2eproto);
+  return file_level_enum_descriptors_broker_2eproto[2];
+}
+bool ReceiveRequest_OverflowPolicy_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReceiveRequest_OverflowPolicy ReceiveRequest::DROP_OLDEST;
+constexpr ReceiveRequest_OverflowPolicy ReceiveRequest::DROP_NEWEST;
+constexpr ReceiveRequest_OverflowPolicy ReceiveRequest::CONFLATE;
+constexpr ReceiveRequest_OverflowPolicy ReceiveRequest::DISCONNECT;
+constexpr ReceiveRequest_OverflowPolicy ReceiveRequest::OverflowPolicy_MIN;
+constexpr ReceiveRequest_OverflowPolicy ReceiveRequest::OverflowPolicy_MAX;
+constexpr int ReceiveRequest::OverflowPolicy_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReceiveRequest_Conflation_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_broker_2eproto);
+  return file_level_enum_descriptors_broker_2eproto[3];
+}
+bool ReceiveRequest_Conflation_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr ReceiveRequest_Conflation ReceiveRequest::NO_CONFLATION;
+constexpr ReceiveRequest_Conflation ReceiveRequest::BY_TOPIC;
+constexpr ReceiveRequest_Conflation ReceiveRequest::BY_TOPIC_AND_KEY;
+constexpr ReceiveRequest_Conflation ReceiveRequest::Conflation_MIN;
+constexpr ReceiveRequest_Conflation ReceiveRequest::Conflation_MAX;
+constexpr int ReceiveRequest::Conflation_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
+// ===================================================================
+
+Message_HeadersEntry_DoNotUse::Message_HeadersEntry_DoNotUse() {}
+Message_HeadersEntry_DoNotUse::Message_HeadersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void Message_HeadersEntry_DoNotUse::MergeFrom(const Message_HeadersEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata Message_HeadersEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[0]);
+}
 
 // ===================================================================
 
 class Message::_Internal {
  public:
+  using HasBits = decltype(std::declval<Message>()._impl_._has_bits_);
+  static void set_has_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
-Message::Message(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Message::Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &Message::ArenaDtor);
+  }
   // @@protoc_insertion_point(arena_constructor:Message)
 }
 Message::Message(const Message& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Message* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_.headers_)*/{}
+    , decltype(_impl_.topic_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.deflated_){}
+    , decltype(_impl_.origin_){}
+    , decltype(_impl_.topic_id_){}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.retain_){}
+    , decltype(_impl_.dictionary_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  topic_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _this->_impl_.headers_.MergeFrom(from._impl_.headers_);
+  _impl_.topic_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_topic().empty()) {
-    topic_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_topic(), 
-      GetArena());
+    _this->_impl_.topic_.Set(from._internal_topic(), 
+      _this->GetArenaForAllocation());
   }
-  content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_content().empty()) {
-    content_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_content(), 
-      GetArena());
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.deflated_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.deflated_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_deflated().empty()) {
+    _this->_impl_.deflated_.Set(from._internal_deflated(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.origin_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.origin_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_origin().empty()) {
+    _this->_impl_.origin_.Set(from._internal_origin(), 
+      _this->GetArenaForAllocation());
   }
+  ::memcpy(&_impl_.topic_id_, &from._impl_.topic_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dictionary_) -
+    reinterpret_cast<char*>(&_impl_.topic_id_)) + sizeof(_impl_.dictionary_));
   // @@protoc_insertion_point(copy_constructor:Message)
 }
 
-void Message::SharedCtor() {
-topic_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Message::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_.headers_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.topic_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.deflated_){}
+    , decltype(_impl_.origin_){}
+    , decltype(_impl_.topic_id_){uint64_t{0u}}
+    , decltype(_impl_.offset_){uint64_t{0u}}
+    , decltype(_impl_.retain_){false}
+    , decltype(_impl_.dictionary_){0u}
+  };
+  _impl_.topic_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.deflated_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.deflated_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.origin_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.origin_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Message::~Message() {
   // @@protoc_insertion_point(destructor:Message)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Message::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  topic_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  content_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Message::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.headers_.Destruct();
+  _impl_.headers_.~MapField();
+  _impl_.topic_.Destroy();
+  _impl_.content_.Destroy();
+  _impl_.key_.Destroy();
+  _impl_.deflated_.Destroy();
+  _impl_.origin_.Destroy();
 }
 
 void Message::ArenaDtor(void* object) {
   Message* _this = reinterpret_cast< Message* >(object);
-  (void)_this;
-}
-void Message::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+  _this->_impl_.headers_.Destruct();
 }
 void Message::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Message::Clear() {
 // @@protoc_insertion_point(message_clear_start:Message)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  topic_.ClearToEmpty();
-  content_.ClearToEmpty();
+  _impl_.headers_.Clear();
+  _impl_.topic_.ClearToEmpty();
+  _impl_.content_.ClearToEmpty();
+  _impl_.key_.ClearToEmpty();
+  _impl_.deflated_.ClearToEmpty();
+  _impl_.origin_.ClearToEmpty();
+  _impl_.topic_id_ = uint64_t{0u};
+  _impl_.offset_ = uint64_t{0u};
+  ::memset(&_impl_.retain_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.dictionary_) -
+      reinterpret_cast<char*>(&_impl_.retain_)) + sizeof(_impl_.dictionary_));
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Message::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Message::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string topic = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_topic();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Message.topic"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "Message.topic"));
+        } else
+          goto handle_unusual;
         continue;
-      // string content = 2;
+      // bytes content = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_content();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "Message.content"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // uint64 topic_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.topic_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 offset = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_offset(&has_bits);
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string key = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Message.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool retain = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.retain_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes deflated = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_deflated();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 dictionary = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.dictionary_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string origin = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_origin();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "Message.origin"));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> headers = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.headers_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Message::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Message::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:Message)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string topic = 1;
-  if (this->topic().size() > 0) {
+  if (!this->_internal_topic().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_topic().data(), static_cast<int>(this->_internal_topic().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -283,18 +1233,94 @@ failure:
         1, this->_internal_topic(), target);
   }
 
-  // string content = 2;
-  if (this->content().size() > 0) {
+  // bytes content = 2;
+  if (!this->_internal_content().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_content(), target);
+  }
+
+  // uint64 topic_id = 3;
+  if (this->_internal_topic_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_topic_id(), target);
+  }
+
+  // optional uint64 offset = 4;
+  if (_internal_has_offset()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_offset(), target);
+  }
+
+  // string key = 5;
+  if (!this->_internal_key().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "Message.content");
+      "Message.key");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_content(), target);
+        5, this->_internal_key(), target);
+  }
+
+  // bool retain = 6;
+  if (this->_internal_retain() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_retain(), target);
+  }
+
+  // bytes deflated = 7;
+  if (!this->_internal_deflated().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        7, this->_internal_deflated(), target);
+  }
+
+  // uint32 dictionary = 8;
+  if (this->_internal_dictionary() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_dictionary(), target);
+  }
+
+  // string origin = 9;
+  if (!this->_internal_origin().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_origin().data(), static_cast<int>(this->_internal_origin().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "Message.origin");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_origin(), target);
+  }
+
+  // map<string, string> headers = 10;
+  if (!this->_internal_headers().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = Message_HeadersEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_headers();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "Message.HeadersEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "Message.HeadersEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(10, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(10, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:Message)
@@ -305,92 +1331,175 @@ size_t Message::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:Message)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // map<string, string> headers = 10;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_headers_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_headers().begin();
+      it != this->_internal_headers().end(); ++it) {
+    total_size += Message_HeadersEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
   // string topic = 1;
-  if (this->topic().size() > 0) {
+  if (!this->_internal_topic().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_topic());
   }
 
-  // string content = 2;
-  if (this->content().size() > 0) {
+  // bytes content = 2;
+  if (!this->_internal_content().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_content());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // string key = 5;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void Message::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:Message)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Message* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Message>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:Message)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:Message)
-    MergeFrom(*source);
+  // bytes deflated = 7;
+  if (!this->_internal_deflated().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_deflated());
   }
-}
 
-void Message::MergeFrom(const Message& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:Message)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // string origin = 9;
+  if (!this->_internal_origin().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_origin());
+  }
 
-  if (from.topic().size() > 0) {
-    _internal_set_topic(from._internal_topic());
+  // uint64 topic_id = 3;
+  if (this->_internal_topic_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_topic_id());
   }
-  if (from.content().size() > 0) {
-    _internal_set_content(from._internal_content());
+
+  // optional uint64 offset = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
   }
-}
 
-void Message::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:Message)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
+  // bool retain = 6;
+  if (this->_internal_retain() != 0) {
+    total_size += 1 + 1;
+  }
 
-void Message::CopyFrom(const Message& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:Message)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
+  // uint32 dictionary = 8;
+  if (this->_internal_dictionary() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dictionary());
+  }
 
-bool Message::IsInitialized() const {
-  return true;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Message::InternalSwap(Message* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  topic_.Swap(&other->topic_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  content_.Swap(&other->content_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Message::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Message::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Message::GetClassData() const { return &_class_data_; }
+
+
+void Message::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Message*>(&to_msg);
+  auto& from = static_cast<const Message&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Message)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.headers_.MergeFrom(from._impl_.headers_);
+  if (!from._internal_topic().empty()) {
+    _this->_internal_set_topic(from._internal_topic());
+  }
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
+  }
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_deflated().empty()) {
+    _this->_internal_set_deflated(from._internal_deflated());
+  }
+  if (!from._internal_origin().empty()) {
+    _this->_internal_set_origin(from._internal_origin());
+  }
+  if (from._internal_topic_id() != 0) {
+    _this->_internal_set_topic_id(from._internal_topic_id());
+  }
+  if (from._internal_has_offset()) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  if (from._internal_retain() != 0) {
+    _this->_internal_set_retain(from._internal_retain());
+  }
+  if (from._internal_dictionary() != 0) {
+    _this->_internal_set_dictionary(from._internal_dictionary());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Message::GetMetadata() const {
-  return GetMetadataStatic();
+void Message::CopyFrom(const Message& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Message)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Message::IsInitialized() const {
+  return true;
+}
+
+void Message::InternalSwap(Message* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.headers_.InternalSwap(&other->_impl_.headers_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.topic_, lhs_arena,
+      &other->_impl_.topic_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.deflated_, lhs_arena,
+      &other->_impl_.deflated_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.origin_, lhs_arena,
+      &other->_impl_.origin_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Message, _impl_.dictionary_)
+      + sizeof(Message::_impl_.dictionary_)
+      - PROTOBUF_FIELD_OFFSET(Message, _impl_.topic_id_)>(
+          reinterpret_cast<char*>(&_impl_.topic_id_),
+          reinterpret_cast<char*>(&other->_impl_.topic_id_));
 }
 
+::PROTOBUF_NAMESPACE_ID::Metadata Message::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[1]);
+}
 
 // ===================================================================
 
@@ -398,771 +1507,5186 @@ class SendRequest::_Internal {
  public:
 };
 
-SendRequest::SendRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  messages_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+SendRequest::SendRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:SendRequest)
 }
 SendRequest::SendRequest(const SendRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      messages_(from.messages_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SendRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:SendRequest)
 }
 
-void SendRequest::SharedCtor() {
+inline void SendRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SendRequest::~SendRequest() {
   // @@protoc_insertion_point(destructor:SendRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SendRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+}
+
+void SendRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SendRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:SendRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.messages_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SendRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .Message messages = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SendRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SendRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .Message messages = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SendRequest)
+  return target;
+}
+
+size_t SendRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SendRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Message messages = 1;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SendRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SendRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SendRequest::GetClassData() const { return &_class_data_; }
+
+
+void SendRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SendRequest*>(&to_msg);
+  auto& from = static_cast<const SendRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SendRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SendRequest::CopyFrom(const SendRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SendRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SendRequest::IsInitialized() const {
+  return true;
+}
+
+void SendRequest::InternalSwap(SendRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SendRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[2]);
+}
+
+// ===================================================================
+
+class SendResponse::_Internal {
+ public:
+};
+
+SendResponse::SendResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:SendResponse)
+}
+SendResponse::SendResponse(const SendResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  SendResponse* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:SendResponse)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SendResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SendResponse::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata SendResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[3]);
+}
+
+// ===================================================================
+
+class PublishAck::_Internal {
+ public:
+};
+
+PublishAck::PublishAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:PublishAck)
+}
+PublishAck::PublishAck(const PublishAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PublishAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.acknowledged_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.acknowledged_ = from._impl_.acknowledged_;
+  // @@protoc_insertion_point(copy_constructor:PublishAck)
+}
+
+inline void PublishAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.acknowledged_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PublishAck::~PublishAck() {
+  // @@protoc_insertion_point(destructor:PublishAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PublishAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PublishAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PublishAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:PublishAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.acknowledged_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PublishAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 acknowledged = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.acknowledged_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PublishAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:PublishAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 acknowledged = 1;
+  if (this->_internal_acknowledged() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_acknowledged(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:PublishAck)
+  return target;
+}
+
+size_t PublishAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:PublishAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 acknowledged = 1;
+  if (this->_internal_acknowledged() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_acknowledged());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PublishAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PublishAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PublishAck::GetClassData() const { return &_class_data_; }
+
+
+void PublishAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PublishAck*>(&to_msg);
+  auto& from = static_cast<const PublishAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:PublishAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_acknowledged() != 0) {
+    _this->_internal_set_acknowledged(from._internal_acknowledged());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PublishAck::CopyFrom(const PublishAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:PublishAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PublishAck::IsInitialized() const {
+  return true;
+}
+
+void PublishAck::InternalSwap(PublishAck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.acknowledged_, other->_impl_.acknowledged_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PublishAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[4]);
+}
+
+// ===================================================================
+
+class ResolveRequest::_Internal {
+ public:
+};
+
+ResolveRequest::ResolveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ResolveRequest)
+}
+ResolveRequest::ResolveRequest(const ResolveRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResolveRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topics_){from._impl_.topics_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ResolveRequest)
+}
+
+inline void ResolveRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topics_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ResolveRequest::~ResolveRequest() {
+  // @@protoc_insertion_point(destructor:ResolveRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResolveRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.topics_.~RepeatedPtrField();
+}
+
+void ResolveRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResolveRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:ResolveRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.topics_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResolveRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string topics = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_topics();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "ResolveRequest.topics"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResolveRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ResolveRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string topics = 1;
+  for (int i = 0, n = this->_internal_topics_size(); i < n; i++) {
+    const auto& s = this->_internal_topics(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ResolveRequest.topics");
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ResolveRequest)
+  return target;
+}
+
+size_t ResolveRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ResolveRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string topics = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.topics_.size());
+  for (int i = 0, n = _impl_.topics_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.topics_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResolveRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResolveRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResolveRequest::GetClassData() const { return &_class_data_; }
+
+
+void ResolveRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResolveRequest*>(&to_msg);
+  auto& from = static_cast<const ResolveRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ResolveRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.topics_.MergeFrom(from._impl_.topics_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResolveRequest::CopyFrom(const ResolveRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ResolveRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResolveRequest::IsInitialized() const {
+  return true;
+}
+
+void ResolveRequest::InternalSwap(ResolveRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.topics_.InternalSwap(&other->_impl_.topics_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResolveRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[5]);
+}
+
+// ===================================================================
+
+class ResolveResponse::_Internal {
+ public:
+};
+
+ResolveResponse::ResolveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ResolveResponse)
+}
+ResolveResponse::ResolveResponse(const ResolveResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResolveResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topic_ids_){from._impl_.topic_ids_}
+    , /*decltype(_impl_._topic_ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:ResolveResponse)
+}
+
+inline void ResolveResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topic_ids_){arena}
+    , /*decltype(_impl_._topic_ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ResolveResponse::~ResolveResponse() {
+  // @@protoc_insertion_point(destructor:ResolveResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResolveResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.topic_ids_.~RepeatedField();
+}
+
+void ResolveResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResolveResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:ResolveResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.topic_ids_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResolveResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint64 topic_ids = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_topic_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_topic_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResolveResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ResolveResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint64 topic_ids = 1;
+  {
+    int byte_size = _impl_._topic_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          1, _internal_topic_ids(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ResolveResponse)
+  return target;
+}
+
+size_t ResolveResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ResolveResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 topic_ids = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.topic_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._topic_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResolveResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResolveResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResolveResponse::GetClassData() const { return &_class_data_; }
+
+
+void ResolveResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResolveResponse*>(&to_msg);
+  auto& from = static_cast<const ResolveResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ResolveResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.topic_ids_.MergeFrom(from._impl_.topic_ids_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResolveResponse::CopyFrom(const ResolveResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ResolveResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResolveResponse::IsInitialized() const {
+  return true;
+}
+
+void ResolveResponse::InternalSwap(ResolveResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.topic_ids_.InternalSwap(&other->_impl_.topic_ids_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResolveResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[6]);
+}
+
+// ===================================================================
+
+ReceiveRequest_StartOffsetsEntry_DoNotUse::ReceiveRequest_StartOffsetsEntry_DoNotUse() {}
+ReceiveRequest_StartOffsetsEntry_DoNotUse::ReceiveRequest_StartOffsetsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void ReceiveRequest_StartOffsetsEntry_DoNotUse::MergeFrom(const ReceiveRequest_StartOffsetsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata ReceiveRequest_StartOffsetsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[7]);
+}
+
+// ===================================================================
+
+ReceiveRequest_FiltersEntry_DoNotUse::ReceiveRequest_FiltersEntry_DoNotUse() {}
+ReceiveRequest_FiltersEntry_DoNotUse::ReceiveRequest_FiltersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void ReceiveRequest_FiltersEntry_DoNotUse::MergeFrom(const ReceiveRequest_FiltersEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata ReceiveRequest_FiltersEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[8]);
+}
+
+// ===================================================================
+
+class ReceiveRequest::_Internal {
+ public:
+};
+
+ReceiveRequest::ReceiveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &ReceiveRequest::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:ReceiveRequest)
+}
+ReceiveRequest::ReceiveRequest(const ReceiveRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReceiveRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topics_){from._impl_.topics_}
+    , /*decltype(_impl_.start_offsets_)*/{}
+    , /*decltype(_impl_.filters_)*/{}
+    , decltype(_impl_.group_){}
+    , decltype(_impl_.federation_peer_){}
+    , decltype(_impl_.max_batch_){}
+    , decltype(_impl_.linger_us_){}
+    , decltype(_impl_.max_queue_){}
+    , decltype(_impl_.overflow_policy_){}
+    , decltype(_impl_.group_balancing_){}
+    , decltype(_impl_.compression_){}
+    , decltype(_impl_.conflation_){}
+    , decltype(_impl_.max_rate_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.start_offsets_.MergeFrom(from._impl_.start_offsets_);
+  _this->_impl_.filters_.MergeFrom(from._impl_.filters_);
+  _impl_.group_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.group_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_group().empty()) {
+    _this->_impl_.group_.Set(from._internal_group(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.federation_peer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.federation_peer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_federation_peer().empty()) {
+    _this->_impl_.federation_peer_.Set(from._internal_federation_peer(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.max_batch_, &from._impl_.max_batch_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_rate_) -
+    reinterpret_cast<char*>(&_impl_.max_batch_)) + sizeof(_impl_.max_rate_));
+  // @@protoc_insertion_point(copy_constructor:ReceiveRequest)
+}
+
+inline void ReceiveRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topics_){arena}
+    , /*decltype(_impl_.start_offsets_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.filters_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.group_){}
+    , decltype(_impl_.federation_peer_){}
+    , decltype(_impl_.max_batch_){0u}
+    , decltype(_impl_.linger_us_){0u}
+    , decltype(_impl_.max_queue_){0u}
+    , decltype(_impl_.overflow_policy_){0}
+    , decltype(_impl_.group_balancing_){0}
+    , decltype(_impl_.compression_){0}
+    , decltype(_impl_.conflation_){0}
+    , decltype(_impl_.max_rate_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.group_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.group_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.federation_peer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.federation_peer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReceiveRequest::~ReceiveRequest() {
+  // @@protoc_insertion_point(destructor:ReceiveRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReceiveRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.topics_.~RepeatedPtrField();
+  _impl_.start_offsets_.Destruct();
+  _impl_.start_offsets_.~MapField();
+  _impl_.filters_.Destruct();
+  _impl_.filters_.~MapField();
+  _impl_.group_.Destroy();
+  _impl_.federation_peer_.Destroy();
+}
+
+void ReceiveRequest::ArenaDtor(void* object) {
+  ReceiveRequest* _this = reinterpret_cast< ReceiveRequest* >(object);
+  _this->_impl_.start_offsets_.Destruct();
+  _this->_impl_.filters_.Destruct();
+}
+void ReceiveRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReceiveRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:ReceiveRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.topics_.Clear();
+  _impl_.start_offsets_.Clear();
+  _impl_.filters_.Clear();
+  _impl_.group_.ClearToEmpty();
+  _impl_.federation_peer_.ClearToEmpty();
+  ::memset(&_impl_.max_batch_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_rate_) -
+      reinterpret_cast<char*>(&_impl_.max_batch_)) + sizeof(_impl_.max_rate_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReceiveRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string topics = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_topics();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "ReceiveRequest.topics"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max_batch = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.max_batch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 linger_us = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.linger_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max_queue = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.max_queue_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .ReceiveRequest.OverflowPolicy overflow_policy = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_overflow_policy(static_cast<::ReceiveRequest_OverflowPolicy>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, uint64> start_offsets = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.start_offsets_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string group = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_group();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ReceiveRequest.group"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .ReceiveRequest.GroupBalancing group_balancing = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_group_balancing(static_cast<::ReceiveRequest_GroupBalancing>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .ReceiveRequest.Compression compression = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::ReceiveRequest_Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string federation_peer = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_federation_peer();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "ReceiveRequest.federation_peer"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .ReceiveRequest.Conflation conflation = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_conflation(static_cast<::ReceiveRequest_Conflation>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 max_rate = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.max_rate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> filters = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.filters_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<106>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReceiveRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ReceiveRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string topics = 1;
+  for (int i = 0, n = this->_internal_topics_size(); i < n; i++) {
+    const auto& s = this->_internal_topics(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ReceiveRequest.topics");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // uint32 max_batch = 2;
+  if (this->_internal_max_batch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_max_batch(), target);
+  }
+
+  // uint32 linger_us = 3;
+  if (this->_internal_linger_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_linger_us(), target);
+  }
+
+  // uint32 max_queue = 4;
+  if (this->_internal_max_queue() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_max_queue(), target);
+  }
+
+  // .ReceiveRequest.OverflowPolicy overflow_policy = 5;
+  if (this->_internal_overflow_policy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_overflow_policy(), target);
+  }
+
+  // map<string, uint64> start_offsets = 6;
+  if (!this->_internal_start_offsets().empty()) {
+    using MapType = ::_pb::Map<std::string, uint64_t>;
+    using WireHelper = ReceiveRequest_StartOffsetsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_start_offsets();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "ReceiveRequest.StartOffsetsEntry.key");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(6, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(6, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // string group = 7;
+  if (!this->_internal_group().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_group().data(), static_cast<int>(this->_internal_group().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ReceiveRequest.group");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_group(), target);
+  }
+
+  // .ReceiveRequest.GroupBalancing group_balancing = 8;
+  if (this->_internal_group_balancing() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_group_balancing(), target);
+  }
+
+  // .ReceiveRequest.Compression compression = 9;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_compression(), target);
+  }
+
+  // string federation_peer = 10;
+  if (!this->_internal_federation_peer().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_federation_peer().data(), static_cast<int>(this->_internal_federation_peer().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "ReceiveRequest.federation_peer");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_federation_peer(), target);
+  }
+
+  // .ReceiveRequest.Conflation conflation = 11;
+  if (this->_internal_conflation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      11, this->_internal_conflation(), target);
+  }
+
+  // uint32 max_rate = 12;
+  if (this->_internal_max_rate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(12, this->_internal_max_rate(), target);
+  }
+
+  // map<string, string> filters = 13;
+  if (!this->_internal_filters().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = ReceiveRequest_FiltersEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_filters();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "ReceiveRequest.FiltersEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "ReceiveRequest.FiltersEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(13, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(13, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ReceiveRequest)
+  return target;
+}
+
+size_t ReceiveRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ReceiveRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string topics = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.topics_.size());
+  for (int i = 0, n = _impl_.topics_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.topics_.Get(i));
+  }
+
+  // map<string, uint64> start_offsets = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_start_offsets_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >::const_iterator
+      it = this->_internal_start_offsets().begin();
+      it != this->_internal_start_offsets().end(); ++it) {
+    total_size += ReceiveRequest_StartOffsetsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, string> filters = 13;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_filters_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_filters().begin();
+      it != this->_internal_filters().end(); ++it) {
+    total_size += ReceiveRequest_FiltersEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // string group = 7;
+  if (!this->_internal_group().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_group());
+  }
+
+  // string federation_peer = 10;
+  if (!this->_internal_federation_peer().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_federation_peer());
+  }
+
+  // uint32 max_batch = 2;
+  if (this->_internal_max_batch() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_batch());
+  }
+
+  // uint32 linger_us = 3;
+  if (this->_internal_linger_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_linger_us());
+  }
+
+  // uint32 max_queue = 4;
+  if (this->_internal_max_queue() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_queue());
+  }
+
+  // .ReceiveRequest.OverflowPolicy overflow_policy = 5;
+  if (this->_internal_overflow_policy() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_overflow_policy());
+  }
+
+  // .ReceiveRequest.GroupBalancing group_balancing = 8;
+  if (this->_internal_group_balancing() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_group_balancing());
+  }
+
+  // .ReceiveRequest.Compression compression = 9;
+  if (this->_internal_compression() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
+  }
+
+  // .ReceiveRequest.Conflation conflation = 11;
+  if (this->_internal_conflation() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_conflation());
+  }
+
+  // uint32 max_rate = 12;
+  if (this->_internal_max_rate() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_rate());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReceiveRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReceiveRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReceiveRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReceiveRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReceiveRequest*>(&to_msg);
+  auto& from = static_cast<const ReceiveRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ReceiveRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.topics_.MergeFrom(from._impl_.topics_);
+  _this->_impl_.start_offsets_.MergeFrom(from._impl_.start_offsets_);
+  _this->_impl_.filters_.MergeFrom(from._impl_.filters_);
+  if (!from._internal_group().empty()) {
+    _this->_internal_set_group(from._internal_group());
+  }
+  if (!from._internal_federation_peer().empty()) {
+    _this->_internal_set_federation_peer(from._internal_federation_peer());
+  }
+  if (from._internal_max_batch() != 0) {
+    _this->_internal_set_max_batch(from._internal_max_batch());
+  }
+  if (from._internal_linger_us() != 0) {
+    _this->_internal_set_linger_us(from._internal_linger_us());
+  }
+  if (from._internal_max_queue() != 0) {
+    _this->_internal_set_max_queue(from._internal_max_queue());
+  }
+  if (from._internal_overflow_policy() != 0) {
+    _this->_internal_set_overflow_policy(from._internal_overflow_policy());
+  }
+  if (from._internal_group_balancing() != 0) {
+    _this->_internal_set_group_balancing(from._internal_group_balancing());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  if (from._internal_conflation() != 0) {
+    _this->_internal_set_conflation(from._internal_conflation());
+  }
+  if (from._internal_max_rate() != 0) {
+    _this->_internal_set_max_rate(from._internal_max_rate());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReceiveRequest::CopyFrom(const ReceiveRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ReceiveRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReceiveRequest::IsInitialized() const {
+  return true;
+}
+
+void ReceiveRequest::InternalSwap(ReceiveRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.topics_.InternalSwap(&other->_impl_.topics_);
+  _impl_.start_offsets_.InternalSwap(&other->_impl_.start_offsets_);
+  _impl_.filters_.InternalSwap(&other->_impl_.filters_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.group_, lhs_arena,
+      &other->_impl_.group_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.federation_peer_, lhs_arena,
+      &other->_impl_.federation_peer_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReceiveRequest, _impl_.max_rate_)
+      + sizeof(ReceiveRequest::_impl_.max_rate_)
+      - PROTOBUF_FIELD_OFFSET(ReceiveRequest, _impl_.max_batch_)>(
+          reinterpret_cast<char*>(&_impl_.max_batch_),
+          reinterpret_cast<char*>(&other->_impl_.max_batch_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReceiveRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[9]);
+}
+
+// ===================================================================
+
+SubscribeRequest_StartOffsetsEntry_DoNotUse::SubscribeRequest_StartOffsetsEntry_DoNotUse() {}
+SubscribeRequest_StartOffsetsEntry_DoNotUse::SubscribeRequest_StartOffsetsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void SubscribeRequest_StartOffsetsEntry_DoNotUse::MergeFrom(const SubscribeRequest_StartOffsetsEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata SubscribeRequest_StartOffsetsEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[10]);
+}
+
+// ===================================================================
+
+SubscribeRequest_FiltersEntry_DoNotUse::SubscribeRequest_FiltersEntry_DoNotUse() {}
+SubscribeRequest_FiltersEntry_DoNotUse::SubscribeRequest_FiltersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void SubscribeRequest_FiltersEntry_DoNotUse::MergeFrom(const SubscribeRequest_FiltersEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata SubscribeRequest_FiltersEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[11]);
+}
+
+// ===================================================================
+
+class SubscribeRequest::_Internal {
+ public:
+  static const ::ReceiveRequest& delivery(const SubscribeRequest* msg);
+  static const ::AckSettings& acks(const SubscribeRequest* msg);
+};
+
+const ::ReceiveRequest&
+SubscribeRequest::_Internal::delivery(const SubscribeRequest* msg) {
+  return *msg->_impl_.delivery_;
+}
+const ::AckSettings&
+SubscribeRequest::_Internal::acks(const SubscribeRequest* msg) {
+  return *msg->_impl_.acks_;
+}
+SubscribeRequest::SubscribeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &SubscribeRequest::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:SubscribeRequest)
+}
+SubscribeRequest::SubscribeRequest(const SubscribeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SubscribeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.subscribe_){from._impl_.subscribe_}
+    , decltype(_impl_.unsubscribe_){from._impl_.unsubscribe_}
+    , /*decltype(_impl_.start_offsets_)*/{}
+    , /*decltype(_impl_.filters_)*/{}
+    , decltype(_impl_.delivery_){nullptr}
+    , decltype(_impl_.acks_){nullptr}
+    , decltype(_impl_.ack_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.start_offsets_.MergeFrom(from._impl_.start_offsets_);
+  _this->_impl_.filters_.MergeFrom(from._impl_.filters_);
+  if (from._internal_has_delivery()) {
+    _this->_impl_.delivery_ = new ::ReceiveRequest(*from._impl_.delivery_);
+  }
+  if (from._internal_has_acks()) {
+    _this->_impl_.acks_ = new ::AckSettings(*from._impl_.acks_);
+  }
+  _this->_impl_.ack_ = from._impl_.ack_;
+  // @@protoc_insertion_point(copy_constructor:SubscribeRequest)
+}
+
+inline void SubscribeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.subscribe_){arena}
+    , decltype(_impl_.unsubscribe_){arena}
+    , /*decltype(_impl_.start_offsets_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.filters_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.delivery_){nullptr}
+    , decltype(_impl_.acks_){nullptr}
+    , decltype(_impl_.ack_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SubscribeRequest::~SubscribeRequest() {
+  // @@protoc_insertion_point(destructor:SubscribeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubscribeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.subscribe_.~RepeatedPtrField();
+  _impl_.unsubscribe_.~RepeatedPtrField();
+  _impl_.start_offsets_.Destruct();
+  _impl_.start_offsets_.~MapField();
+  _impl_.filters_.Destruct();
+  _impl_.filters_.~MapField();
+  if (this != internal_default_instance()) delete _impl_.delivery_;
+  if (this != internal_default_instance()) delete _impl_.acks_;
+}
+
+void SubscribeRequest::ArenaDtor(void* object) {
+  SubscribeRequest* _this = reinterpret_cast< SubscribeRequest* >(object);
+  _this->_impl_.start_offsets_.Destruct();
+  _this->_impl_.filters_.Destruct();
+}
+void SubscribeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubscribeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:SubscribeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.subscribe_.Clear();
+  _impl_.unsubscribe_.Clear();
+  _impl_.start_offsets_.Clear();
+  _impl_.filters_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.delivery_ != nullptr) {
+    delete _impl_.delivery_;
+  }
+  _impl_.delivery_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.acks_ != nullptr) {
+    delete _impl_.acks_;
+  }
+  _impl_.acks_ = nullptr;
+  _impl_.ack_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SubscribeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string subscribe = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_subscribe();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "SubscribeRequest.subscribe"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string unsubscribe = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_unsubscribe();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "SubscribeRequest.unsubscribe"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, uint64> start_offsets = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.start_offsets_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .ReceiveRequest delivery = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_delivery(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .AckSettings acks = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_acks(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 ack = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> filters = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.filters_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubscribeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SubscribeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string subscribe = 1;
+  for (int i = 0, n = this->_internal_subscribe_size(); i < n; i++) {
+    const auto& s = this->_internal_subscribe(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SubscribeRequest.subscribe");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // repeated string unsubscribe = 2;
+  for (int i = 0, n = this->_internal_unsubscribe_size(); i < n; i++) {
+    const auto& s = this->_internal_unsubscribe(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "SubscribeRequest.unsubscribe");
+    target = stream->WriteString(2, s, target);
+  }
+
+  // map<string, uint64> start_offsets = 3;
+  if (!this->_internal_start_offsets().empty()) {
+    using MapType = ::_pb::Map<std::string, uint64_t>;
+    using WireHelper = SubscribeRequest_StartOffsetsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_start_offsets();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "SubscribeRequest.StartOffsetsEntry.key");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // .ReceiveRequest delivery = 4;
+  if (this->_internal_has_delivery()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::delivery(this),
+        _Internal::delivery(this).GetCachedSize(), target, stream);
+  }
+
+  // .AckSettings acks = 5;
+  if (this->_internal_has_acks()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::acks(this),
+        _Internal::acks(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 ack = 6;
+  if (this->_internal_ack() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_ack(), target);
+  }
+
+  // map<string, string> filters = 7;
+  if (!this->_internal_filters().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = SubscribeRequest_FiltersEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_filters();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "SubscribeRequest.FiltersEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "SubscribeRequest.FiltersEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(7, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(7, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SubscribeRequest)
+  return target;
+}
+
+size_t SubscribeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SubscribeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string subscribe = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.subscribe_.size());
+  for (int i = 0, n = _impl_.subscribe_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.subscribe_.Get(i));
+  }
+
+  // repeated string unsubscribe = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.unsubscribe_.size());
+  for (int i = 0, n = _impl_.unsubscribe_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.unsubscribe_.Get(i));
+  }
+
+  // map<string, uint64> start_offsets = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_start_offsets_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >::const_iterator
+      it = this->_internal_start_offsets().begin();
+      it != this->_internal_start_offsets().end(); ++it) {
+    total_size += SubscribeRequest_StartOffsetsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, string> filters = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_filters_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_filters().begin();
+      it != this->_internal_filters().end(); ++it) {
+    total_size += SubscribeRequest_FiltersEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // .ReceiveRequest delivery = 4;
+  if (this->_internal_has_delivery()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.delivery_);
+  }
+
+  // .AckSettings acks = 5;
+  if (this->_internal_has_acks()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.acks_);
+  }
+
+  // uint64 ack = 6;
+  if (this->_internal_ack() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ack());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubscribeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SubscribeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubscribeRequest::GetClassData() const { return &_class_data_; }
+
+
+void SubscribeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SubscribeRequest*>(&to_msg);
+  auto& from = static_cast<const SubscribeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SubscribeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.subscribe_.MergeFrom(from._impl_.subscribe_);
+  _this->_impl_.unsubscribe_.MergeFrom(from._impl_.unsubscribe_);
+  _this->_impl_.start_offsets_.MergeFrom(from._impl_.start_offsets_);
+  _this->_impl_.filters_.MergeFrom(from._impl_.filters_);
+  if (from._internal_has_delivery()) {
+    _this->_internal_mutable_delivery()->::ReceiveRequest::MergeFrom(
+        from._internal_delivery());
+  }
+  if (from._internal_has_acks()) {
+    _this->_internal_mutable_acks()->::AckSettings::MergeFrom(
+        from._internal_acks());
+  }
+  if (from._internal_ack() != 0) {
+    _this->_internal_set_ack(from._internal_ack());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SubscribeRequest::CopyFrom(const SubscribeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SubscribeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubscribeRequest::IsInitialized() const {
+  return true;
+}
+
+void SubscribeRequest::InternalSwap(SubscribeRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.subscribe_.InternalSwap(&other->_impl_.subscribe_);
+  _impl_.unsubscribe_.InternalSwap(&other->_impl_.unsubscribe_);
+  _impl_.start_offsets_.InternalSwap(&other->_impl_.start_offsets_);
+  _impl_.filters_.InternalSwap(&other->_impl_.filters_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubscribeRequest, _impl_.ack_)
+      + sizeof(SubscribeRequest::_impl_.ack_)
+      - PROTOBUF_FIELD_OFFSET(SubscribeRequest, _impl_.delivery_)>(
+          reinterpret_cast<char*>(&_impl_.delivery_),
+          reinterpret_cast<char*>(&other->_impl_.delivery_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SubscribeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[12]);
+}
+
+// ===================================================================
+
+class AckSettings::_Internal {
+ public:
+};
+
+AckSettings::AckSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:AckSettings)
+}
+AckSettings::AckSettings(const AckSettings& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AckSettings* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_){}
+    , decltype(_impl_.window_){}
+    , decltype(_impl_.timeout_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.session_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_session().empty()) {
+    _this->_impl_.session_.Set(from._internal_session(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.window_, &from._impl_.window_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timeout_ms_) -
+    reinterpret_cast<char*>(&_impl_.window_)) + sizeof(_impl_.timeout_ms_));
+  // @@protoc_insertion_point(copy_constructor:AckSettings)
+}
+
+inline void AckSettings::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.session_){}
+    , decltype(_impl_.window_){0u}
+    , decltype(_impl_.timeout_ms_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.session_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+AckSettings::~AckSettings() {
+  // @@protoc_insertion_point(destructor:AckSettings)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AckSettings::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.session_.Destroy();
+}
+
+void AckSettings::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AckSettings::Clear() {
+// @@protoc_insertion_point(message_clear_start:AckSettings)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.session_.ClearToEmpty();
+  ::memset(&_impl_.window_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.timeout_ms_) -
+      reinterpret_cast<char*>(&_impl_.window_)) + sizeof(_impl_.timeout_ms_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AckSettings::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 window = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.window_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 timeout_ms = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.timeout_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string session = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_session();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "AckSettings.session"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AckSettings::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:AckSettings)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 window = 1;
+  if (this->_internal_window() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_window(), target);
+  }
+
+  // uint32 timeout_ms = 2;
+  if (this->_internal_timeout_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_timeout_ms(), target);
+  }
+
+  // string session = 3;
+  if (!this->_internal_session().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session().data(), static_cast<int>(this->_internal_session().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "AckSettings.session");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_session(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:AckSettings)
+  return target;
+}
+
+size_t AckSettings::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:AckSettings)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string session = 3;
+  if (!this->_internal_session().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_session());
+  }
+
+  // uint32 window = 1;
+  if (this->_internal_window() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_window());
+  }
+
+  // uint32 timeout_ms = 2;
+  if (this->_internal_timeout_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_timeout_ms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AckSettings::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AckSettings::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AckSettings::GetClassData() const { return &_class_data_; }
+
+
+void AckSettings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AckSettings*>(&to_msg);
+  auto& from = static_cast<const AckSettings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:AckSettings)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_session().empty()) {
+    _this->_internal_set_session(from._internal_session());
+  }
+  if (from._internal_window() != 0) {
+    _this->_internal_set_window(from._internal_window());
+  }
+  if (from._internal_timeout_ms() != 0) {
+    _this->_internal_set_timeout_ms(from._internal_timeout_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AckSettings::CopyFrom(const AckSettings& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:AckSettings)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AckSettings::IsInitialized() const {
+  return true;
+}
+
+void AckSettings::InternalSwap(AckSettings* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_, lhs_arena,
+      &other->_impl_.session_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AckSettings, _impl_.timeout_ms_)
+      + sizeof(AckSettings::_impl_.timeout_ms_)
+      - PROTOBUF_FIELD_OFFSET(AckSettings, _impl_.window_)>(
+          reinterpret_cast<char*>(&_impl_.window_),
+          reinterpret_cast<char*>(&other->_impl_.window_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AckSettings::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[13]);
+}
+
+// ===================================================================
+
+class ReceiveResponse::_Internal {
+ public:
+  static const ::Message& message(const ReceiveResponse* msg);
+};
+
+const ::Message&
+ReceiveResponse::_Internal::message(const ReceiveResponse* msg) {
+  return *msg->_impl_.message_;
+}
+ReceiveResponse::ReceiveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:ReceiveResponse)
+}
+ReceiveResponse::ReceiveResponse(const ReceiveResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReceiveResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::Message(*from._impl_.message_);
+  }
+  _this->_impl_.sequence_ = from._impl_.sequence_;
+  // @@protoc_insertion_point(copy_constructor:ReceiveResponse)
+}
+
+inline void ReceiveResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.sequence_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReceiveResponse::~ReceiveResponse() {
+  // @@protoc_insertion_point(destructor:ReceiveResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReceiveResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.message_;
+}
+
+void ReceiveResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReceiveResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:ReceiveResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.messages_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+  _impl_.sequence_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReceiveResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .Message message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .Message messages = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sequence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReceiveResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:ReceiveResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .Message message = 1;
+  if (this->_internal_has_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .Message messages = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 sequence = 3;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_sequence(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:ReceiveResponse)
+  return target;
+}
+
+size_t ReceiveResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:ReceiveResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .Message messages = 2;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .Message message = 1;
+  if (this->_internal_has_message()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.message_);
+  }
+
+  // uint64 sequence = 3;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sequence());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReceiveResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReceiveResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReceiveResponse::GetClassData() const { return &_class_data_; }
+
+
+void ReceiveResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReceiveResponse*>(&to_msg);
+  auto& from = static_cast<const ReceiveResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:ReceiveResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  if (from._internal_has_message()) {
+    _this->_internal_mutable_message()->::Message::MergeFrom(
+        from._internal_message());
+  }
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReceiveResponse::CopyFrom(const ReceiveResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:ReceiveResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReceiveResponse::IsInitialized() const {
+  return true;
+}
+
+void ReceiveResponse::InternalSwap(ReceiveResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReceiveResponse, _impl_.sequence_)
+      + sizeof(ReceiveResponse::_impl_.sequence_)
+      - PROTOBUF_FIELD_OFFSET(ReceiveResponse, _impl_.message_)>(
+          reinterpret_cast<char*>(&_impl_.message_),
+          reinterpret_cast<char*>(&other->_impl_.message_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReceiveResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[14]);
+}
+
+// ===================================================================
+
+class StatsRequest::_Internal {
+ public:
+};
+
+StatsRequest::StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:StatsRequest)
+}
+StatsRequest::StatsRequest(const StatsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  StatsRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:StatsRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[15]);
+}
+
+// ===================================================================
+
+class TopicStats::_Internal {
+ public:
+};
+
+TopicStats::TopicStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TopicStats)
+}
+TopicStats::TopicStats(const TopicStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TopicStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topic_){}
+    , decltype(_impl_.topic_id_){}
+    , decltype(_impl_.messages_){}
+    , decltype(_impl_.bytes_){}
+    , decltype(_impl_.messages_per_second_){}
+    , decltype(_impl_.bytes_per_second_){}
+    , decltype(_impl_.subscribers_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.topic_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_topic().empty()) {
+    _this->_impl_.topic_.Set(from._internal_topic(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.topic_id_, &from._impl_.topic_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.subscribers_) -
+    reinterpret_cast<char*>(&_impl_.topic_id_)) + sizeof(_impl_.subscribers_));
+  // @@protoc_insertion_point(copy_constructor:TopicStats)
+}
+
+inline void TopicStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topic_){}
+    , decltype(_impl_.topic_id_){uint64_t{0u}}
+    , decltype(_impl_.messages_){uint64_t{0u}}
+    , decltype(_impl_.bytes_){uint64_t{0u}}
+    , decltype(_impl_.messages_per_second_){0}
+    , decltype(_impl_.bytes_per_second_){0}
+    , decltype(_impl_.subscribers_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.topic_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TopicStats::~TopicStats() {
+  // @@protoc_insertion_point(destructor:TopicStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TopicStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.topic_.Destroy();
+}
+
+void TopicStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TopicStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:TopicStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.topic_.ClearToEmpty();
+  ::memset(&_impl_.topic_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.subscribers_) -
+      reinterpret_cast<char*>(&_impl_.topic_id_)) + sizeof(_impl_.subscribers_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TopicStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string topic = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_topic();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TopicStats.topic"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 topic_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.topic_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 messages = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.messages_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double messages_per_second = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.messages_per_second_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double bytes_per_second = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.bytes_per_second_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 subscribers = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.subscribers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TopicStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TopicStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string topic = 1;
+  if (!this->_internal_topic().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_topic().data(), static_cast<int>(this->_internal_topic().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TopicStats.topic");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_topic(), target);
+  }
+
+  // uint64 topic_id = 2;
+  if (this->_internal_topic_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_topic_id(), target);
+  }
+
+  // uint64 messages = 3;
+  if (this->_internal_messages() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_messages(), target);
+  }
+
+  // uint64 bytes = 4;
+  if (this->_internal_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_bytes(), target);
+  }
+
+  // double messages_per_second = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_messages_per_second = this->_internal_messages_per_second();
+  uint64_t raw_messages_per_second;
+  memcpy(&raw_messages_per_second, &tmp_messages_per_second, sizeof(tmp_messages_per_second));
+  if (raw_messages_per_second != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_messages_per_second(), target);
+  }
+
+  // double bytes_per_second = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bytes_per_second = this->_internal_bytes_per_second();
+  uint64_t raw_bytes_per_second;
+  memcpy(&raw_bytes_per_second, &tmp_bytes_per_second, sizeof(tmp_bytes_per_second));
+  if (raw_bytes_per_second != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_bytes_per_second(), target);
+  }
+
+  // uint64 subscribers = 7;
+  if (this->_internal_subscribers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_subscribers(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TopicStats)
+  return target;
+}
+
+size_t TopicStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TopicStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string topic = 1;
+  if (!this->_internal_topic().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_topic());
+  }
+
+  // uint64 topic_id = 2;
+  if (this->_internal_topic_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_topic_id());
+  }
+
+  // uint64 messages = 3;
+  if (this->_internal_messages() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_messages());
+  }
+
+  // uint64 bytes = 4;
+  if (this->_internal_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes());
+  }
+
+  // double messages_per_second = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_messages_per_second = this->_internal_messages_per_second();
+  uint64_t raw_messages_per_second;
+  memcpy(&raw_messages_per_second, &tmp_messages_per_second, sizeof(tmp_messages_per_second));
+  if (raw_messages_per_second != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double bytes_per_second = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bytes_per_second = this->_internal_bytes_per_second();
+  uint64_t raw_bytes_per_second;
+  memcpy(&raw_bytes_per_second, &tmp_bytes_per_second, sizeof(tmp_bytes_per_second));
+  if (raw_bytes_per_second != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 subscribers = 7;
+  if (this->_internal_subscribers() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_subscribers());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TopicStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TopicStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TopicStats::GetClassData() const { return &_class_data_; }
+
+
+void TopicStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TopicStats*>(&to_msg);
+  auto& from = static_cast<const TopicStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TopicStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_topic().empty()) {
+    _this->_internal_set_topic(from._internal_topic());
+  }
+  if (from._internal_topic_id() != 0) {
+    _this->_internal_set_topic_id(from._internal_topic_id());
+  }
+  if (from._internal_messages() != 0) {
+    _this->_internal_set_messages(from._internal_messages());
+  }
+  if (from._internal_bytes() != 0) {
+    _this->_internal_set_bytes(from._internal_bytes());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_messages_per_second = from._internal_messages_per_second();
+  uint64_t raw_messages_per_second;
+  memcpy(&raw_messages_per_second, &tmp_messages_per_second, sizeof(tmp_messages_per_second));
+  if (raw_messages_per_second != 0) {
+    _this->_internal_set_messages_per_second(from._internal_messages_per_second());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bytes_per_second = from._internal_bytes_per_second();
+  uint64_t raw_bytes_per_second;
+  memcpy(&raw_bytes_per_second, &tmp_bytes_per_second, sizeof(tmp_bytes_per_second));
+  if (raw_bytes_per_second != 0) {
+    _this->_internal_set_bytes_per_second(from._internal_bytes_per_second());
+  }
+  if (from._internal_subscribers() != 0) {
+    _this->_internal_set_subscribers(from._internal_subscribers());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TopicStats::CopyFrom(const TopicStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TopicStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TopicStats::IsInitialized() const {
+  return true;
+}
+
+void TopicStats::InternalSwap(TopicStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.topic_, lhs_arena,
+      &other->_impl_.topic_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TopicStats, _impl_.subscribers_)
+      + sizeof(TopicStats::_impl_.subscribers_)
+      - PROTOBUF_FIELD_OFFSET(TopicStats, _impl_.topic_id_)>(
+          reinterpret_cast<char*>(&_impl_.topic_id_),
+          reinterpret_cast<char*>(&other->_impl_.topic_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TopicStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[16]);
+}
+
+// ===================================================================
+
+class SubscriberStats::_Internal {
+ public:
+};
+
+SubscriberStats::SubscriberStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:SubscriberStats)
+}
+SubscriberStats::SubscriberStats(const SubscriberStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SubscriberStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.topics_){}
+    , decltype(_impl_.patterns_){}
+    , decltype(_impl_.groups_){}
+    , decltype(_impl_.queue_depth_){}
+    , decltype(_impl_.queue_capacity_){}
+    , decltype(_impl_.max_queue_depth_){}
+    , decltype(_impl_.dropped_){}
+    , decltype(_impl_.conflated_){}
+    , decltype(_impl_.lightweight_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lightweight_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.lightweight_));
+  // @@protoc_insertion_point(copy_constructor:SubscriberStats)
+}
+
+inline void SubscriberStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.topics_){uint64_t{0u}}
+    , decltype(_impl_.patterns_){uint64_t{0u}}
+    , decltype(_impl_.groups_){uint64_t{0u}}
+    , decltype(_impl_.queue_depth_){uint64_t{0u}}
+    , decltype(_impl_.queue_capacity_){uint64_t{0u}}
+    , decltype(_impl_.max_queue_depth_){uint64_t{0u}}
+    , decltype(_impl_.dropped_){uint64_t{0u}}
+    , decltype(_impl_.conflated_){uint64_t{0u}}
+    , decltype(_impl_.lightweight_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SubscriberStats::~SubscriberStats() {
+  // @@protoc_insertion_point(destructor:SubscriberStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubscriberStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SubscriberStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubscriberStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:SubscriberStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lightweight_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.lightweight_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SubscriberStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 topics = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.topics_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 patterns = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.patterns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 groups = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.groups_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 queue_depth = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.queue_depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 queue_capacity = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.queue_capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_queue_depth = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.max_queue_depth_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 dropped = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.dropped_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 conflated = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.conflated_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool lightweight = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.lightweight_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubscriberStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:SubscriberStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_id(), target);
+  }
+
+  // uint64 topics = 2;
+  if (this->_internal_topics() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_topics(), target);
+  }
+
+  // uint64 patterns = 3;
+  if (this->_internal_patterns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_patterns(), target);
+  }
+
+  // uint64 groups = 4;
+  if (this->_internal_groups() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_groups(), target);
+  }
+
+  // uint64 queue_depth = 5;
+  if (this->_internal_queue_depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_queue_depth(), target);
+  }
+
+  // uint64 queue_capacity = 6;
+  if (this->_internal_queue_capacity() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_queue_capacity(), target);
+  }
+
+  // uint64 max_queue_depth = 7;
+  if (this->_internal_max_queue_depth() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_max_queue_depth(), target);
+  }
+
+  // uint64 dropped = 8;
+  if (this->_internal_dropped() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_dropped(), target);
+  }
+
+  // uint64 conflated = 9;
+  if (this->_internal_conflated() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_conflated(), target);
+  }
+
+  // bool lightweight = 10;
+  if (this->_internal_lightweight() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_lightweight(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:SubscriberStats)
+  return target;
+}
+
+size_t SubscriberStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:SubscriberStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  // uint64 topics = 2;
+  if (this->_internal_topics() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_topics());
+  }
+
+  // uint64 patterns = 3;
+  if (this->_internal_patterns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_patterns());
+  }
+
+  // uint64 groups = 4;
+  if (this->_internal_groups() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_groups());
+  }
+
+  // uint64 queue_depth = 5;
+  if (this->_internal_queue_depth() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_queue_depth());
+  }
+
+  // uint64 queue_capacity = 6;
+  if (this->_internal_queue_capacity() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_queue_capacity());
+  }
+
+  // uint64 max_queue_depth = 7;
+  if (this->_internal_max_queue_depth() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_queue_depth());
+  }
+
+  // uint64 dropped = 8;
+  if (this->_internal_dropped() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_dropped());
+  }
+
+  // uint64 conflated = 9;
+  if (this->_internal_conflated() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_conflated());
+  }
+
+  // bool lightweight = 10;
+  if (this->_internal_lightweight() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubscriberStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SubscriberStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubscriberStats::GetClassData() const { return &_class_data_; }
+
+
+void SubscriberStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SubscriberStats*>(&to_msg);
+  auto& from = static_cast<const SubscriberStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SubscriberStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_topics() != 0) {
+    _this->_internal_set_topics(from._internal_topics());
+  }
+  if (from._internal_patterns() != 0) {
+    _this->_internal_set_patterns(from._internal_patterns());
+  }
+  if (from._internal_groups() != 0) {
+    _this->_internal_set_groups(from._internal_groups());
+  }
+  if (from._internal_queue_depth() != 0) {
+    _this->_internal_set_queue_depth(from._internal_queue_depth());
+  }
+  if (from._internal_queue_capacity() != 0) {
+    _this->_internal_set_queue_capacity(from._internal_queue_capacity());
+  }
+  if (from._internal_max_queue_depth() != 0) {
+    _this->_internal_set_max_queue_depth(from._internal_max_queue_depth());
+  }
+  if (from._internal_dropped() != 0) {
+    _this->_internal_set_dropped(from._internal_dropped());
+  }
+  if (from._internal_conflated() != 0) {
+    _this->_internal_set_conflated(from._internal_conflated());
+  }
+  if (from._internal_lightweight() != 0) {
+    _this->_internal_set_lightweight(from._internal_lightweight());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SubscriberStats::CopyFrom(const SubscriberStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:SubscriberStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubscriberStats::IsInitialized() const {
+  return true;
+}
+
+void SubscriberStats::InternalSwap(SubscriberStats* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubscriberStats, _impl_.lightweight_)
+      + sizeof(SubscriberStats::_impl_.lightweight_)
+      - PROTOBUF_FIELD_OFFSET(SubscriberStats, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SubscriberStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[17]);
+}
+
+// ===================================================================
+
+class DispatcherThreadStats::_Internal {
+ public:
+};
+
+DispatcherThreadStats::DispatcherThreadStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:DispatcherThreadStats)
+}
+DispatcherThreadStats::DispatcherThreadStats(const DispatcherThreadStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DispatcherThreadStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.thread_id_){}
+    , decltype(_impl_.events_){}
+    , decltype(_impl_.busy_seconds_){}
+    , decltype(_impl_.utilization_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.thread_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.thread_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_thread_id().empty()) {
+    _this->_impl_.thread_id_.Set(from._internal_thread_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.events_, &from._impl_.events_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.utilization_) -
+    reinterpret_cast<char*>(&_impl_.events_)) + sizeof(_impl_.utilization_));
+  // @@protoc_insertion_point(copy_constructor:DispatcherThreadStats)
+}
+
+inline void DispatcherThreadStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.thread_id_){}
+    , decltype(_impl_.events_){uint64_t{0u}}
+    , decltype(_impl_.busy_seconds_){0}
+    , decltype(_impl_.utilization_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.thread_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.thread_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DispatcherThreadStats::~DispatcherThreadStats() {
+  // @@protoc_insertion_point(destructor:DispatcherThreadStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DispatcherThreadStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.thread_id_.Destroy();
+}
+
+void DispatcherThreadStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DispatcherThreadStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:DispatcherThreadStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.thread_id_.ClearToEmpty();
+  ::memset(&_impl_.events_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.utilization_) -
+      reinterpret_cast<char*>(&_impl_.events_)) + sizeof(_impl_.utilization_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DispatcherThreadStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string thread_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_thread_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "DispatcherThreadStats.thread_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 events = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.events_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double busy_seconds = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.busy_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double utilization = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.utilization_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DispatcherThreadStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:DispatcherThreadStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string thread_id = 1;
+  if (!this->_internal_thread_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_thread_id().data(), static_cast<int>(this->_internal_thread_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "DispatcherThreadStats.thread_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_thread_id(), target);
+  }
+
+  // uint64 events = 2;
+  if (this->_internal_events() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_events(), target);
+  }
+
+  // double busy_seconds = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_busy_seconds = this->_internal_busy_seconds();
+  uint64_t raw_busy_seconds;
+  memcpy(&raw_busy_seconds, &tmp_busy_seconds, sizeof(tmp_busy_seconds));
+  if (raw_busy_seconds != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_busy_seconds(), target);
+  }
+
+  // double utilization = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_utilization = this->_internal_utilization();
+  uint64_t raw_utilization;
+  memcpy(&raw_utilization, &tmp_utilization, sizeof(tmp_utilization));
+  if (raw_utilization != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_utilization(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:DispatcherThreadStats)
+  return target;
+}
+
+size_t DispatcherThreadStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:DispatcherThreadStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string thread_id = 1;
+  if (!this->_internal_thread_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_thread_id());
+  }
+
+  // uint64 events = 2;
+  if (this->_internal_events() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_events());
+  }
+
+  // double busy_seconds = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_busy_seconds = this->_internal_busy_seconds();
+  uint64_t raw_busy_seconds;
+  memcpy(&raw_busy_seconds, &tmp_busy_seconds, sizeof(tmp_busy_seconds));
+  if (raw_busy_seconds != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double utilization = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_utilization = this->_internal_utilization();
+  uint64_t raw_utilization;
+  memcpy(&raw_utilization, &tmp_utilization, sizeof(tmp_utilization));
+  if (raw_utilization != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DispatcherThreadStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DispatcherThreadStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DispatcherThreadStats::GetClassData() const { return &_class_data_; }
+
+
+void DispatcherThreadStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DispatcherThreadStats*>(&to_msg);
+  auto& from = static_cast<const DispatcherThreadStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:DispatcherThreadStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_thread_id().empty()) {
+    _this->_internal_set_thread_id(from._internal_thread_id());
+  }
+  if (from._internal_events() != 0) {
+    _this->_internal_set_events(from._internal_events());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_busy_seconds = from._internal_busy_seconds();
+  uint64_t raw_busy_seconds;
+  memcpy(&raw_busy_seconds, &tmp_busy_seconds, sizeof(tmp_busy_seconds));
+  if (raw_busy_seconds != 0) {
+    _this->_internal_set_busy_seconds(from._internal_busy_seconds());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_utilization = from._internal_utilization();
+  uint64_t raw_utilization;
+  memcpy(&raw_utilization, &tmp_utilization, sizeof(tmp_utilization));
+  if (raw_utilization != 0) {
+    _this->_internal_set_utilization(from._internal_utilization());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DispatcherThreadStats::CopyFrom(const DispatcherThreadStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:DispatcherThreadStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DispatcherThreadStats::IsInitialized() const {
+  return true;
+}
+
+void DispatcherThreadStats::InternalSwap(DispatcherThreadStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.thread_id_, lhs_arena,
+      &other->_impl_.thread_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DispatcherThreadStats, _impl_.utilization_)
+      + sizeof(DispatcherThreadStats::_impl_.utilization_)
+      - PROTOBUF_FIELD_OFFSET(DispatcherThreadStats, _impl_.events_)>(
+          reinterpret_cast<char*>(&_impl_.events_),
+          reinterpret_cast<char*>(&other->_impl_.events_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DispatcherThreadStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[18]);
+}
+
+// ===================================================================
+
+class LatencyHistogram_Bucket::_Internal {
+ public:
+};
+
+LatencyHistogram_Bucket::LatencyHistogram_Bucket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:LatencyHistogram.Bucket)
+}
+LatencyHistogram_Bucket::LatencyHistogram_Bucket(const LatencyHistogram_Bucket& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LatencyHistogram_Bucket* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.up_to_ns_){}
+    , decltype(_impl_.count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.up_to_ns_, &from._impl_.up_to_ns_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.up_to_ns_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:LatencyHistogram.Bucket)
+}
+
+inline void LatencyHistogram_Bucket::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.up_to_ns_){uint64_t{0u}}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LatencyHistogram_Bucket::~LatencyHistogram_Bucket() {
+  // @@protoc_insertion_point(destructor:LatencyHistogram.Bucket)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LatencyHistogram_Bucket::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LatencyHistogram_Bucket::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LatencyHistogram_Bucket::Clear() {
+// @@protoc_insertion_point(message_clear_start:LatencyHistogram.Bucket)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.up_to_ns_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.count_) -
+      reinterpret_cast<char*>(&_impl_.up_to_ns_)) + sizeof(_impl_.count_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LatencyHistogram_Bucket::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 up_to_ns = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.up_to_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LatencyHistogram_Bucket::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:LatencyHistogram.Bucket)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 up_to_ns = 1;
+  if (this->_internal_up_to_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_up_to_ns(), target);
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:LatencyHistogram.Bucket)
+  return target;
+}
+
+size_t LatencyHistogram_Bucket::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:LatencyHistogram.Bucket)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 up_to_ns = 1;
+  if (this->_internal_up_to_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_up_to_ns());
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LatencyHistogram_Bucket::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LatencyHistogram_Bucket::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LatencyHistogram_Bucket::GetClassData() const { return &_class_data_; }
+
+
+void LatencyHistogram_Bucket::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LatencyHistogram_Bucket*>(&to_msg);
+  auto& from = static_cast<const LatencyHistogram_Bucket&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:LatencyHistogram.Bucket)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_up_to_ns() != 0) {
+    _this->_internal_set_up_to_ns(from._internal_up_to_ns());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LatencyHistogram_Bucket::CopyFrom(const LatencyHistogram_Bucket& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:LatencyHistogram.Bucket)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencyHistogram_Bucket::IsInitialized() const {
+  return true;
+}
+
+void LatencyHistogram_Bucket::InternalSwap(LatencyHistogram_Bucket* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LatencyHistogram_Bucket, _impl_.count_)
+      + sizeof(LatencyHistogram_Bucket::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(LatencyHistogram_Bucket, _impl_.up_to_ns_)>(
+          reinterpret_cast<char*>(&_impl_.up_to_ns_),
+          reinterpret_cast<char*>(&other->_impl_.up_to_ns_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LatencyHistogram_Bucket::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[19]);
+}
+
+// ===================================================================
+
+class LatencyHistogram::_Internal {
+ public:
+};
+
+LatencyHistogram::LatencyHistogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:LatencyHistogram)
+}
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LatencyHistogram* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buckets_){from._impl_.buckets_}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.p50_ns_){}
+    , decltype(_impl_.p90_ns_){}
+    , decltype(_impl_.p99_ns_){}
+    , decltype(_impl_.p999_ns_){}
+    , decltype(_impl_.max_ns_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_ns_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_ns_));
+  // @@protoc_insertion_point(copy_constructor:LatencyHistogram)
+}
+
+inline void LatencyHistogram::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buckets_){arena}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.p50_ns_){uint64_t{0u}}
+    , decltype(_impl_.p90_ns_){uint64_t{0u}}
+    , decltype(_impl_.p99_ns_){uint64_t{0u}}
+    , decltype(_impl_.p999_ns_){uint64_t{0u}}
+    , decltype(_impl_.max_ns_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LatencyHistogram::~LatencyHistogram() {
+  // @@protoc_insertion_point(destructor:LatencyHistogram)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LatencyHistogram::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.buckets_.~RepeatedPtrField();
+}
+
+void LatencyHistogram::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LatencyHistogram::Clear() {
+// @@protoc_insertion_point(message_clear_start:LatencyHistogram)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.buckets_.Clear();
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_ns_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_ns_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LatencyHistogram::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 count = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p50_ns = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.p50_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p90_ns = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.p90_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p99_ns = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.p99_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p999_ns = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.p999_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_ns = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.max_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .LatencyHistogram.Bucket buckets = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_buckets(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LatencyHistogram::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:LatencyHistogram)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 count = 1;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_count(), target);
+  }
+
+  // uint64 p50_ns = 2;
+  if (this->_internal_p50_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_p50_ns(), target);
+  }
+
+  // uint64 p90_ns = 3;
+  if (this->_internal_p90_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_p90_ns(), target);
+  }
+
+  // uint64 p99_ns = 4;
+  if (this->_internal_p99_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_p99_ns(), target);
+  }
+
+  // uint64 p999_ns = 5;
+  if (this->_internal_p999_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_p999_ns(), target);
+  }
+
+  // uint64 max_ns = 6;
+  if (this->_internal_max_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_max_ns(), target);
+  }
+
+  // repeated .LatencyHistogram.Bucket buckets = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_buckets_size()); i < n; i++) {
+    const auto& repfield = this->_internal_buckets(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:LatencyHistogram)
+  return target;
+}
+
+size_t LatencyHistogram::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:LatencyHistogram)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .LatencyHistogram.Bucket buckets = 7;
+  total_size += 1UL * this->_internal_buckets_size();
+  for (const auto& msg : this->_impl_.buckets_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 count = 1;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // uint64 p50_ns = 2;
+  if (this->_internal_p50_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p50_ns());
+  }
+
+  // uint64 p90_ns = 3;
+  if (this->_internal_p90_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p90_ns());
+  }
+
+  // uint64 p99_ns = 4;
+  if (this->_internal_p99_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p99_ns());
+  }
+
+  // uint64 p999_ns = 5;
+  if (this->_internal_p999_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p999_ns());
+  }
+
+  // uint64 max_ns = 6;
+  if (this->_internal_max_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_ns());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LatencyHistogram::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LatencyHistogram::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LatencyHistogram::GetClassData() const { return &_class_data_; }
+
+
+void LatencyHistogram::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LatencyHistogram*>(&to_msg);
+  auto& from = static_cast<const LatencyHistogram&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:LatencyHistogram)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.buckets_.MergeFrom(from._impl_.buckets_);
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_p50_ns() != 0) {
+    _this->_internal_set_p50_ns(from._internal_p50_ns());
+  }
+  if (from._internal_p90_ns() != 0) {
+    _this->_internal_set_p90_ns(from._internal_p90_ns());
+  }
+  if (from._internal_p99_ns() != 0) {
+    _this->_internal_set_p99_ns(from._internal_p99_ns());
+  }
+  if (from._internal_p999_ns() != 0) {
+    _this->_internal_set_p999_ns(from._internal_p999_ns());
+  }
+  if (from._internal_max_ns() != 0) {
+    _this->_internal_set_max_ns(from._internal_max_ns());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LatencyHistogram::CopyFrom(const LatencyHistogram& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:LatencyHistogram)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LatencyHistogram::IsInitialized() const {
+  return true;
+}
+
+void LatencyHistogram::InternalSwap(LatencyHistogram* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.buckets_.InternalSwap(&other->_impl_.buckets_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LatencyHistogram, _impl_.max_ns_)
+      + sizeof(LatencyHistogram::_impl_.max_ns_)
+      - PROTOBUF_FIELD_OFFSET(LatencyHistogram, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LatencyHistogram::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[20]);
+}
+
+// ===================================================================
+
+class StatsResponse::_Internal {
+ public:
+  static const ::LatencyHistogram& publish_to_write(const StatsResponse* msg);
+};
+
+const ::LatencyHistogram&
+StatsResponse::_Internal::publish_to_write(const StatsResponse* msg) {
+  return *msg->_impl_.publish_to_write_;
+}
+StatsResponse::StatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:StatsResponse)
+}
+StatsResponse::StatsResponse(const StatsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topics_){from._impl_.topics_}
+    , decltype(_impl_.subscribers_){from._impl_.subscribers_}
+    , decltype(_impl_.dispatcher_threads_){from._impl_.dispatcher_threads_}
+    , decltype(_impl_.publish_to_write_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_publish_to_write()) {
+    _this->_impl_.publish_to_write_ = new ::LatencyHistogram(*from._impl_.publish_to_write_);
+  }
+  // @@protoc_insertion_point(copy_constructor:StatsResponse)
+}
+
+inline void StatsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topics_){arena}
+    , decltype(_impl_.subscribers_){arena}
+    , decltype(_impl_.dispatcher_threads_){arena}
+    , decltype(_impl_.publish_to_write_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StatsResponse::~StatsResponse() {
+  // @@protoc_insertion_point(destructor:StatsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SendRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void StatsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.topics_.~RepeatedPtrField();
+  _impl_.subscribers_.~RepeatedPtrField();
+  _impl_.dispatcher_threads_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.publish_to_write_;
 }
 
-void SendRequest::ArenaDtor(void* object) {
-  SendRequest* _this = reinterpret_cast< SendRequest* >(object);
-  (void)_this;
-}
-void SendRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void SendRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void StatsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void SendRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:SendRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void StatsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:StatsResponse)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  messages_.Clear();
+  _impl_.topics_.Clear();
+  _impl_.subscribers_.Clear();
+  _impl_.dispatcher_threads_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.publish_to_write_ != nullptr) {
+    delete _impl_.publish_to_write_;
+  }
+  _impl_.publish_to_write_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SendRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* StatsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .Message messages = 1;
+      // repeated .TopicStats topics = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_topics(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // repeated .SubscriberStats subscribers = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_subscribers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .DispatcherThreadStats dispatcher_threads = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dispatcher_threads(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .LatencyHistogram publish_to_write = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_publish_to_write(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* SendRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:SendRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* StatsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:StatsResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .Message messages = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_messages_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  // repeated .TopicStats topics = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_topics_size()); i < n; i++) {
+    const auto& repfield = this->_internal_topics(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .SubscriberStats subscribers = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_subscribers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_subscribers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .DispatcherThreadStats dispatcher_threads = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_dispatcher_threads_size()); i < n; i++) {
+    const auto& repfield = this->_internal_dispatcher_threads(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .LatencyHistogram publish_to_write = 4;
+  if (this->_internal_has_publish_to_write()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_messages(i), target, stream);
+      InternalWriteMessage(4, _Internal::publish_to_write(this),
+        _Internal::publish_to_write(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:SendRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:StatsResponse)
   return target;
 }
 
-size_t SendRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:SendRequest)
+size_t StatsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:StatsResponse)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .Message messages = 1;
-  total_size += 1UL * this->_internal_messages_size();
-  for (const auto& msg : this->messages_) {
+  // repeated .TopicStats topics = 1;
+  total_size += 1UL * this->_internal_topics_size();
+  for (const auto& msg : this->_impl_.topics_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // repeated .SubscriberStats subscribers = 2;
+  total_size += 1UL * this->_internal_subscribers_size();
+  for (const auto& msg : this->_impl_.subscribers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .DispatcherThreadStats dispatcher_threads = 3;
+  total_size += 1UL * this->_internal_dispatcher_threads_size();
+  for (const auto& msg : this->_impl_.dispatcher_threads_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void SendRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SendRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SendRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SendRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SendRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SendRequest)
-    MergeFrom(*source);
+  // .LatencyHistogram publish_to_write = 4;
+  if (this->_internal_has_publish_to_write()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.publish_to_write_);
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SendRequest::MergeFrom(const SendRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SendRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsResponse::GetClassData() const { return &_class_data_; }
 
-  messages_.MergeFrom(from.messages_);
-}
 
-void SendRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SendRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void StatsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatsResponse*>(&to_msg);
+  auto& from = static_cast<const StatsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:StatsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.topics_.MergeFrom(from._impl_.topics_);
+  _this->_impl_.subscribers_.MergeFrom(from._impl_.subscribers_);
+  _this->_impl_.dispatcher_threads_.MergeFrom(from._impl_.dispatcher_threads_);
+  if (from._internal_has_publish_to_write()) {
+    _this->_internal_mutable_publish_to_write()->::LatencyHistogram::MergeFrom(
+        from._internal_publish_to_write());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SendRequest::CopyFrom(const SendRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:SendRequest)
+void StatsResponse::CopyFrom(const StatsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:StatsResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SendRequest::IsInitialized() const {
+bool StatsResponse::IsInitialized() const {
   return true;
 }
 
-void SendRequest::InternalSwap(SendRequest* other) {
+void StatsResponse::InternalSwap(StatsResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  messages_.InternalSwap(&other->messages_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.topics_.InternalSwap(&other->_impl_.topics_);
+  _impl_.subscribers_.InternalSwap(&other->_impl_.subscribers_);
+  _impl_.dispatcher_threads_.InternalSwap(&other->_impl_.dispatcher_threads_);
+  swap(_impl_.publish_to_write_, other->_impl_.publish_to_write_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SendRequest::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata StatsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[21]);
 }
 
-
 // ===================================================================
 
-class SendResponse::_Internal {
+class DictionariesRequest::_Internal {
  public:
 };
 
-SendResponse::SendResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:SendResponse)
+DictionariesRequest::DictionariesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:DictionariesRequest)
 }
-SendResponse::SendResponse(const SendResponse& from)
+DictionariesRequest::DictionariesRequest(const DictionariesRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DictionariesRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topic_ids_){from._impl_.topic_ids_}
+    , /*decltype(_impl_._topic_ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:SendResponse)
+  // @@protoc_insertion_point(copy_constructor:DictionariesRequest)
 }
 
-void SendResponse::SharedCtor() {
+inline void DictionariesRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.topic_ids_){arena}
+    , /*decltype(_impl_._topic_ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-SendResponse::~SendResponse() {
-  // @@protoc_insertion_point(destructor:SendResponse)
+DictionariesRequest::~DictionariesRequest() {
+  // @@protoc_insertion_point(destructor:DictionariesRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void SendResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void DictionariesRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.topic_ids_.~RepeatedField();
 }
 
-void SendResponse::ArenaDtor(void* object) {
-  SendResponse* _this = reinterpret_cast< SendResponse* >(object);
-  (void)_this;
-}
-void SendResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void SendResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void DictionariesRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void SendResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:SendResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void DictionariesRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:DictionariesRequest)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.topic_ids_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SendResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* DictionariesRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint64 topic_ids = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_topic_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_topic_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* SendResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:SendResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* DictionariesRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:DictionariesRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  // repeated uint64 topic_ids = 1;
+  {
+    int byte_size = _impl_._topic_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt64Packed(
+          1, _internal_topic_ids(), byte_size, target);
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:SendResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:DictionariesRequest)
   return target;
 }
 
-size_t SendResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:SendResponse)
+size_t DictionariesRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:DictionariesRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // repeated uint64 topic_ids = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.topic_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._topic_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void SendResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SendResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SendResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SendResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SendResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SendResponse)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SendResponse::MergeFrom(const SendResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SendResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DictionariesRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DictionariesRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DictionariesRequest::GetClassData() const { return &_class_data_; }
 
-}
 
-void SendResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SendResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void DictionariesRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DictionariesRequest*>(&to_msg);
+  auto& from = static_cast<const DictionariesRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:DictionariesRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.topic_ids_.MergeFrom(from._impl_.topic_ids_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SendResponse::CopyFrom(const SendResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:SendResponse)
+void DictionariesRequest::CopyFrom(const DictionariesRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:DictionariesRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SendResponse::IsInitialized() const {
+bool DictionariesRequest::IsInitialized() const {
   return true;
 }
 
-void SendResponse::InternalSwap(SendResponse* other) {
+void DictionariesRequest::InternalSwap(DictionariesRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.topic_ids_.InternalSwap(&other->_impl_.topic_ids_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SendResponse::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata DictionariesRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[22]);
 }
 
-
 // ===================================================================
 
-class ReceiveRequest::_Internal {
+class Dictionary::_Internal {
  public:
 };
 
-ReceiveRequest::ReceiveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  topics_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:ReceiveRequest)
+Dictionary::Dictionary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:Dictionary)
 }
-ReceiveRequest::ReceiveRequest(const ReceiveRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      topics_(from.topics_) {
+Dictionary::Dictionary(const Dictionary& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Dictionary* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.topic_id_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:ReceiveRequest)
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.topic_id_, &from._impl_.topic_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.id_) -
+    reinterpret_cast<char*>(&_impl_.topic_id_)) + sizeof(_impl_.id_));
+  // @@protoc_insertion_point(copy_constructor:Dictionary)
 }
 
-void ReceiveRequest::SharedCtor() {
+inline void Dictionary::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.topic_id_){uint64_t{0u}}
+    , decltype(_impl_.id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-ReceiveRequest::~ReceiveRequest() {
-  // @@protoc_insertion_point(destructor:ReceiveRequest)
+Dictionary::~Dictionary() {
+  // @@protoc_insertion_point(destructor:Dictionary)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ReceiveRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void Dictionary::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
 }
 
-void ReceiveRequest::ArenaDtor(void* object) {
-  ReceiveRequest* _this = reinterpret_cast< ReceiveRequest* >(object);
-  (void)_this;
-}
-void ReceiveRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void ReceiveRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void Dictionary::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void ReceiveRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:ReceiveRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Dictionary::Clear() {
+// @@protoc_insertion_point(message_clear_start:Dictionary)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  topics_.Clear();
+  _impl_.data_.ClearToEmpty();
+  ::memset(&_impl_.topic_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.id_) -
+      reinterpret_cast<char*>(&_impl_.topic_id_)) + sizeof(_impl_.id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ReceiveRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Dictionary::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated string topics = 1;
+      // uint64 topic_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_topics();
-            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "ReceiveRequest.topics"));
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.topic_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // uint32 id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ReceiveRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:ReceiveRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Dictionary::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:Dictionary)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated string topics = 1;
-  for (int i = 0, n = this->_internal_topics_size(); i < n; i++) {
-    const auto& s = this->_internal_topics(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "ReceiveRequest.topics");
-    target = stream->WriteString(1, s, target);
+  // uint64 topic_id = 1;
+  if (this->_internal_topic_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_topic_id(), target);
+  }
+
+  // uint32 id = 2;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_data(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:ReceiveRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:Dictionary)
   return target;
 }
 
-size_t ReceiveRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ReceiveRequest)
+size_t Dictionary::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:Dictionary)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated string topics = 1;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(topics_.size());
-  for (int i = 0, n = topics_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      topics_.Get(i));
+  // bytes data = 3;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint64 topic_id = 1;
+  if (this->_internal_topic_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_topic_id());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void ReceiveRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ReceiveRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ReceiveRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ReceiveRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ReceiveRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ReceiveRequest)
-    MergeFrom(*source);
+  // uint32 id = 2;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ReceiveRequest::MergeFrom(const ReceiveRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ReceiveRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Dictionary::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Dictionary::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Dictionary::GetClassData() const { return &_class_data_; }
 
-  topics_.MergeFrom(from.topics_);
-}
 
-void ReceiveRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ReceiveRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void Dictionary::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Dictionary*>(&to_msg);
+  auto& from = static_cast<const Dictionary&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:Dictionary)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_topic_id() != 0) {
+    _this->_internal_set_topic_id(from._internal_topic_id());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ReceiveRequest::CopyFrom(const ReceiveRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ReceiveRequest)
+void Dictionary::CopyFrom(const Dictionary& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:Dictionary)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReceiveRequest::IsInitialized() const {
+bool Dictionary::IsInitialized() const {
   return true;
 }
 
-void ReceiveRequest::InternalSwap(ReceiveRequest* other) {
+void Dictionary::InternalSwap(Dictionary* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  topics_.InternalSwap(&other->topics_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Dictionary, _impl_.id_)
+      + sizeof(Dictionary::_impl_.id_)
+      - PROTOBUF_FIELD_OFFSET(Dictionary, _impl_.topic_id_)>(
+          reinterpret_cast<char*>(&_impl_.topic_id_),
+          reinterpret_cast<char*>(&other->_impl_.topic_id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ReceiveRequest::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Dictionary::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[23]);
 }
 
-
 // ===================================================================
 
-class ReceiveResponse::_Internal {
+class DictionariesResponse::_Internal {
  public:
-  static const ::Message& message(const ReceiveResponse* msg);
 };
 
-const ::Message&
-ReceiveResponse::_Internal::message(const ReceiveResponse* msg) {
-  return *msg->message_;
-}
-ReceiveResponse::ReceiveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:ReceiveResponse)
+DictionariesResponse::DictionariesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:DictionariesResponse)
 }
-ReceiveResponse::ReceiveResponse(const ReceiveResponse& from)
+DictionariesResponse::DictionariesResponse(const DictionariesResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DictionariesResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dictionaries_){from._impl_.dictionaries_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_message()) {
-    message_ = new ::Message(*from.message_);
-  } else {
-    message_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:ReceiveResponse)
+  // @@protoc_insertion_point(copy_constructor:DictionariesResponse)
 }
 
-void ReceiveResponse::SharedCtor() {
-message_ = nullptr;
+inline void DictionariesResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dictionaries_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-ReceiveResponse::~ReceiveResponse() {
-  // @@protoc_insertion_point(destructor:ReceiveResponse)
+DictionariesResponse::~DictionariesResponse() {
+  // @@protoc_insertion_point(destructor:DictionariesResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ReceiveResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete message_;
+inline void DictionariesResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dictionaries_.~RepeatedPtrField();
 }
 
-void ReceiveResponse::ArenaDtor(void* object) {
-  ReceiveResponse* _this = reinterpret_cast< ReceiveResponse* >(object);
-  (void)_this;
-}
-void ReceiveResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void ReceiveResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void DictionariesResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void ReceiveResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:ReceiveResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void DictionariesResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:DictionariesResponse)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArena() == nullptr && message_ != nullptr) {
-    delete message_;
-  }
-  message_ = nullptr;
+  _impl_.dictionaries_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ReceiveResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* DictionariesResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .Message message = 1;
+      // repeated .Dictionary dictionaries = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dictionaries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ReceiveResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:ReceiveResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* DictionariesResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:DictionariesResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .Message message = 1;
-  if (this->has_message()) {
-    target = stream->EnsureSpace(target);
+  // repeated .Dictionary dictionaries = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_dictionaries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_dictionaries(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::message(this), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:ReceiveResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:DictionariesResponse)
   return target;
 }
 
-size_t ReceiveResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:ReceiveResponse)
+size_t DictionariesResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:DictionariesResponse)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .Message message = 1;
-  if (this->has_message()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *message_);
+  // repeated .Dictionary dictionaries = 1;
+  total_size += 1UL * this->_internal_dictionaries_size();
+  for (const auto& msg : this->_impl_.dictionaries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ReceiveResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:ReceiveResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ReceiveResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ReceiveResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:ReceiveResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:ReceiveResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DictionariesResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DictionariesResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DictionariesResponse::GetClassData() const { return &_class_data_; }
 
-void ReceiveResponse::MergeFrom(const ReceiveResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:ReceiveResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.has_message()) {
-    _internal_mutable_message()->::Message::MergeFrom(from._internal_message());
-  }
-}
+void DictionariesResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DictionariesResponse*>(&to_msg);
+  auto& from = static_cast<const DictionariesResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:DictionariesResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void ReceiveResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:ReceiveResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.dictionaries_.MergeFrom(from._impl_.dictionaries_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ReceiveResponse::CopyFrom(const ReceiveResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:ReceiveResponse)
+void DictionariesResponse::CopyFrom(const DictionariesResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:DictionariesResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ReceiveResponse::IsInitialized() const {
+bool DictionariesResponse::IsInitialized() const {
   return true;
 }
 
-void ReceiveResponse::InternalSwap(ReceiveResponse* other) {
+void DictionariesResponse::InternalSwap(DictionariesResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(message_, other->message_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.dictionaries_.InternalSwap(&other->_impl_.dictionaries_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ReceiveResponse::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata DictionariesResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_broker_2eproto_getter, &descriptor_table_broker_2eproto_once,
+      file_level_metadata_broker_2eproto[24]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::Message* Arena::CreateMaybeMessage< ::Message >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::Message_HeadersEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::Message_HeadersEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Message_HeadersEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Message*
+Arena::CreateMaybeMessage< ::Message >(Arena* arena) {
   return Arena::CreateMessageInternal< ::Message >(arena);
 }
-template<> PROTOBUF_NOINLINE ::SendRequest* Arena::CreateMaybeMessage< ::SendRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::SendRequest*
+Arena::CreateMaybeMessage< ::SendRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::SendRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::SendResponse* Arena::CreateMaybeMessage< ::SendResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::SendResponse*
+Arena::CreateMaybeMessage< ::SendResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::SendResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::ReceiveRequest* Arena::CreateMaybeMessage< ::ReceiveRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::PublishAck*
+Arena::CreateMaybeMessage< ::PublishAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::PublishAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ResolveRequest*
+Arena::CreateMaybeMessage< ::ResolveRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ResolveRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ResolveResponse*
+Arena::CreateMaybeMessage< ::ResolveResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ResolveResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ReceiveRequest_StartOffsetsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::ReceiveRequest_StartOffsetsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ReceiveRequest_StartOffsetsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ReceiveRequest_FiltersEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::ReceiveRequest_FiltersEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::ReceiveRequest_FiltersEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ReceiveRequest*
+Arena::CreateMaybeMessage< ::ReceiveRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ReceiveRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::ReceiveResponse* Arena::CreateMaybeMessage< ::ReceiveResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::SubscribeRequest_StartOffsetsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::SubscribeRequest_StartOffsetsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SubscribeRequest_StartOffsetsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SubscribeRequest_FiltersEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::SubscribeRequest_FiltersEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SubscribeRequest_FiltersEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SubscribeRequest*
+Arena::CreateMaybeMessage< ::SubscribeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SubscribeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::AckSettings*
+Arena::CreateMaybeMessage< ::AckSettings >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::AckSettings >(arena);
+}
+template<> PROTOBUF_NOINLINE ::ReceiveResponse*
+Arena::CreateMaybeMessage< ::ReceiveResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::ReceiveResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::StatsRequest*
+Arena::CreateMaybeMessage< ::StatsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::StatsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TopicStats*
+Arena::CreateMaybeMessage< ::TopicStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TopicStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::SubscriberStats*
+Arena::CreateMaybeMessage< ::SubscriberStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::SubscriberStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::DispatcherThreadStats*
+Arena::CreateMaybeMessage< ::DispatcherThreadStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::DispatcherThreadStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::LatencyHistogram_Bucket*
+Arena::CreateMaybeMessage< ::LatencyHistogram_Bucket >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::LatencyHistogram_Bucket >(arena);
+}
+template<> PROTOBUF_NOINLINE ::LatencyHistogram*
+Arena::CreateMaybeMessage< ::LatencyHistogram >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::LatencyHistogram >(arena);
+}
+template<> PROTOBUF_NOINLINE ::StatsResponse*
+Arena::CreateMaybeMessage< ::StatsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::StatsResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::DictionariesRequest*
+Arena::CreateMaybeMessage< ::DictionariesRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::DictionariesRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::Dictionary*
+Arena::CreateMaybeMessage< ::Dictionary >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::Dictionary >(arena);
+}
+template<> PROTOBUF_NOINLINE ::DictionariesResponse*
+Arena::CreateMaybeMessage< ::DictionariesResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::DictionariesResponse >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3015000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3015008 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,13 +23,17 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -42,49 +46,251 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_broker_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[5]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_broker_2eproto;
-::PROTOBUF_NAMESPACE_ID::Metadata descriptor_table_broker_2eproto_metadata_getter(int index);
+class AckSettings;
+struct AckSettingsDefaultTypeInternal;
+extern AckSettingsDefaultTypeInternal _AckSettings_default_instance_;
+class DictionariesRequest;
+struct DictionariesRequestDefaultTypeInternal;
+extern DictionariesRequestDefaultTypeInternal _DictionariesRequest_default_instance_;
+class DictionariesResponse;
+struct DictionariesResponseDefaultTypeInternal;
+extern DictionariesResponseDefaultTypeInternal _DictionariesResponse_default_instance_;
+class Dictionary;
+struct DictionaryDefaultTypeInternal;
+extern DictionaryDefaultTypeInternal _Dictionary_default_instance_;
+class DispatcherThreadStats;
+struct DispatcherThreadStatsDefaultTypeInternal;
+extern DispatcherThreadStatsDefaultTypeInternal _DispatcherThreadStats_default_instance_;
+class LatencyHistogram;
+struct LatencyHistogramDefaultTypeInternal;
+extern LatencyHistogramDefaultTypeInternal _LatencyHistogram_default_instance_;
+class LatencyHistogram_Bucket;
+struct LatencyHistogram_BucketDefaultTypeInternal;
+extern LatencyHistogram_BucketDefaultTypeInternal _LatencyHistogram_Bucket_default_instance_;
 class Message;
 struct MessageDefaultTypeInternal;
 extern MessageDefaultTypeInternal _Message_default_instance_;
+class Message_HeadersEntry_DoNotUse;
+struct Message_HeadersEntry_DoNotUseDefaultTypeInternal;
+extern Message_HeadersEntry_DoNotUseDefaultTypeInternal _Message_HeadersEntry_DoNotUse_default_instance_;
+class PublishAck;
+struct PublishAckDefaultTypeInternal;
+extern PublishAckDefaultTypeInternal _PublishAck_default_instance_;
 class ReceiveRequest;
 struct ReceiveRequestDefaultTypeInternal;
 extern ReceiveRequestDefaultTypeInternal _ReceiveRequest_default_instance_;
+class ReceiveRequest_FiltersEntry_DoNotUse;
+struct ReceiveRequest_FiltersEntry_DoNotUseDefaultTypeInternal;
+extern ReceiveRequest_FiltersEntry_DoNotUseDefaultTypeInternal _ReceiveRequest_FiltersEntry_DoNotUse_default_instance_;
+class ReceiveRequest_StartOffsetsEntry_DoNotUse;
+struct ReceiveRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal;
+extern ReceiveRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal _ReceiveRequest_StartOffsetsEntry_DoNotUse_default_instance_;
 class ReceiveResponse;
 struct ReceiveResponseDefaultTypeInternal;
 extern ReceiveResponseDefaultTypeInternal _ReceiveResponse_default_instance_;
+class ResolveRequest;
+struct ResolveRequestDefaultTypeInternal;
+extern ResolveRequestDefaultTypeInternal _ResolveRequest_default_instance_;
+class ResolveResponse;
+struct ResolveResponseDefaultTypeInternal;
+extern ResolveResponseDefaultTypeInternal _ResolveResponse_default_instance_;
 class SendRequest;
 struct SendRequestDefaultTypeInternal;
 extern SendRequestDefaultTypeInternal _SendRequest_default_instance_;
 class SendResponse;
 struct SendResponseDefaultTypeInternal;
 extern SendResponseDefaultTypeInternal _SendResponse_default_instance_;
+class StatsRequest;
+struct StatsRequestDefaultTypeInternal;
+extern StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+class StatsResponse;
+struct StatsResponseDefaultTypeInternal;
+extern StatsResponseDefaultTypeInternal _StatsResponse_default_instance_;
+class SubscribeRequest;
+struct SubscribeRequestDefaultTypeInternal;
+extern SubscribeRequestDefaultTypeInternal _SubscribeRequest_default_instance_;
+class SubscribeRequest_FiltersEntry_DoNotUse;
+struct SubscribeRequest_FiltersEntry_DoNotUseDefaultTypeInternal;
+extern SubscribeRequest_FiltersEntry_DoNotUseDefaultTypeInternal _SubscribeRequest_FiltersEntry_DoNotUse_default_instance_;
+class SubscribeRequest_StartOffsetsEntry_DoNotUse;
+struct SubscribeRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal;
+extern SubscribeRequest_StartOffsetsEntry_DoNotUseDefaultTypeInternal _SubscribeRequest_StartOffsetsEntry_DoNotUse_default_instance_;
+class SubscriberStats;
+struct SubscriberStatsDefaultTypeInternal;
+extern SubscriberStatsDefaultTypeInternal _SubscriberStats_default_instance_;
+class TopicStats;
+struct TopicStatsDefaultTypeInternal;
+extern TopicStatsDefaultTypeInternal _TopicStats_default_instance_;
 PROTOBUF_NAMESPACE_OPEN
+template<> ::AckSettings* Arena::CreateMaybeMessage<::AckSettings>(Arena*);
+template<> ::DictionariesRequest* Arena::CreateMaybeMessage<::DictionariesRequest>(Arena*);
+template<> ::DictionariesResponse* Arena::CreateMaybeMessage<::DictionariesResponse>(Arena*);
+template<> ::Dictionary* Arena::CreateMaybeMessage<::Dictionary>(Arena*);
+template<> ::DispatcherThreadStats* Arena::CreateMaybeMessage<::DispatcherThreadStats>(Arena*);
+template<> ::LatencyHistogram* Arena::CreateMaybeMessage<::LatencyHistogram>(Arena*);
+template<> ::LatencyHistogram_Bucket* Arena::CreateMaybeMessage<::LatencyHistogram_Bucket>(Arena*);
 template<> ::Message* Arena::CreateMaybeMessage<::Message>(Arena*);
+template<> ::Message_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage<::Message_HeadersEntry_DoNotUse>(Arena*);
+template<> ::PublishAck* Arena::CreateMaybeMessage<::PublishAck>(Arena*);
 template<> ::ReceiveRequest* Arena::CreateMaybeMessage<::ReceiveRequest>(Arena*);
+template<> ::ReceiveRequest_FiltersEntry_DoNotUse* Arena::CreateMaybeMessage<::ReceiveRequest_FiltersEntry_DoNotUse>(Arena*);
+template<> ::ReceiveRequest_StartOffsetsEntry_DoNotUse* Arena::CreateMaybeMessage<::ReceiveRequest_StartOffsetsEntry_DoNotUse>(Arena*);
 template<> ::ReceiveResponse* Arena::CreateMaybeMessage<::ReceiveResponse>(Arena*);
+template<> ::ResolveRequest* Arena::CreateMaybeMessage<::ResolveRequest>(Arena*);
+template<> ::ResolveResponse* Arena::CreateMaybeMessage<::ResolveResponse>(Arena*);
 template<> ::SendRequest* Arena::CreateMaybeMessage<::SendRequest>(Arena*);
 template<> ::SendResponse* Arena::CreateMaybeMessage<::SendResponse>(Arena*);
+template<> ::StatsRequest* Arena::CreateMaybeMessage<::StatsRequest>(Arena*);
+template<> ::StatsResponse* Arena::CreateMaybeMessage<::StatsResponse>(Arena*);
+template<> ::SubscribeRequest* Arena::CreateMaybeMessage<::SubscribeRequest>(Arena*);
+template<> ::SubscribeRequest_FiltersEntry_DoNotUse* Arena::CreateMaybeMessage<::SubscribeRequest_FiltersEntry_DoNotUse>(Arena*);
+template<> ::SubscribeRequest_StartOffsetsEntry_DoNotUse* Arena::CreateMaybeMessage<::SubscribeRequest_StartOffsetsEntry_DoNotUse>(Arena*);
+template<> ::SubscriberStats* Arena::CreateMaybeMessage<::SubscriberStats>(Arena*);
+template<> ::TopicStats* Arena::CreateMaybeMessage<::TopicStats>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 
+enum ReceiveRequest_GroupBalancing : int {
+  ReceiveRequest_GroupBalancing_ROUND_ROBIN = 0,
+  ReceiveRequest_GroupBalancing_LEAST_OUTSTANDING = 1,
+  ReceiveRequest_GroupBalancing_ReceiveRequest_GroupBalancing_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ReceiveRequest_GroupBalancing_ReceiveRequest_GroupBalancing_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ReceiveRequest_GroupBalancing_IsValid(int value);
+constexpr ReceiveRequest_GroupBalancing ReceiveRequest_GroupBalancing_GroupBalancing_MIN = ReceiveRequest_GroupBalancing_ROUND_ROBIN;
+constexpr ReceiveRequest_GroupBalancing ReceiveRequest_GroupBalancing_GroupBalancing_MAX = ReceiveRequest_GroupBalancing_LEAST_OUTSTANDING;
+constexpr int ReceiveRequest_GroupBalancing_GroupBalancing_ARRAYSIZE = ReceiveRequest_GroupBalancing_GroupBalancing_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReceiveRequest_GroupBalancing_descriptor();
+template<typename T>
+inline const std::string& ReceiveRequest_GroupBalancing_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReceiveRequest_GroupBalancing>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReceiveRequest_GroupBalancing_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReceiveRequest_GroupBalancing_descriptor(), enum_t_value);
+}
+inline bool ReceiveRequest_GroupBalancing_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReceiveRequest_GroupBalancing* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReceiveRequest_GroupBalancing>(
+    ReceiveRequest_GroupBalancing_descriptor(), name, value);
+}
+enum ReceiveRequest_Compression : int {
+  ReceiveRequest_Compression_UNCOMPRESSED = 0,
+  ReceiveRequest_Compression_DEFLATE = 1,
+  ReceiveRequest_Compression_ReceiveRequest_Compression_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ReceiveRequest_Compression_ReceiveRequest_Compression_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ReceiveRequest_Compression_IsValid(int value);
+constexpr ReceiveRequest_Compression ReceiveRequest_Compression_Compression_MIN = ReceiveRequest_Compression_UNCOMPRESSED;
+constexpr ReceiveRequest_Compression ReceiveRequest_Compression_Compression_MAX = ReceiveRequest_Compression_DEFLATE;
+constexpr int ReceiveRequest_Compression_Compression_ARRAYSIZE = ReceiveRequest_Compression_Compression_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReceiveRequest_Compression_descriptor();
+template<typename T>
+inline const std::string& ReceiveRequest_Compression_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReceiveRequest_Compression>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReceiveRequest_Compression_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReceiveRequest_Compression_descriptor(), enum_t_value);
+}
+inline bool ReceiveRequest_Compression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReceiveRequest_Compression* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReceiveRequest_Compression>(
+    ReceiveRequest_Compression_descriptor(), name, value);
+}
+enum ReceiveRequest_OverflowPolicy : int {
+  ReceiveRequest_OverflowPolicy_DROP_OLDEST = 0,
+  ReceiveRequest_OverflowPolicy_DROP_NEWEST = 1,
+  ReceiveRequest_OverflowPolicy_CONFLATE = 2,
+  ReceiveRequest_OverflowPolicy_DISCONNECT = 3,
+  ReceiveRequest_OverflowPolicy_ReceiveRequest_OverflowPolicy_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ReceiveRequest_OverflowPolicy_ReceiveRequest_OverflowPolicy_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ReceiveRequest_OverflowPolicy_IsValid(int value);
+constexpr ReceiveRequest_OverflowPolicy ReceiveRequest_OverflowPolicy_OverflowPolicy_MIN = ReceiveRequest_OverflowPolicy_DROP_OLDEST;
+constexpr ReceiveRequest_OverflowPolicy ReceiveRequest_OverflowPolicy_OverflowPolicy_MAX = ReceiveRequest_OverflowPolicy_DISCONNECT;
+constexpr int ReceiveRequest_OverflowPolicy_OverflowPolicy_ARRAYSIZE = ReceiveRequest_OverflowPolicy_OverflowPolicy_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReceiveRequest_OverflowPolicy_descriptor();
+template<typename T>
+inline const std::string& ReceiveRequest_OverflowPolicy_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReceiveRequest_OverflowPolicy>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReceiveRequest_OverflowPolicy_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReceiveRequest_OverflowPolicy_descriptor(), enum_t_value);
+}
+inline bool ReceiveRequest_OverflowPolicy_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReceiveRequest_OverflowPolicy* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReceiveRequest_OverflowPolicy>(
+    ReceiveRequest_OverflowPolicy_descriptor(), name, value);
+}
+enum ReceiveRequest_Conflation : int {
+  ReceiveRequest_Conflation_NO_CONFLATION = 0,
+  ReceiveRequest_Conflation_BY_TOPIC = 1,
+  ReceiveRequest_Conflation_BY_TOPIC_AND_KEY = 2,
+  ReceiveRequest_Conflation_ReceiveRequest_Conflation_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ReceiveRequest_Conflation_ReceiveRequest_Conflation_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool ReceiveRequest_Conflation_IsValid(int value);
+constexpr ReceiveRequest_Conflation ReceiveRequest_Conflation_Conflation_MIN = ReceiveRequest_Conflation_NO_CONFLATION;
+constexpr ReceiveRequest_Conflation ReceiveRequest_Conflation_Conflation_MAX = ReceiveRequest_Conflation_BY_TOPIC_AND_KEY;
+constexpr int ReceiveRequest_Conflation_Conflation_ARRAYSIZE = ReceiveRequest_Conflation_Conflation_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReceiveRequest_Conflation_descriptor();
+template<typename T>
+inline const std::string& ReceiveRequest_Conflation_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReceiveRequest_Conflation>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReceiveRequest_Conflation_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReceiveRequest_Conflation_descriptor(), enum_t_value);
+}
+inline bool ReceiveRequest_Conflation_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReceiveRequest_Conflation* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReceiveRequest_Conflation>(
+    ReceiveRequest_Conflation_descriptor(), name, value);
+}
 // ===================================================================
 
-class Message PROTOBUF_FINAL :
+class Message_HeadersEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Message_HeadersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Message_HeadersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  Message_HeadersEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Message_HeadersEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit Message_HeadersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const Message_HeadersEntry_DoNotUse& other);
+  static const Message_HeadersEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Message_HeadersEntry_DoNotUse*>(&_Message_HeadersEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "Message.HeadersEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "Message.HeadersEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_broker_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class Message final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Message) */ {
  public:
   inline Message() : Message(nullptr) {}
-  virtual ~Message();
-  explicit constexpr Message(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  ~Message() override;
+  explicit PROTOBUF_CONSTEXPR Message(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Message(const Message& from);
   Message(Message&& from) noexcept
@@ -97,8 +303,13 @@ class Message PROTOBUF_FINAL :
     return *this;
   }
   inline Message& operator=(Message&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -109,10 +320,10 @@ class Message PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
   static const Message& default_instance() {
     return *internal_default_instance();
@@ -122,14 +333,19 @@ class Message PROTOBUF_FINAL :
                &_Message_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    0;
+    1;
 
   friend void swap(Message& a, Message& b) {
     a.Swap(&b);
   }
   inline void Swap(Message* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -137,96 +353,200 @@ class Message PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Message* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Message* New() const final {
-    return CreateMaybeMessage<Message>(nullptr);
-  }
-
-  Message* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Message* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Message>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Message& from);
-  void MergeFrom(const Message& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message& from) {
+    Message::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Message* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "Message";
   }
   protected:
-  explicit Message(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    return ::descriptor_table_broker_2eproto_metadata_getter(kIndexInFileMessages);
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
+
   // accessors -------------------------------------------------------
 
   enum : int {
+    kHeadersFieldNumber = 10,
     kTopicFieldNumber = 1,
     kContentFieldNumber = 2,
+    kKeyFieldNumber = 5,
+    kDeflatedFieldNumber = 7,
+    kOriginFieldNumber = 9,
+    kTopicIdFieldNumber = 3,
+    kOffsetFieldNumber = 4,
+    kRetainFieldNumber = 6,
+    kDictionaryFieldNumber = 8,
   };
+  // map<string, string> headers = 10;
+  int headers_size() const;
+  private:
+  int _internal_headers_size() const;
+  public:
+  void clear_headers();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_headers() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_headers();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      headers() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_headers();
+
   // string topic = 1;
   void clear_topic();
   const std::string& topic() const;
-  void set_topic(const std::string& value);
-  void set_topic(std::string&& value);
-  void set_topic(const char* value);
-  void set_topic(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_topic(ArgT0&& arg0, ArgT... args);
   std::string* mutable_topic();
-  std::string* release_topic();
+  PROTOBUF_NODISCARD std::string* release_topic();
   void set_allocated_topic(std::string* topic);
   private:
   const std::string& _internal_topic() const;
-  void _internal_set_topic(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_topic(const std::string& value);
   std::string* _internal_mutable_topic();
   public:
 
-  // string content = 2;
+  // bytes content = 2;
   void clear_content();
   const std::string& content() const;
-  void set_content(const std::string& value);
-  void set_content(std::string&& value);
-  void set_content(const char* value);
-  void set_content(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
   std::string* mutable_content();
-  std::string* release_content();
+  PROTOBUF_NODISCARD std::string* release_content();
   void set_allocated_content(std::string* content);
   private:
   const std::string& _internal_content() const;
-  void _internal_set_content(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
   std::string* _internal_mutable_content();
   public:
 
+  // string key = 5;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes deflated = 7;
+  void clear_deflated();
+  const std::string& deflated() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_deflated(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_deflated();
+  PROTOBUF_NODISCARD std::string* release_deflated();
+  void set_allocated_deflated(std::string* deflated);
+  private:
+  const std::string& _internal_deflated() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_deflated(const std::string& value);
+  std::string* _internal_mutable_deflated();
+  public:
+
+  // string origin = 9;
+  void clear_origin();
+  const std::string& origin() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_origin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_origin();
+  PROTOBUF_NODISCARD std::string* release_origin();
+  void set_allocated_origin(std::string* origin);
+  private:
+  const std::string& _internal_origin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_origin(const std::string& value);
+  std::string* _internal_mutable_origin();
+  public:
+
+  // uint64 topic_id = 3;
+  void clear_topic_id();
+  uint64_t topic_id() const;
+  void set_topic_id(uint64_t value);
+  private:
+  uint64_t _internal_topic_id() const;
+  void _internal_set_topic_id(uint64_t value);
+  public:
+
+  // optional uint64 offset = 4;
+  bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // bool retain = 6;
+  void clear_retain();
+  bool retain() const;
+  void set_retain(bool value);
+  private:
+  bool _internal_retain() const;
+  void _internal_set_retain(bool value);
+  public:
+
+  // uint32 dictionary = 8;
+  void clear_dictionary();
+  uint32_t dictionary() const;
+  void set_dictionary(uint32_t value);
+  private:
+  uint32_t _internal_dictionary() const;
+  void _internal_set_dictionary(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:Message)
  private:
   class _Internal;
@@ -234,19 +554,35 @@ class Message PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr topic_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Message_HeadersEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> headers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr topic_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr deflated_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr origin_;
+    uint64_t topic_id_;
+    uint64_t offset_;
+    bool retain_;
+    uint32_t dictionary_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_broker_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SendRequest PROTOBUF_FINAL :
+class SendRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SendRequest) */ {
  public:
   inline SendRequest() : SendRequest(nullptr) {}
-  virtual ~SendRequest();
-  explicit constexpr SendRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  ~SendRequest() override;
+  explicit PROTOBUF_CONSTEXPR SendRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SendRequest(const SendRequest& from);
   SendRequest(SendRequest&& from) noexcept
@@ -259,8 +595,13 @@ class SendRequest PROTOBUF_FINAL :
     return *this;
   }
   inline SendRequest& operator=(SendRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -271,10 +612,10 @@ class SendRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
   static const SendRequest& default_instance() {
     return *internal_default_instance();
@@ -284,14 +625,19 @@ class SendRequest PROTOBUF_FINAL :
                &_SendRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    2;
 
   friend void swap(SendRequest& a, SendRequest& b) {
     a.Swap(&b);
   }
   inline void Swap(SendRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -299,55 +645,53 @@ class SendRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(SendRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SendRequest* New() const final {
-    return CreateMaybeMessage<SendRequest>(nullptr);
-  }
-
-  SendRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  SendRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<SendRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SendRequest& from);
-  void MergeFrom(const SendRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendRequest& from) {
+    SendRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(SendRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "SendRequest";
   }
   protected:
-  explicit SendRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit SendRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    return ::descriptor_table_broker_2eproto_metadata_getter(kIndexInFileMessages);
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -381,18 +725,20 @@ class SendRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Message > messages_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Message > messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_broker_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SendResponse PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SendResponse) */ {
+class SendResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:SendResponse) */ {
  public:
   inline SendResponse() : SendResponse(nullptr) {}
-  virtual ~SendResponse();
-  explicit constexpr SendResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR SendResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   SendResponse(const SendResponse& from);
   SendResponse(SendResponse&& from) noexcept
@@ -405,8 +751,13 @@ class SendResponse PROTOBUF_FINAL :
     return *this;
   }
   inline SendResponse& operator=(SendResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -417,10 +768,10 @@ class SendResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
   static const SendResponse& default_instance() {
     return *internal_default_instance();
@@ -430,14 +781,19 @@ class SendResponse PROTOBUF_FINAL :
                &_SendResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(SendResponse& a, SendResponse& b) {
     a.Swap(&b);
   }
   inline void Swap(SendResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -445,92 +801,230 @@ class SendResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(SendResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SendResponse* New() const final {
-    return CreateMaybeMessage<SendResponse>(nullptr);
+  SendResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SendResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const SendResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
   }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const SendResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
 
-  SendResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<SendResponse>(arena);
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SendResponse";
+  }
+  protected:
+  explicit SendResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:SendResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PublishAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:PublishAck) */ {
+ public:
+  inline PublishAck() : PublishAck(nullptr) {}
+  ~PublishAck() override;
+  explicit PROTOBUF_CONSTEXPR PublishAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PublishAck(const PublishAck& from);
+  PublishAck(PublishAck&& from) noexcept
+    : PublishAck() {
+    *this = ::std::move(from);
+  }
+
+  inline PublishAck& operator=(const PublishAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PublishAck& operator=(PublishAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const SendResponse& from);
-  void MergeFrom(const SendResponse& from);
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PublishAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PublishAck* internal_default_instance() {
+    return reinterpret_cast<const PublishAck*>(
+               &_PublishAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(PublishAck& a, PublishAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PublishAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PublishAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PublishAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PublishAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PublishAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PublishAck& from) {
+    PublishAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SendResponse* other);
+  void InternalSwap(PublishAck* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "SendResponse";
+    return "PublishAck";
   }
   protected:
-  explicit SendResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit PublishAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    return ::descriptor_table_broker_2eproto_metadata_getter(kIndexInFileMessages);
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:SendResponse)
+  enum : int {
+    kAcknowledgedFieldNumber = 1,
+  };
+  // uint64 acknowledged = 1;
+  void clear_acknowledged();
+  uint64_t acknowledged() const;
+  void set_acknowledged(uint64_t value);
+  private:
+  uint64_t _internal_acknowledged() const;
+  void _internal_set_acknowledged(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:PublishAck)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint64_t acknowledged_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_broker_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReceiveRequest PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReceiveRequest) */ {
+class ResolveRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ResolveRequest) */ {
  public:
-  inline ReceiveRequest() : ReceiveRequest(nullptr) {}
-  virtual ~ReceiveRequest();
-  explicit constexpr ReceiveRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ResolveRequest() : ResolveRequest(nullptr) {}
+  ~ResolveRequest() override;
+  explicit PROTOBUF_CONSTEXPR ResolveRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ReceiveRequest(const ReceiveRequest& from);
-  ReceiveRequest(ReceiveRequest&& from) noexcept
-    : ReceiveRequest() {
+  ResolveRequest(const ResolveRequest& from);
+  ResolveRequest(ResolveRequest&& from) noexcept
+    : ResolveRequest() {
     *this = ::std::move(from);
   }
 
-  inline ReceiveRequest& operator=(const ReceiveRequest& from) {
+  inline ResolveRequest& operator=(const ResolveRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ReceiveRequest& operator=(ReceiveRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline ResolveRequest& operator=(ResolveRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -541,83 +1035,86 @@ class ReceiveRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const ReceiveRequest& default_instance() {
+  static const ResolveRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ReceiveRequest* internal_default_instance() {
-    return reinterpret_cast<const ReceiveRequest*>(
-               &_ReceiveRequest_default_instance_);
+  static inline const ResolveRequest* internal_default_instance() {
+    return reinterpret_cast<const ResolveRequest*>(
+               &_ResolveRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    5;
 
-  friend void swap(ReceiveRequest& a, ReceiveRequest& b) {
+  friend void swap(ResolveRequest& a, ResolveRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ReceiveRequest* other) {
+  inline void Swap(ResolveRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ReceiveRequest* other) {
+  void UnsafeArenaSwap(ResolveRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ReceiveRequest* New() const final {
-    return CreateMaybeMessage<ReceiveRequest>(nullptr);
+  ResolveRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResolveRequest>(arena);
   }
-
-  ReceiveRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ReceiveRequest>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResolveRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResolveRequest& from) {
+    ResolveRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ReceiveRequest& from);
-  void MergeFrom(const ReceiveRequest& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ReceiveRequest* other);
+  void InternalSwap(ResolveRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "ReceiveRequest";
+    return "ResolveRequest";
   }
   protected:
-  explicit ReceiveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ResolveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    return ::descriptor_table_broker_2eproto_metadata_getter(kIndexInFileMessages);
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -650,39 +1147,47 @@ class ReceiveRequest PROTOBUF_FINAL :
   std::string* _internal_add_topics();
   public:
 
-  // @@protoc_insertion_point(class_scope:ReceiveRequest)
+  // @@protoc_insertion_point(class_scope:ResolveRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> topics_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> topics_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_broker_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReceiveResponse PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReceiveResponse) */ {
+class ResolveResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ResolveResponse) */ {
  public:
-  inline ReceiveResponse() : ReceiveResponse(nullptr) {}
-  virtual ~ReceiveResponse();
-  explicit constexpr ReceiveResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ResolveResponse() : ResolveResponse(nullptr) {}
+  ~ResolveResponse() override;
+  explicit PROTOBUF_CONSTEXPR ResolveResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ReceiveResponse(const ReceiveResponse& from);
-  ReceiveResponse(ReceiveResponse&& from) noexcept
-    : ReceiveResponse() {
+  ResolveResponse(const ResolveResponse& from);
+  ResolveResponse(ResolveResponse&& from) noexcept
+    : ResolveResponse() {
     *this = ::std::move(from);
   }
 
-  inline ReceiveResponse& operator=(const ReceiveResponse& from) {
+  inline ResolveResponse& operator=(const ResolveResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ReceiveResponse& operator=(ReceiveResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline ResolveResponse& operator=(ResolveResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -693,463 +1198,5966 @@ class ReceiveResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const ReceiveResponse& default_instance() {
+  static const ResolveResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ReceiveResponse* internal_default_instance() {
-    return reinterpret_cast<const ReceiveResponse*>(
-               &_ReceiveResponse_default_instance_);
+  static inline const ResolveResponse* internal_default_instance() {
+    return reinterpret_cast<const ResolveResponse*>(
+               &_ResolveResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    6;
 
-  friend void swap(ReceiveResponse& a, ReceiveResponse& b) {
+  friend void swap(ResolveResponse& a, ResolveResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(ReceiveResponse* other) {
+  inline void Swap(ResolveResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ReceiveResponse* other) {
+  void UnsafeArenaSwap(ResolveResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ReceiveResponse* New() const final {
-    return CreateMaybeMessage<ReceiveResponse>(nullptr);
+  ResolveResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResolveResponse>(arena);
   }
-
-  ReceiveResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ReceiveResponse>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResolveResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResolveResponse& from) {
+    ResolveResponse::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ReceiveResponse& from);
-  void MergeFrom(const ReceiveResponse& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ReceiveResponse* other);
+  void InternalSwap(ResolveResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "ReceiveResponse";
+    return "ResolveResponse";
   }
   protected:
-  explicit ReceiveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ResolveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    return ::descriptor_table_broker_2eproto_metadata_getter(kIndexInFileMessages);
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageFieldNumber = 1,
+    kTopicIdsFieldNumber = 1,
   };
-  // .Message message = 1;
-  bool has_message() const;
+  // repeated uint64 topic_ids = 1;
+  int topic_ids_size() const;
   private:
-  bool _internal_has_message() const;
+  int _internal_topic_ids_size() const;
   public:
-  void clear_message();
-  const ::Message& message() const;
-  ::Message* release_message();
-  ::Message* mutable_message();
-  void set_allocated_message(::Message* message);
+  void clear_topic_ids();
   private:
-  const ::Message& _internal_message() const;
-  ::Message* _internal_mutable_message();
+  uint64_t _internal_topic_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_topic_ids() const;
+  void _internal_add_topic_ids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_topic_ids();
   public:
-  void unsafe_arena_set_allocated_message(
-      ::Message* message);
-  ::Message* unsafe_arena_release_message();
+  uint64_t topic_ids(int index) const;
+  void set_topic_ids(int index, uint64_t value);
+  void add_topic_ids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      topic_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_topic_ids();
 
-  // @@protoc_insertion_point(class_scope:ReceiveResponse)
+  // @@protoc_insertion_point(class_scope:ResolveResponse)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::Message* message_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > topic_ids_;
+    mutable std::atomic<int> _topic_ids_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_broker_2eproto;
 };
+// -------------------------------------------------------------------
+
+class ReceiveRequest_StartOffsetsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<ReceiveRequest_StartOffsetsEntry_DoNotUse, 
+    std::string, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<ReceiveRequest_StartOffsetsEntry_DoNotUse, 
+    std::string, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> SuperType;
+  ReceiveRequest_StartOffsetsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR ReceiveRequest_StartOffsetsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit ReceiveRequest_StartOffsetsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const ReceiveRequest_StartOffsetsEntry_DoNotUse& other);
+  static const ReceiveRequest_StartOffsetsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const ReceiveRequest_StartOffsetsEntry_DoNotUse*>(&_ReceiveRequest_StartOffsetsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "ReceiveRequest.StartOffsetsEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_broker_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class ReceiveRequest_FiltersEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<ReceiveRequest_FiltersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<ReceiveRequest_FiltersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  ReceiveRequest_FiltersEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR ReceiveRequest_FiltersEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit ReceiveRequest_FiltersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const ReceiveRequest_FiltersEntry_DoNotUse& other);
+  static const ReceiveRequest_FiltersEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const ReceiveRequest_FiltersEntry_DoNotUse*>(&_ReceiveRequest_FiltersEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "ReceiveRequest.FiltersEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "ReceiveRequest.FiltersEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_broker_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class ReceiveRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReceiveRequest) */ {
+ public:
+  inline ReceiveRequest() : ReceiveRequest(nullptr) {}
+  ~ReceiveRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReceiveRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReceiveRequest(const ReceiveRequest& from);
+  ReceiveRequest(ReceiveRequest&& from) noexcept
+    : ReceiveRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReceiveRequest& operator=(const ReceiveRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReceiveRequest& operator=(ReceiveRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReceiveRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReceiveRequest* internal_default_instance() {
+    return reinterpret_cast<const ReceiveRequest*>(
+               &_ReceiveRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(ReceiveRequest& a, ReceiveRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReceiveRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReceiveRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReceiveRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReceiveRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReceiveRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReceiveRequest& from) {
+    ReceiveRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReceiveRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReceiveRequest";
+  }
+  protected:
+  explicit ReceiveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  typedef ReceiveRequest_GroupBalancing GroupBalancing;
+  static constexpr GroupBalancing ROUND_ROBIN =
+    ReceiveRequest_GroupBalancing_ROUND_ROBIN;
+  static constexpr GroupBalancing LEAST_OUTSTANDING =
+    ReceiveRequest_GroupBalancing_LEAST_OUTSTANDING;
+  static inline bool GroupBalancing_IsValid(int value) {
+    return ReceiveRequest_GroupBalancing_IsValid(value);
+  }
+  static constexpr GroupBalancing GroupBalancing_MIN =
+    ReceiveRequest_GroupBalancing_GroupBalancing_MIN;
+  static constexpr GroupBalancing GroupBalancing_MAX =
+    ReceiveRequest_GroupBalancing_GroupBalancing_MAX;
+  static constexpr int GroupBalancing_ARRAYSIZE =
+    ReceiveRequest_GroupBalancing_GroupBalancing_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  GroupBalancing_descriptor() {
+    return ReceiveRequest_GroupBalancing_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& GroupBalancing_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, GroupBalancing>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function GroupBalancing_Name.");
+    return ReceiveRequest_GroupBalancing_Name(enum_t_value);
+  }
+  static inline bool GroupBalancing_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      GroupBalancing* value) {
+    return ReceiveRequest_GroupBalancing_Parse(name, value);
+  }
+
+  typedef ReceiveRequest_Compression Compression;
+  static constexpr Compression UNCOMPRESSED =
+    ReceiveRequest_Compression_UNCOMPRESSED;
+  static constexpr Compression DEFLATE =
+    ReceiveRequest_Compression_DEFLATE;
+  static inline bool Compression_IsValid(int value) {
+    return ReceiveRequest_Compression_IsValid(value);
+  }
+  static constexpr Compression Compression_MIN =
+    ReceiveRequest_Compression_Compression_MIN;
+  static constexpr Compression Compression_MAX =
+    ReceiveRequest_Compression_Compression_MAX;
+  static constexpr int Compression_ARRAYSIZE =
+    ReceiveRequest_Compression_Compression_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Compression_descriptor() {
+    return ReceiveRequest_Compression_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Compression_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Compression>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Compression_Name.");
+    return ReceiveRequest_Compression_Name(enum_t_value);
+  }
+  static inline bool Compression_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Compression* value) {
+    return ReceiveRequest_Compression_Parse(name, value);
+  }
+
+  typedef ReceiveRequest_OverflowPolicy OverflowPolicy;
+  static constexpr OverflowPolicy DROP_OLDEST =
+    ReceiveRequest_OverflowPolicy_DROP_OLDEST;
+  static constexpr OverflowPolicy DROP_NEWEST =
+    ReceiveRequest_OverflowPolicy_DROP_NEWEST;
+  static constexpr OverflowPolicy CONFLATE =
+    ReceiveRequest_OverflowPolicy_CONFLATE;
+  static constexpr OverflowPolicy DISCONNECT =
+    ReceiveRequest_OverflowPolicy_DISCONNECT;
+  static inline bool OverflowPolicy_IsValid(int value) {
+    return ReceiveRequest_OverflowPolicy_IsValid(value);
+  }
+  static constexpr OverflowPolicy OverflowPolicy_MIN =
+    ReceiveRequest_OverflowPolicy_OverflowPolicy_MIN;
+  static constexpr OverflowPolicy OverflowPolicy_MAX =
+    ReceiveRequest_OverflowPolicy_OverflowPolicy_MAX;
+  static constexpr int OverflowPolicy_ARRAYSIZE =
+    ReceiveRequest_OverflowPolicy_OverflowPolicy_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  OverflowPolicy_descriptor() {
+    return ReceiveRequest_OverflowPolicy_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& OverflowPolicy_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, OverflowPolicy>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function OverflowPolicy_Name.");
+    return ReceiveRequest_OverflowPolicy_Name(enum_t_value);
+  }
+  static inline bool OverflowPolicy_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      OverflowPolicy* value) {
+    return ReceiveRequest_OverflowPolicy_Parse(name, value);
+  }
+
+  typedef ReceiveRequest_Conflation Conflation;
+  static constexpr Conflation NO_CONFLATION =
+    ReceiveRequest_Conflation_NO_CONFLATION;
+  static constexpr Conflation BY_TOPIC =
+    ReceiveRequest_Conflation_BY_TOPIC;
+  static constexpr Conflation BY_TOPIC_AND_KEY =
+    ReceiveRequest_Conflation_BY_TOPIC_AND_KEY;
+  static inline bool Conflation_IsValid(int value) {
+    return ReceiveRequest_Conflation_IsValid(value);
+  }
+  static constexpr Conflation Conflation_MIN =
+    ReceiveRequest_Conflation_Conflation_MIN;
+  static constexpr Conflation Conflation_MAX =
+    ReceiveRequest_Conflation_Conflation_MAX;
+  static constexpr int Conflation_ARRAYSIZE =
+    ReceiveRequest_Conflation_Conflation_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Conflation_descriptor() {
+    return ReceiveRequest_Conflation_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Conflation_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Conflation>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Conflation_Name.");
+    return ReceiveRequest_Conflation_Name(enum_t_value);
+  }
+  static inline bool Conflation_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Conflation* value) {
+    return ReceiveRequest_Conflation_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTopicsFieldNumber = 1,
+    kStartOffsetsFieldNumber = 6,
+    kFiltersFieldNumber = 13,
+    kGroupFieldNumber = 7,
+    kFederationPeerFieldNumber = 10,
+    kMaxBatchFieldNumber = 2,
+    kLingerUsFieldNumber = 3,
+    kMaxQueueFieldNumber = 4,
+    kOverflowPolicyFieldNumber = 5,
+    kGroupBalancingFieldNumber = 8,
+    kCompressionFieldNumber = 9,
+    kConflationFieldNumber = 11,
+    kMaxRateFieldNumber = 12,
+  };
+  // repeated string topics = 1;
+  int topics_size() const;
+  private:
+  int _internal_topics_size() const;
+  public:
+  void clear_topics();
+  const std::string& topics(int index) const;
+  std::string* mutable_topics(int index);
+  void set_topics(int index, const std::string& value);
+  void set_topics(int index, std::string&& value);
+  void set_topics(int index, const char* value);
+  void set_topics(int index, const char* value, size_t size);
+  std::string* add_topics();
+  void add_topics(const std::string& value);
+  void add_topics(std::string&& value);
+  void add_topics(const char* value);
+  void add_topics(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& topics() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_topics();
+  private:
+  const std::string& _internal_topics(int index) const;
+  std::string* _internal_add_topics();
+  public:
+
+  // map<string, uint64> start_offsets = 6;
+  int start_offsets_size() const;
+  private:
+  int _internal_start_offsets_size() const;
+  public:
+  void clear_start_offsets();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+      _internal_start_offsets() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+      _internal_mutable_start_offsets();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+      start_offsets() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+      mutable_start_offsets();
+
+  // map<string, string> filters = 13;
+  int filters_size() const;
+  private:
+  int _internal_filters_size() const;
+  public:
+  void clear_filters();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_filters() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_filters();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      filters() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_filters();
+
+  // string group = 7;
+  void clear_group();
+  const std::string& group() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_group(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_group();
+  PROTOBUF_NODISCARD std::string* release_group();
+  void set_allocated_group(std::string* group);
+  private:
+  const std::string& _internal_group() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_group(const std::string& value);
+  std::string* _internal_mutable_group();
+  public:
+
+  // string federation_peer = 10;
+  void clear_federation_peer();
+  const std::string& federation_peer() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_federation_peer(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_federation_peer();
+  PROTOBUF_NODISCARD std::string* release_federation_peer();
+  void set_allocated_federation_peer(std::string* federation_peer);
+  private:
+  const std::string& _internal_federation_peer() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_federation_peer(const std::string& value);
+  std::string* _internal_mutable_federation_peer();
+  public:
+
+  // uint32 max_batch = 2;
+  void clear_max_batch();
+  uint32_t max_batch() const;
+  void set_max_batch(uint32_t value);
+  private:
+  uint32_t _internal_max_batch() const;
+  void _internal_set_max_batch(uint32_t value);
+  public:
+
+  // uint32 linger_us = 3;
+  void clear_linger_us();
+  uint32_t linger_us() const;
+  void set_linger_us(uint32_t value);
+  private:
+  uint32_t _internal_linger_us() const;
+  void _internal_set_linger_us(uint32_t value);
+  public:
+
+  // uint32 max_queue = 4;
+  void clear_max_queue();
+  uint32_t max_queue() const;
+  void set_max_queue(uint32_t value);
+  private:
+  uint32_t _internal_max_queue() const;
+  void _internal_set_max_queue(uint32_t value);
+  public:
+
+  // .ReceiveRequest.OverflowPolicy overflow_policy = 5;
+  void clear_overflow_policy();
+  ::ReceiveRequest_OverflowPolicy overflow_policy() const;
+  void set_overflow_policy(::ReceiveRequest_OverflowPolicy value);
+  private:
+  ::ReceiveRequest_OverflowPolicy _internal_overflow_policy() const;
+  void _internal_set_overflow_policy(::ReceiveRequest_OverflowPolicy value);
+  public:
+
+  // .ReceiveRequest.GroupBalancing group_balancing = 8;
+  void clear_group_balancing();
+  ::ReceiveRequest_GroupBalancing group_balancing() const;
+  void set_group_balancing(::ReceiveRequest_GroupBalancing value);
+  private:
+  ::ReceiveRequest_GroupBalancing _internal_group_balancing() const;
+  void _internal_set_group_balancing(::ReceiveRequest_GroupBalancing value);
+  public:
+
+  // .ReceiveRequest.Compression compression = 9;
+  void clear_compression();
+  ::ReceiveRequest_Compression compression() const;
+  void set_compression(::ReceiveRequest_Compression value);
+  private:
+  ::ReceiveRequest_Compression _internal_compression() const;
+  void _internal_set_compression(::ReceiveRequest_Compression value);
+  public:
+
+  // .ReceiveRequest.Conflation conflation = 11;
+  void clear_conflation();
+  ::ReceiveRequest_Conflation conflation() const;
+  void set_conflation(::ReceiveRequest_Conflation value);
+  private:
+  ::ReceiveRequest_Conflation _internal_conflation() const;
+  void _internal_set_conflation(::ReceiveRequest_Conflation value);
+  public:
+
+  // uint32 max_rate = 12;
+  void clear_max_rate();
+  uint32_t max_rate() const;
+  void set_max_rate(uint32_t value);
+  private:
+  uint32_t _internal_max_rate() const;
+  void _internal_set_max_rate(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReceiveRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> topics_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        ReceiveRequest_StartOffsetsEntry_DoNotUse,
+        std::string, uint64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> start_offsets_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        ReceiveRequest_FiltersEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> filters_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr group_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr federation_peer_;
+    uint32_t max_batch_;
+    uint32_t linger_us_;
+    uint32_t max_queue_;
+    int overflow_policy_;
+    int group_balancing_;
+    int compression_;
+    int conflation_;
+    uint32_t max_rate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubscribeRequest_StartOffsetsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SubscribeRequest_StartOffsetsEntry_DoNotUse, 
+    std::string, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SubscribeRequest_StartOffsetsEntry_DoNotUse, 
+    std::string, uint64_t,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> SuperType;
+  SubscribeRequest_StartOffsetsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR SubscribeRequest_StartOffsetsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit SubscribeRequest_StartOffsetsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const SubscribeRequest_StartOffsetsEntry_DoNotUse& other);
+  static const SubscribeRequest_StartOffsetsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const SubscribeRequest_StartOffsetsEntry_DoNotUse*>(&_SubscribeRequest_StartOffsetsEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "SubscribeRequest.StartOffsetsEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_broker_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class SubscribeRequest_FiltersEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SubscribeRequest_FiltersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SubscribeRequest_FiltersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  SubscribeRequest_FiltersEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR SubscribeRequest_FiltersEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit SubscribeRequest_FiltersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const SubscribeRequest_FiltersEntry_DoNotUse& other);
+  static const SubscribeRequest_FiltersEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const SubscribeRequest_FiltersEntry_DoNotUse*>(&_SubscribeRequest_FiltersEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "SubscribeRequest.FiltersEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "SubscribeRequest.FiltersEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_broker_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class SubscribeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SubscribeRequest) */ {
+ public:
+  inline SubscribeRequest() : SubscribeRequest(nullptr) {}
+  ~SubscribeRequest() override;
+  explicit PROTOBUF_CONSTEXPR SubscribeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubscribeRequest(const SubscribeRequest& from);
+  SubscribeRequest(SubscribeRequest&& from) noexcept
+    : SubscribeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SubscribeRequest& operator=(const SubscribeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubscribeRequest& operator=(SubscribeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubscribeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubscribeRequest* internal_default_instance() {
+    return reinterpret_cast<const SubscribeRequest*>(
+               &_SubscribeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(SubscribeRequest& a, SubscribeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubscribeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubscribeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubscribeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubscribeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SubscribeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubscribeRequest& from) {
+    SubscribeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SubscribeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SubscribeRequest";
+  }
+  protected:
+  explicit SubscribeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSubscribeFieldNumber = 1,
+    kUnsubscribeFieldNumber = 2,
+    kStartOffsetsFieldNumber = 3,
+    kFiltersFieldNumber = 7,
+    kDeliveryFieldNumber = 4,
+    kAcksFieldNumber = 5,
+    kAckFieldNumber = 6,
+  };
+  // repeated string subscribe = 1;
+  int subscribe_size() const;
+  private:
+  int _internal_subscribe_size() const;
+  public:
+  void clear_subscribe();
+  const std::string& subscribe(int index) const;
+  std::string* mutable_subscribe(int index);
+  void set_subscribe(int index, const std::string& value);
+  void set_subscribe(int index, std::string&& value);
+  void set_subscribe(int index, const char* value);
+  void set_subscribe(int index, const char* value, size_t size);
+  std::string* add_subscribe();
+  void add_subscribe(const std::string& value);
+  void add_subscribe(std::string&& value);
+  void add_subscribe(const char* value);
+  void add_subscribe(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& subscribe() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_subscribe();
+  private:
+  const std::string& _internal_subscribe(int index) const;
+  std::string* _internal_add_subscribe();
+  public:
+
+  // repeated string unsubscribe = 2;
+  int unsubscribe_size() const;
+  private:
+  int _internal_unsubscribe_size() const;
+  public:
+  void clear_unsubscribe();
+  const std::string& unsubscribe(int index) const;
+  std::string* mutable_unsubscribe(int index);
+  void set_unsubscribe(int index, const std::string& value);
+  void set_unsubscribe(int index, std::string&& value);
+  void set_unsubscribe(int index, const char* value);
+  void set_unsubscribe(int index, const char* value, size_t size);
+  std::string* add_unsubscribe();
+  void add_unsubscribe(const std::string& value);
+  void add_unsubscribe(std::string&& value);
+  void add_unsubscribe(const char* value);
+  void add_unsubscribe(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& unsubscribe() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_unsubscribe();
+  private:
+  const std::string& _internal_unsubscribe(int index) const;
+  std::string* _internal_add_unsubscribe();
+  public:
+
+  // map<string, uint64> start_offsets = 3;
+  int start_offsets_size() const;
+  private:
+  int _internal_start_offsets_size() const;
+  public:
+  void clear_start_offsets();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+      _internal_start_offsets() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+      _internal_mutable_start_offsets();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+      start_offsets() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+      mutable_start_offsets();
+
+  // map<string, string> filters = 7;
+  int filters_size() const;
+  private:
+  int _internal_filters_size() const;
+  public:
+  void clear_filters();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_filters() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_filters();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      filters() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_filters();
+
+  // .ReceiveRequest delivery = 4;
+  bool has_delivery() const;
+  private:
+  bool _internal_has_delivery() const;
+  public:
+  void clear_delivery();
+  const ::ReceiveRequest& delivery() const;
+  PROTOBUF_NODISCARD ::ReceiveRequest* release_delivery();
+  ::ReceiveRequest* mutable_delivery();
+  void set_allocated_delivery(::ReceiveRequest* delivery);
+  private:
+  const ::ReceiveRequest& _internal_delivery() const;
+  ::ReceiveRequest* _internal_mutable_delivery();
+  public:
+  void unsafe_arena_set_allocated_delivery(
+      ::ReceiveRequest* delivery);
+  ::ReceiveRequest* unsafe_arena_release_delivery();
+
+  // .AckSettings acks = 5;
+  bool has_acks() const;
+  private:
+  bool _internal_has_acks() const;
+  public:
+  void clear_acks();
+  const ::AckSettings& acks() const;
+  PROTOBUF_NODISCARD ::AckSettings* release_acks();
+  ::AckSettings* mutable_acks();
+  void set_allocated_acks(::AckSettings* acks);
+  private:
+  const ::AckSettings& _internal_acks() const;
+  ::AckSettings* _internal_mutable_acks();
+  public:
+  void unsafe_arena_set_allocated_acks(
+      ::AckSettings* acks);
+  ::AckSettings* unsafe_arena_release_acks();
+
+  // uint64 ack = 6;
+  void clear_ack();
+  uint64_t ack() const;
+  void set_ack(uint64_t value);
+  private:
+  uint64_t _internal_ack() const;
+  void _internal_set_ack(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SubscribeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> subscribe_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> unsubscribe_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        SubscribeRequest_StartOffsetsEntry_DoNotUse,
+        std::string, uint64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64> start_offsets_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        SubscribeRequest_FiltersEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> filters_;
+    ::ReceiveRequest* delivery_;
+    ::AckSettings* acks_;
+    uint64_t ack_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AckSettings final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:AckSettings) */ {
+ public:
+  inline AckSettings() : AckSettings(nullptr) {}
+  ~AckSettings() override;
+  explicit PROTOBUF_CONSTEXPR AckSettings(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AckSettings(const AckSettings& from);
+  AckSettings(AckSettings&& from) noexcept
+    : AckSettings() {
+    *this = ::std::move(from);
+  }
+
+  inline AckSettings& operator=(const AckSettings& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AckSettings& operator=(AckSettings&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AckSettings& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AckSettings* internal_default_instance() {
+    return reinterpret_cast<const AckSettings*>(
+               &_AckSettings_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(AckSettings& a, AckSettings& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AckSettings* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AckSettings* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AckSettings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AckSettings>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AckSettings& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AckSettings& from) {
+    AckSettings::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AckSettings* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "AckSettings";
+  }
+  protected:
+  explicit AckSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSessionFieldNumber = 3,
+    kWindowFieldNumber = 1,
+    kTimeoutMsFieldNumber = 2,
+  };
+  // string session = 3;
+  void clear_session();
+  const std::string& session() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session();
+  PROTOBUF_NODISCARD std::string* release_session();
+  void set_allocated_session(std::string* session);
+  private:
+  const std::string& _internal_session() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session(const std::string& value);
+  std::string* _internal_mutable_session();
+  public:
+
+  // uint32 window = 1;
+  void clear_window();
+  uint32_t window() const;
+  void set_window(uint32_t value);
+  private:
+  uint32_t _internal_window() const;
+  void _internal_set_window(uint32_t value);
+  public:
+
+  // uint32 timeout_ms = 2;
+  void clear_timeout_ms();
+  uint32_t timeout_ms() const;
+  void set_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:AckSettings)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_;
+    uint32_t window_;
+    uint32_t timeout_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReceiveResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ReceiveResponse) */ {
+ public:
+  inline ReceiveResponse() : ReceiveResponse(nullptr) {}
+  ~ReceiveResponse() override;
+  explicit PROTOBUF_CONSTEXPR ReceiveResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReceiveResponse(const ReceiveResponse& from);
+  ReceiveResponse(ReceiveResponse&& from) noexcept
+    : ReceiveResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ReceiveResponse& operator=(const ReceiveResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReceiveResponse& operator=(ReceiveResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReceiveResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReceiveResponse* internal_default_instance() {
+    return reinterpret_cast<const ReceiveResponse*>(
+               &_ReceiveResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(ReceiveResponse& a, ReceiveResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReceiveResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReceiveResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReceiveResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReceiveResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReceiveResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReceiveResponse& from) {
+    ReceiveResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReceiveResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ReceiveResponse";
+  }
+  protected:
+  explicit ReceiveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 2,
+    kMessageFieldNumber = 1,
+    kSequenceFieldNumber = 3,
+  };
+  // repeated .Message messages = 2;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::Message* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Message >*
+      mutable_messages();
+  private:
+  const ::Message& _internal_messages(int index) const;
+  ::Message* _internal_add_messages();
+  public:
+  const ::Message& messages(int index) const;
+  ::Message* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Message >&
+      messages() const;
+
+  // .Message message = 1;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::Message& message() const;
+  PROTOBUF_NODISCARD ::Message* release_message();
+  ::Message* mutable_message();
+  void set_allocated_message(::Message* message);
+  private:
+  const ::Message& _internal_message() const;
+  ::Message* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::Message* message);
+  ::Message* unsafe_arena_release_message();
+
+  // uint64 sequence = 3;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ReceiveResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Message > messages_;
+    ::Message* message_;
+    uint64_t sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:StatsRequest) */ {
+ public:
+  inline StatsRequest() : StatsRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR StatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsRequest(const StatsRequest& from);
+  StatsRequest(StatsRequest&& from) noexcept
+    : StatsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsRequest& operator=(const StatsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsRequest& operator=(StatsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsRequest* internal_default_instance() {
+    return reinterpret_cast<const StatsRequest*>(
+               &_StatsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(StatsRequest& a, StatsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const StatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const StatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StatsRequest";
+  }
+  protected:
+  explicit StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:StatsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TopicStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TopicStats) */ {
+ public:
+  inline TopicStats() : TopicStats(nullptr) {}
+  ~TopicStats() override;
+  explicit PROTOBUF_CONSTEXPR TopicStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TopicStats(const TopicStats& from);
+  TopicStats(TopicStats&& from) noexcept
+    : TopicStats() {
+    *this = ::std::move(from);
+  }
+
+  inline TopicStats& operator=(const TopicStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TopicStats& operator=(TopicStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TopicStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TopicStats* internal_default_instance() {
+    return reinterpret_cast<const TopicStats*>(
+               &_TopicStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(TopicStats& a, TopicStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TopicStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TopicStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TopicStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TopicStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TopicStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TopicStats& from) {
+    TopicStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TopicStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TopicStats";
+  }
+  protected:
+  explicit TopicStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTopicFieldNumber = 1,
+    kTopicIdFieldNumber = 2,
+    kMessagesFieldNumber = 3,
+    kBytesFieldNumber = 4,
+    kMessagesPerSecondFieldNumber = 5,
+    kBytesPerSecondFieldNumber = 6,
+    kSubscribersFieldNumber = 7,
+  };
+  // string topic = 1;
+  void clear_topic();
+  const std::string& topic() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_topic(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_topic();
+  PROTOBUF_NODISCARD std::string* release_topic();
+  void set_allocated_topic(std::string* topic);
+  private:
+  const std::string& _internal_topic() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_topic(const std::string& value);
+  std::string* _internal_mutable_topic();
+  public:
+
+  // uint64 topic_id = 2;
+  void clear_topic_id();
+  uint64_t topic_id() const;
+  void set_topic_id(uint64_t value);
+  private:
+  uint64_t _internal_topic_id() const;
+  void _internal_set_topic_id(uint64_t value);
+  public:
+
+  // uint64 messages = 3;
+  void clear_messages();
+  uint64_t messages() const;
+  void set_messages(uint64_t value);
+  private:
+  uint64_t _internal_messages() const;
+  void _internal_set_messages(uint64_t value);
+  public:
+
+  // uint64 bytes = 4;
+  void clear_bytes();
+  uint64_t bytes() const;
+  void set_bytes(uint64_t value);
+  private:
+  uint64_t _internal_bytes() const;
+  void _internal_set_bytes(uint64_t value);
+  public:
+
+  // double messages_per_second = 5;
+  void clear_messages_per_second();
+  double messages_per_second() const;
+  void set_messages_per_second(double value);
+  private:
+  double _internal_messages_per_second() const;
+  void _internal_set_messages_per_second(double value);
+  public:
+
+  // double bytes_per_second = 6;
+  void clear_bytes_per_second();
+  double bytes_per_second() const;
+  void set_bytes_per_second(double value);
+  private:
+  double _internal_bytes_per_second() const;
+  void _internal_set_bytes_per_second(double value);
+  public:
+
+  // uint64 subscribers = 7;
+  void clear_subscribers();
+  uint64_t subscribers() const;
+  void set_subscribers(uint64_t value);
+  private:
+  uint64_t _internal_subscribers() const;
+  void _internal_set_subscribers(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TopicStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr topic_;
+    uint64_t topic_id_;
+    uint64_t messages_;
+    uint64_t bytes_;
+    double messages_per_second_;
+    double bytes_per_second_;
+    uint64_t subscribers_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubscriberStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SubscriberStats) */ {
+ public:
+  inline SubscriberStats() : SubscriberStats(nullptr) {}
+  ~SubscriberStats() override;
+  explicit PROTOBUF_CONSTEXPR SubscriberStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubscriberStats(const SubscriberStats& from);
+  SubscriberStats(SubscriberStats&& from) noexcept
+    : SubscriberStats() {
+    *this = ::std::move(from);
+  }
+
+  inline SubscriberStats& operator=(const SubscriberStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubscriberStats& operator=(SubscriberStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SubscriberStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubscriberStats* internal_default_instance() {
+    return reinterpret_cast<const SubscriberStats*>(
+               &_SubscriberStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(SubscriberStats& a, SubscriberStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubscriberStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubscriberStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubscriberStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubscriberStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SubscriberStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SubscriberStats& from) {
+    SubscriberStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SubscriberStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "SubscriberStats";
+  }
+  protected:
+  explicit SubscriberStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kTopicsFieldNumber = 2,
+    kPatternsFieldNumber = 3,
+    kGroupsFieldNumber = 4,
+    kQueueDepthFieldNumber = 5,
+    kQueueCapacityFieldNumber = 6,
+    kMaxQueueDepthFieldNumber = 7,
+    kDroppedFieldNumber = 8,
+    kConflatedFieldNumber = 9,
+    kLightweightFieldNumber = 10,
+  };
+  // uint64 id = 1;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // uint64 topics = 2;
+  void clear_topics();
+  uint64_t topics() const;
+  void set_topics(uint64_t value);
+  private:
+  uint64_t _internal_topics() const;
+  void _internal_set_topics(uint64_t value);
+  public:
+
+  // uint64 patterns = 3;
+  void clear_patterns();
+  uint64_t patterns() const;
+  void set_patterns(uint64_t value);
+  private:
+  uint64_t _internal_patterns() const;
+  void _internal_set_patterns(uint64_t value);
+  public:
+
+  // uint64 groups = 4;
+  void clear_groups();
+  uint64_t groups() const;
+  void set_groups(uint64_t value);
+  private:
+  uint64_t _internal_groups() const;
+  void _internal_set_groups(uint64_t value);
+  public:
+
+  // uint64 queue_depth = 5;
+  void clear_queue_depth();
+  uint64_t queue_depth() const;
+  void set_queue_depth(uint64_t value);
+  private:
+  uint64_t _internal_queue_depth() const;
+  void _internal_set_queue_depth(uint64_t value);
+  public:
+
+  // uint64 queue_capacity = 6;
+  void clear_queue_capacity();
+  uint64_t queue_capacity() const;
+  void set_queue_capacity(uint64_t value);
+  private:
+  uint64_t _internal_queue_capacity() const;
+  void _internal_set_queue_capacity(uint64_t value);
+  public:
+
+  // uint64 max_queue_depth = 7;
+  void clear_max_queue_depth();
+  uint64_t max_queue_depth() const;
+  void set_max_queue_depth(uint64_t value);
+  private:
+  uint64_t _internal_max_queue_depth() const;
+  void _internal_set_max_queue_depth(uint64_t value);
+  public:
+
+  // uint64 dropped = 8;
+  void clear_dropped();
+  uint64_t dropped() const;
+  void set_dropped(uint64_t value);
+  private:
+  uint64_t _internal_dropped() const;
+  void _internal_set_dropped(uint64_t value);
+  public:
+
+  // uint64 conflated = 9;
+  void clear_conflated();
+  uint64_t conflated() const;
+  void set_conflated(uint64_t value);
+  private:
+  uint64_t _internal_conflated() const;
+  void _internal_set_conflated(uint64_t value);
+  public:
+
+  // bool lightweight = 10;
+  void clear_lightweight();
+  bool lightweight() const;
+  void set_lightweight(bool value);
+  private:
+  bool _internal_lightweight() const;
+  void _internal_set_lightweight(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:SubscriberStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t id_;
+    uint64_t topics_;
+    uint64_t patterns_;
+    uint64_t groups_;
+    uint64_t queue_depth_;
+    uint64_t queue_capacity_;
+    uint64_t max_queue_depth_;
+    uint64_t dropped_;
+    uint64_t conflated_;
+    bool lightweight_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DispatcherThreadStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:DispatcherThreadStats) */ {
+ public:
+  inline DispatcherThreadStats() : DispatcherThreadStats(nullptr) {}
+  ~DispatcherThreadStats() override;
+  explicit PROTOBUF_CONSTEXPR DispatcherThreadStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DispatcherThreadStats(const DispatcherThreadStats& from);
+  DispatcherThreadStats(DispatcherThreadStats&& from) noexcept
+    : DispatcherThreadStats() {
+    *this = ::std::move(from);
+  }
+
+  inline DispatcherThreadStats& operator=(const DispatcherThreadStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DispatcherThreadStats& operator=(DispatcherThreadStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DispatcherThreadStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DispatcherThreadStats* internal_default_instance() {
+    return reinterpret_cast<const DispatcherThreadStats*>(
+               &_DispatcherThreadStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(DispatcherThreadStats& a, DispatcherThreadStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DispatcherThreadStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DispatcherThreadStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DispatcherThreadStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DispatcherThreadStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DispatcherThreadStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DispatcherThreadStats& from) {
+    DispatcherThreadStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DispatcherThreadStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "DispatcherThreadStats";
+  }
+  protected:
+  explicit DispatcherThreadStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kThreadIdFieldNumber = 1,
+    kEventsFieldNumber = 2,
+    kBusySecondsFieldNumber = 3,
+    kUtilizationFieldNumber = 4,
+  };
+  // string thread_id = 1;
+  void clear_thread_id();
+  const std::string& thread_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_thread_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_thread_id();
+  PROTOBUF_NODISCARD std::string* release_thread_id();
+  void set_allocated_thread_id(std::string* thread_id);
+  private:
+  const std::string& _internal_thread_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_thread_id(const std::string& value);
+  std::string* _internal_mutable_thread_id();
+  public:
+
+  // uint64 events = 2;
+  void clear_events();
+  uint64_t events() const;
+  void set_events(uint64_t value);
+  private:
+  uint64_t _internal_events() const;
+  void _internal_set_events(uint64_t value);
+  public:
+
+  // double busy_seconds = 3;
+  void clear_busy_seconds();
+  double busy_seconds() const;
+  void set_busy_seconds(double value);
+  private:
+  double _internal_busy_seconds() const;
+  void _internal_set_busy_seconds(double value);
+  public:
+
+  // double utilization = 4;
+  void clear_utilization();
+  double utilization() const;
+  void set_utilization(double value);
+  private:
+  double _internal_utilization() const;
+  void _internal_set_utilization(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:DispatcherThreadStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr thread_id_;
+    uint64_t events_;
+    double busy_seconds_;
+    double utilization_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LatencyHistogram_Bucket final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LatencyHistogram.Bucket) */ {
+ public:
+  inline LatencyHistogram_Bucket() : LatencyHistogram_Bucket(nullptr) {}
+  ~LatencyHistogram_Bucket() override;
+  explicit PROTOBUF_CONSTEXPR LatencyHistogram_Bucket(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LatencyHistogram_Bucket(const LatencyHistogram_Bucket& from);
+  LatencyHistogram_Bucket(LatencyHistogram_Bucket&& from) noexcept
+    : LatencyHistogram_Bucket() {
+    *this = ::std::move(from);
+  }
+
+  inline LatencyHistogram_Bucket& operator=(const LatencyHistogram_Bucket& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LatencyHistogram_Bucket& operator=(LatencyHistogram_Bucket&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LatencyHistogram_Bucket& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LatencyHistogram_Bucket* internal_default_instance() {
+    return reinterpret_cast<const LatencyHistogram_Bucket*>(
+               &_LatencyHistogram_Bucket_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(LatencyHistogram_Bucket& a, LatencyHistogram_Bucket& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LatencyHistogram_Bucket* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LatencyHistogram_Bucket* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LatencyHistogram_Bucket* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LatencyHistogram_Bucket>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LatencyHistogram_Bucket& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LatencyHistogram_Bucket& from) {
+    LatencyHistogram_Bucket::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LatencyHistogram_Bucket* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LatencyHistogram.Bucket";
+  }
+  protected:
+  explicit LatencyHistogram_Bucket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUpToNsFieldNumber = 1,
+    kCountFieldNumber = 2,
+  };
+  // uint64 up_to_ns = 1;
+  void clear_up_to_ns();
+  uint64_t up_to_ns() const;
+  void set_up_to_ns(uint64_t value);
+  private:
+  uint64_t _internal_up_to_ns() const;
+  void _internal_set_up_to_ns(uint64_t value);
+  public:
+
+  // uint64 count = 2;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:LatencyHistogram.Bucket)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t up_to_ns_;
+    uint64_t count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LatencyHistogram final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:LatencyHistogram) */ {
+ public:
+  inline LatencyHistogram() : LatencyHistogram(nullptr) {}
+  ~LatencyHistogram() override;
+  explicit PROTOBUF_CONSTEXPR LatencyHistogram(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LatencyHistogram(const LatencyHistogram& from);
+  LatencyHistogram(LatencyHistogram&& from) noexcept
+    : LatencyHistogram() {
+    *this = ::std::move(from);
+  }
+
+  inline LatencyHistogram& operator=(const LatencyHistogram& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LatencyHistogram& operator=(LatencyHistogram&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LatencyHistogram& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LatencyHistogram* internal_default_instance() {
+    return reinterpret_cast<const LatencyHistogram*>(
+               &_LatencyHistogram_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(LatencyHistogram& a, LatencyHistogram& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LatencyHistogram* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LatencyHistogram* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LatencyHistogram* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LatencyHistogram>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LatencyHistogram& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LatencyHistogram& from) {
+    LatencyHistogram::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LatencyHistogram* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "LatencyHistogram";
+  }
+  protected:
+  explicit LatencyHistogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef LatencyHistogram_Bucket Bucket;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBucketsFieldNumber = 7,
+    kCountFieldNumber = 1,
+    kP50NsFieldNumber = 2,
+    kP90NsFieldNumber = 3,
+    kP99NsFieldNumber = 4,
+    kP999NsFieldNumber = 5,
+    kMaxNsFieldNumber = 6,
+  };
+  // repeated .LatencyHistogram.Bucket buckets = 7;
+  int buckets_size() const;
+  private:
+  int _internal_buckets_size() const;
+  public:
+  void clear_buckets();
+  ::LatencyHistogram_Bucket* mutable_buckets(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::LatencyHistogram_Bucket >*
+      mutable_buckets();
+  private:
+  const ::LatencyHistogram_Bucket& _internal_buckets(int index) const;
+  ::LatencyHistogram_Bucket* _internal_add_buckets();
+  public:
+  const ::LatencyHistogram_Bucket& buckets(int index) const;
+  ::LatencyHistogram_Bucket* add_buckets();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::LatencyHistogram_Bucket >&
+      buckets() const;
+
+  // uint64 count = 1;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // uint64 p50_ns = 2;
+  void clear_p50_ns();
+  uint64_t p50_ns() const;
+  void set_p50_ns(uint64_t value);
+  private:
+  uint64_t _internal_p50_ns() const;
+  void _internal_set_p50_ns(uint64_t value);
+  public:
+
+  // uint64 p90_ns = 3;
+  void clear_p90_ns();
+  uint64_t p90_ns() const;
+  void set_p90_ns(uint64_t value);
+  private:
+  uint64_t _internal_p90_ns() const;
+  void _internal_set_p90_ns(uint64_t value);
+  public:
+
+  // uint64 p99_ns = 4;
+  void clear_p99_ns();
+  uint64_t p99_ns() const;
+  void set_p99_ns(uint64_t value);
+  private:
+  uint64_t _internal_p99_ns() const;
+  void _internal_set_p99_ns(uint64_t value);
+  public:
+
+  // uint64 p999_ns = 5;
+  void clear_p999_ns();
+  uint64_t p999_ns() const;
+  void set_p999_ns(uint64_t value);
+  private:
+  uint64_t _internal_p999_ns() const;
+  void _internal_set_p999_ns(uint64_t value);
+  public:
+
+  // uint64 max_ns = 6;
+  void clear_max_ns();
+  uint64_t max_ns() const;
+  void set_max_ns(uint64_t value);
+  private:
+  uint64_t _internal_max_ns() const;
+  void _internal_set_max_ns(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:LatencyHistogram)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::LatencyHistogram_Bucket > buckets_;
+    uint64_t count_;
+    uint64_t p50_ns_;
+    uint64_t p90_ns_;
+    uint64_t p99_ns_;
+    uint64_t p999_ns_;
+    uint64_t max_ns_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:StatsResponse) */ {
+ public:
+  inline StatsResponse() : StatsResponse(nullptr) {}
+  ~StatsResponse() override;
+  explicit PROTOBUF_CONSTEXPR StatsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsResponse(const StatsResponse& from);
+  StatsResponse(StatsResponse&& from) noexcept
+    : StatsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsResponse& operator=(const StatsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsResponse& operator=(StatsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsResponse* internal_default_instance() {
+    return reinterpret_cast<const StatsResponse*>(
+               &_StatsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(StatsResponse& a, StatsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatsResponse& from) {
+    StatsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "StatsResponse";
+  }
+  protected:
+  explicit StatsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTopicsFieldNumber = 1,
+    kSubscribersFieldNumber = 2,
+    kDispatcherThreadsFieldNumber = 3,
+    kPublishToWriteFieldNumber = 4,
+  };
+  // repeated .TopicStats topics = 1;
+  int topics_size() const;
+  private:
+  int _internal_topics_size() const;
+  public:
+  void clear_topics();
+  ::TopicStats* mutable_topics(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TopicStats >*
+      mutable_topics();
+  private:
+  const ::TopicStats& _internal_topics(int index) const;
+  ::TopicStats* _internal_add_topics();
+  public:
+  const ::TopicStats& topics(int index) const;
+  ::TopicStats* add_topics();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TopicStats >&
+      topics() const;
+
+  // repeated .SubscriberStats subscribers = 2;
+  int subscribers_size() const;
+  private:
+  int _internal_subscribers_size() const;
+  public:
+  void clear_subscribers();
+  ::SubscriberStats* mutable_subscribers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SubscriberStats >*
+      mutable_subscribers();
+  private:
+  const ::SubscriberStats& _internal_subscribers(int index) const;
+  ::SubscriberStats* _internal_add_subscribers();
+  public:
+  const ::SubscriberStats& subscribers(int index) const;
+  ::SubscriberStats* add_subscribers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SubscriberStats >&
+      subscribers() const;
+
+  // repeated .DispatcherThreadStats dispatcher_threads = 3;
+  int dispatcher_threads_size() const;
+  private:
+  int _internal_dispatcher_threads_size() const;
+  public:
+  void clear_dispatcher_threads();
+  ::DispatcherThreadStats* mutable_dispatcher_threads(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::DispatcherThreadStats >*
+      mutable_dispatcher_threads();
+  private:
+  const ::DispatcherThreadStats& _internal_dispatcher_threads(int index) const;
+  ::DispatcherThreadStats* _internal_add_dispatcher_threads();
+  public:
+  const ::DispatcherThreadStats& dispatcher_threads(int index) const;
+  ::DispatcherThreadStats* add_dispatcher_threads();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::DispatcherThreadStats >&
+      dispatcher_threads() const;
+
+  // .LatencyHistogram publish_to_write = 4;
+  bool has_publish_to_write() const;
+  private:
+  bool _internal_has_publish_to_write() const;
+  public:
+  void clear_publish_to_write();
+  const ::LatencyHistogram& publish_to_write() const;
+  PROTOBUF_NODISCARD ::LatencyHistogram* release_publish_to_write();
+  ::LatencyHistogram* mutable_publish_to_write();
+  void set_allocated_publish_to_write(::LatencyHistogram* publish_to_write);
+  private:
+  const ::LatencyHistogram& _internal_publish_to_write() const;
+  ::LatencyHistogram* _internal_mutable_publish_to_write();
+  public:
+  void unsafe_arena_set_allocated_publish_to_write(
+      ::LatencyHistogram* publish_to_write);
+  ::LatencyHistogram* unsafe_arena_release_publish_to_write();
+
+  // @@protoc_insertion_point(class_scope:StatsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TopicStats > topics_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SubscriberStats > subscribers_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::DispatcherThreadStats > dispatcher_threads_;
+    ::LatencyHistogram* publish_to_write_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DictionariesRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:DictionariesRequest) */ {
+ public:
+  inline DictionariesRequest() : DictionariesRequest(nullptr) {}
+  ~DictionariesRequest() override;
+  explicit PROTOBUF_CONSTEXPR DictionariesRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DictionariesRequest(const DictionariesRequest& from);
+  DictionariesRequest(DictionariesRequest&& from) noexcept
+    : DictionariesRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline DictionariesRequest& operator=(const DictionariesRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DictionariesRequest& operator=(DictionariesRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DictionariesRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DictionariesRequest* internal_default_instance() {
+    return reinterpret_cast<const DictionariesRequest*>(
+               &_DictionariesRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(DictionariesRequest& a, DictionariesRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DictionariesRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DictionariesRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DictionariesRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DictionariesRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DictionariesRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DictionariesRequest& from) {
+    DictionariesRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DictionariesRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "DictionariesRequest";
+  }
+  protected:
+  explicit DictionariesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTopicIdsFieldNumber = 1,
+  };
+  // repeated uint64 topic_ids = 1;
+  int topic_ids_size() const;
+  private:
+  int _internal_topic_ids_size() const;
+  public:
+  void clear_topic_ids();
+  private:
+  uint64_t _internal_topic_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_topic_ids() const;
+  void _internal_add_topic_ids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_topic_ids();
+  public:
+  uint64_t topic_ids(int index) const;
+  void set_topic_ids(int index, uint64_t value);
+  void add_topic_ids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      topic_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_topic_ids();
+
+  // @@protoc_insertion_point(class_scope:DictionariesRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > topic_ids_;
+    mutable std::atomic<int> _topic_ids_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Dictionary final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Dictionary) */ {
+ public:
+  inline Dictionary() : Dictionary(nullptr) {}
+  ~Dictionary() override;
+  explicit PROTOBUF_CONSTEXPR Dictionary(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Dictionary(const Dictionary& from);
+  Dictionary(Dictionary&& from) noexcept
+    : Dictionary() {
+    *this = ::std::move(from);
+  }
+
+  inline Dictionary& operator=(const Dictionary& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Dictionary& operator=(Dictionary&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Dictionary& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Dictionary* internal_default_instance() {
+    return reinterpret_cast<const Dictionary*>(
+               &_Dictionary_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(Dictionary& a, Dictionary& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Dictionary* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Dictionary* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Dictionary* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Dictionary>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Dictionary& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Dictionary& from) {
+    Dictionary::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Dictionary* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "Dictionary";
+  }
+  protected:
+  explicit Dictionary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 3,
+    kTopicIdFieldNumber = 1,
+    kIdFieldNumber = 2,
+  };
+  // bytes data = 3;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // uint64 topic_id = 1;
+  void clear_topic_id();
+  uint64_t topic_id() const;
+  void set_topic_id(uint64_t value);
+  private:
+  uint64_t _internal_topic_id() const;
+  void _internal_set_topic_id(uint64_t value);
+  public:
+
+  // uint32 id = 2;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:Dictionary)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint64_t topic_id_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DictionariesResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:DictionariesResponse) */ {
+ public:
+  inline DictionariesResponse() : DictionariesResponse(nullptr) {}
+  ~DictionariesResponse() override;
+  explicit PROTOBUF_CONSTEXPR DictionariesResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DictionariesResponse(const DictionariesResponse& from);
+  DictionariesResponse(DictionariesResponse&& from) noexcept
+    : DictionariesResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline DictionariesResponse& operator=(const DictionariesResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DictionariesResponse& operator=(DictionariesResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DictionariesResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DictionariesResponse* internal_default_instance() {
+    return reinterpret_cast<const DictionariesResponse*>(
+               &_DictionariesResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(DictionariesResponse& a, DictionariesResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DictionariesResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DictionariesResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DictionariesResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DictionariesResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DictionariesResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DictionariesResponse& from) {
+    DictionariesResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DictionariesResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "DictionariesResponse";
+  }
+  protected:
+  explicit DictionariesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDictionariesFieldNumber = 1,
+  };
+  // repeated .Dictionary dictionaries = 1;
+  int dictionaries_size() const;
+  private:
+  int _internal_dictionaries_size() const;
+  public:
+  void clear_dictionaries();
+  ::Dictionary* mutable_dictionaries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Dictionary >*
+      mutable_dictionaries();
+  private:
+  const ::Dictionary& _internal_dictionaries(int index) const;
+  ::Dictionary* _internal_add_dictionaries();
+  public:
+  const ::Dictionary& dictionaries(int index) const;
+  ::Dictionary* add_dictionaries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Dictionary >&
+      dictionaries() const;
+
+  // @@protoc_insertion_point(class_scope:DictionariesResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Dictionary > dictionaries_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_broker_2eproto;
+};
+// ===================================================================
+
+
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// Message
+
+// string topic = 1;
+inline void Message::clear_topic() {
+  _impl_.topic_.ClearToEmpty();
+}
+inline const std::string& Message::topic() const {
+  // @@protoc_insertion_point(field_get:Message.topic)
+  return _internal_topic();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_topic(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.topic_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Message.topic)
+}
+inline std::string* Message::mutable_topic() {
+  std::string* _s = _internal_mutable_topic();
+  // @@protoc_insertion_point(field_mutable:Message.topic)
+  return _s;
+}
+inline const std::string& Message::_internal_topic() const {
+  return _impl_.topic_.Get();
+}
+inline void Message::_internal_set_topic(const std::string& value) {
+  
+  _impl_.topic_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_topic() {
+  
+  return _impl_.topic_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_topic() {
+  // @@protoc_insertion_point(field_release:Message.topic)
+  return _impl_.topic_.Release();
+}
+inline void Message::set_allocated_topic(std::string* topic) {
+  if (topic != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.topic_.SetAllocated(topic, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.topic_.IsDefault()) {
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Message.topic)
+}
+
+// bytes content = 2;
+inline void Message::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& Message::content() const {
+  // @@protoc_insertion_point(field_get:Message.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Message.content)
+}
+inline std::string* Message::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:Message.content)
+  return _s;
+}
+inline const std::string& Message::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void Message::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_content() {
+  // @@protoc_insertion_point(field_release:Message.content)
+  return _impl_.content_.Release();
+}
+inline void Message::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Message.content)
+}
+
+// uint64 topic_id = 3;
+inline void Message::clear_topic_id() {
+  _impl_.topic_id_ = uint64_t{0u};
+}
+inline uint64_t Message::_internal_topic_id() const {
+  return _impl_.topic_id_;
+}
+inline uint64_t Message::topic_id() const {
+  // @@protoc_insertion_point(field_get:Message.topic_id)
+  return _internal_topic_id();
+}
+inline void Message::_internal_set_topic_id(uint64_t value) {
+  
+  _impl_.topic_id_ = value;
+}
+inline void Message::set_topic_id(uint64_t value) {
+  _internal_set_topic_id(value);
+  // @@protoc_insertion_point(field_set:Message.topic_id)
+}
+
+// optional uint64 offset = 4;
+inline bool Message::_internal_has_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Message::has_offset() const {
+  return _internal_has_offset();
+}
+inline void Message::clear_offset() {
+  _impl_.offset_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Message::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint64_t Message::offset() const {
+  // @@protoc_insertion_point(field_get:Message.offset)
+  return _internal_offset();
+}
+inline void Message::_internal_set_offset(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.offset_ = value;
+}
+inline void Message::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:Message.offset)
+}
+
+// string key = 5;
+inline void Message::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& Message::key() const {
+  // @@protoc_insertion_point(field_get:Message.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Message.key)
+}
+inline std::string* Message::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:Message.key)
+  return _s;
+}
+inline const std::string& Message::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Message::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_key() {
+  // @@protoc_insertion_point(field_release:Message.key)
+  return _impl_.key_.Release();
+}
+inline void Message::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Message.key)
+}
+
+// bool retain = 6;
+inline void Message::clear_retain() {
+  _impl_.retain_ = false;
+}
+inline bool Message::_internal_retain() const {
+  return _impl_.retain_;
+}
+inline bool Message::retain() const {
+  // @@protoc_insertion_point(field_get:Message.retain)
+  return _internal_retain();
+}
+inline void Message::_internal_set_retain(bool value) {
+  
+  _impl_.retain_ = value;
+}
+inline void Message::set_retain(bool value) {
+  _internal_set_retain(value);
+  // @@protoc_insertion_point(field_set:Message.retain)
+}
+
+// bytes deflated = 7;
+inline void Message::clear_deflated() {
+  _impl_.deflated_.ClearToEmpty();
+}
+inline const std::string& Message::deflated() const {
+  // @@protoc_insertion_point(field_get:Message.deflated)
+  return _internal_deflated();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_deflated(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.deflated_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Message.deflated)
+}
+inline std::string* Message::mutable_deflated() {
+  std::string* _s = _internal_mutable_deflated();
+  // @@protoc_insertion_point(field_mutable:Message.deflated)
+  return _s;
+}
+inline const std::string& Message::_internal_deflated() const {
+  return _impl_.deflated_.Get();
+}
+inline void Message::_internal_set_deflated(const std::string& value) {
+  
+  _impl_.deflated_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_deflated() {
+  
+  return _impl_.deflated_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_deflated() {
+  // @@protoc_insertion_point(field_release:Message.deflated)
+  return _impl_.deflated_.Release();
+}
+inline void Message::set_allocated_deflated(std::string* deflated) {
+  if (deflated != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.deflated_.SetAllocated(deflated, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.deflated_.IsDefault()) {
+    _impl_.deflated_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Message.deflated)
+}
+
+// uint32 dictionary = 8;
+inline void Message::clear_dictionary() {
+  _impl_.dictionary_ = 0u;
+}
+inline uint32_t Message::_internal_dictionary() const {
+  return _impl_.dictionary_;
+}
+inline uint32_t Message::dictionary() const {
+  // @@protoc_insertion_point(field_get:Message.dictionary)
+  return _internal_dictionary();
+}
+inline void Message::_internal_set_dictionary(uint32_t value) {
+  
+  _impl_.dictionary_ = value;
+}
+inline void Message::set_dictionary(uint32_t value) {
+  _internal_set_dictionary(value);
+  // @@protoc_insertion_point(field_set:Message.dictionary)
+}
+
+// string origin = 9;
+inline void Message::clear_origin() {
+  _impl_.origin_.ClearToEmpty();
+}
+inline const std::string& Message::origin() const {
+  // @@protoc_insertion_point(field_get:Message.origin)
+  return _internal_origin();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_origin(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.origin_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Message.origin)
+}
+inline std::string* Message::mutable_origin() {
+  std::string* _s = _internal_mutable_origin();
+  // @@protoc_insertion_point(field_mutable:Message.origin)
+  return _s;
+}
+inline const std::string& Message::_internal_origin() const {
+  return _impl_.origin_.Get();
+}
+inline void Message::_internal_set_origin(const std::string& value) {
+  
+  _impl_.origin_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_origin() {
+  
+  return _impl_.origin_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_origin() {
+  // @@protoc_insertion_point(field_release:Message.origin)
+  return _impl_.origin_.Release();
+}
+inline void Message::set_allocated_origin(std::string* origin) {
+  if (origin != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.origin_.SetAllocated(origin, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.origin_.IsDefault()) {
+    _impl_.origin_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Message.origin)
+}
+
+// map<string, string> headers = 10;
+inline int Message::_internal_headers_size() const {
+  return _impl_.headers_.size();
+}
+inline int Message::headers_size() const {
+  return _internal_headers_size();
+}
+inline void Message::clear_headers() {
+  _impl_.headers_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+Message::_internal_headers() const {
+  return _impl_.headers_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+Message::headers() const {
+  // @@protoc_insertion_point(field_map:Message.headers)
+  return _internal_headers();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+Message::_internal_mutable_headers() {
+  return _impl_.headers_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+Message::mutable_headers() {
+  // @@protoc_insertion_point(field_mutable_map:Message.headers)
+  return _internal_mutable_headers();
+}
+
+// -------------------------------------------------------------------
+
+// SendRequest
+
+// repeated .Message messages = 1;
+inline int SendRequest::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int SendRequest::messages_size() const {
+  return _internal_messages_size();
+}
+inline void SendRequest::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::Message* SendRequest::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:SendRequest.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Message >*
+SendRequest::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:SendRequest.messages)
+  return &_impl_.messages_;
+}
+inline const ::Message& SendRequest::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::Message& SendRequest::messages(int index) const {
+  // @@protoc_insertion_point(field_get:SendRequest.messages)
+  return _internal_messages(index);
+}
+inline ::Message* SendRequest::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::Message* SendRequest::add_messages() {
+  ::Message* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:SendRequest.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Message >&
+SendRequest::messages() const {
+  // @@protoc_insertion_point(field_list:SendRequest.messages)
+  return _impl_.messages_;
+}
+
+// -------------------------------------------------------------------
+
+// SendResponse
+
+// -------------------------------------------------------------------
+
+// PublishAck
+
+// uint64 acknowledged = 1;
+inline void PublishAck::clear_acknowledged() {
+  _impl_.acknowledged_ = uint64_t{0u};
+}
+inline uint64_t PublishAck::_internal_acknowledged() const {
+  return _impl_.acknowledged_;
+}
+inline uint64_t PublishAck::acknowledged() const {
+  // @@protoc_insertion_point(field_get:PublishAck.acknowledged)
+  return _internal_acknowledged();
+}
+inline void PublishAck::_internal_set_acknowledged(uint64_t value) {
+  
+  _impl_.acknowledged_ = value;
+}
+inline void PublishAck::set_acknowledged(uint64_t value) {
+  _internal_set_acknowledged(value);
+  // @@protoc_insertion_point(field_set:PublishAck.acknowledged)
+}
+
+// -------------------------------------------------------------------
+
+// ResolveRequest
+
+// repeated string topics = 1;
+inline int ResolveRequest::_internal_topics_size() const {
+  return _impl_.topics_.size();
+}
+inline int ResolveRequest::topics_size() const {
+  return _internal_topics_size();
+}
+inline void ResolveRequest::clear_topics() {
+  _impl_.topics_.Clear();
+}
+inline std::string* ResolveRequest::add_topics() {
+  std::string* _s = _internal_add_topics();
+  // @@protoc_insertion_point(field_add_mutable:ResolveRequest.topics)
+  return _s;
+}
+inline const std::string& ResolveRequest::_internal_topics(int index) const {
+  return _impl_.topics_.Get(index);
+}
+inline const std::string& ResolveRequest::topics(int index) const {
+  // @@protoc_insertion_point(field_get:ResolveRequest.topics)
+  return _internal_topics(index);
+}
+inline std::string* ResolveRequest::mutable_topics(int index) {
+  // @@protoc_insertion_point(field_mutable:ResolveRequest.topics)
+  return _impl_.topics_.Mutable(index);
+}
+inline void ResolveRequest::set_topics(int index, const std::string& value) {
+  _impl_.topics_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ResolveRequest.topics)
+}
+inline void ResolveRequest::set_topics(int index, std::string&& value) {
+  _impl_.topics_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ResolveRequest.topics)
+}
+inline void ResolveRequest::set_topics(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.topics_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ResolveRequest.topics)
+}
+inline void ResolveRequest::set_topics(int index, const char* value, size_t size) {
+  _impl_.topics_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ResolveRequest.topics)
+}
+inline std::string* ResolveRequest::_internal_add_topics() {
+  return _impl_.topics_.Add();
+}
+inline void ResolveRequest::add_topics(const std::string& value) {
+  _impl_.topics_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ResolveRequest.topics)
+}
+inline void ResolveRequest::add_topics(std::string&& value) {
+  _impl_.topics_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ResolveRequest.topics)
+}
+inline void ResolveRequest::add_topics(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.topics_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ResolveRequest.topics)
+}
+inline void ResolveRequest::add_topics(const char* value, size_t size) {
+  _impl_.topics_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ResolveRequest.topics)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ResolveRequest::topics() const {
+  // @@protoc_insertion_point(field_list:ResolveRequest.topics)
+  return _impl_.topics_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ResolveRequest::mutable_topics() {
+  // @@protoc_insertion_point(field_mutable_list:ResolveRequest.topics)
+  return &_impl_.topics_;
+}
+
+// -------------------------------------------------------------------
+
+// ResolveResponse
+
+// repeated uint64 topic_ids = 1;
+inline int ResolveResponse::_internal_topic_ids_size() const {
+  return _impl_.topic_ids_.size();
+}
+inline int ResolveResponse::topic_ids_size() const {
+  return _internal_topic_ids_size();
+}
+inline void ResolveResponse::clear_topic_ids() {
+  _impl_.topic_ids_.Clear();
+}
+inline uint64_t ResolveResponse::_internal_topic_ids(int index) const {
+  return _impl_.topic_ids_.Get(index);
+}
+inline uint64_t ResolveResponse::topic_ids(int index) const {
+  // @@protoc_insertion_point(field_get:ResolveResponse.topic_ids)
+  return _internal_topic_ids(index);
+}
+inline void ResolveResponse::set_topic_ids(int index, uint64_t value) {
+  _impl_.topic_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ResolveResponse.topic_ids)
+}
+inline void ResolveResponse::_internal_add_topic_ids(uint64_t value) {
+  _impl_.topic_ids_.Add(value);
+}
+inline void ResolveResponse::add_topic_ids(uint64_t value) {
+  _internal_add_topic_ids(value);
+  // @@protoc_insertion_point(field_add:ResolveResponse.topic_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ResolveResponse::_internal_topic_ids() const {
+  return _impl_.topic_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+ResolveResponse::topic_ids() const {
+  // @@protoc_insertion_point(field_list:ResolveResponse.topic_ids)
+  return _internal_topic_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ResolveResponse::_internal_mutable_topic_ids() {
+  return &_impl_.topic_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+ResolveResponse::mutable_topic_ids() {
+  // @@protoc_insertion_point(field_mutable_list:ResolveResponse.topic_ids)
+  return _internal_mutable_topic_ids();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// ReceiveRequest
+
+// repeated string topics = 1;
+inline int ReceiveRequest::_internal_topics_size() const {
+  return _impl_.topics_.size();
+}
+inline int ReceiveRequest::topics_size() const {
+  return _internal_topics_size();
+}
+inline void ReceiveRequest::clear_topics() {
+  _impl_.topics_.Clear();
+}
+inline std::string* ReceiveRequest::add_topics() {
+  std::string* _s = _internal_add_topics();
+  // @@protoc_insertion_point(field_add_mutable:ReceiveRequest.topics)
+  return _s;
+}
+inline const std::string& ReceiveRequest::_internal_topics(int index) const {
+  return _impl_.topics_.Get(index);
+}
+inline const std::string& ReceiveRequest::topics(int index) const {
+  // @@protoc_insertion_point(field_get:ReceiveRequest.topics)
+  return _internal_topics(index);
+}
+inline std::string* ReceiveRequest::mutable_topics(int index) {
+  // @@protoc_insertion_point(field_mutable:ReceiveRequest.topics)
+  return _impl_.topics_.Mutable(index);
+}
+inline void ReceiveRequest::set_topics(int index, const std::string& value) {
+  _impl_.topics_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ReceiveRequest.topics)
+}
+inline void ReceiveRequest::set_topics(int index, std::string&& value) {
+  _impl_.topics_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ReceiveRequest.topics)
+}
+inline void ReceiveRequest::set_topics(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.topics_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ReceiveRequest.topics)
+}
+inline void ReceiveRequest::set_topics(int index, const char* value, size_t size) {
+  _impl_.topics_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ReceiveRequest.topics)
+}
+inline std::string* ReceiveRequest::_internal_add_topics() {
+  return _impl_.topics_.Add();
+}
+inline void ReceiveRequest::add_topics(const std::string& value) {
+  _impl_.topics_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ReceiveRequest.topics)
+}
+inline void ReceiveRequest::add_topics(std::string&& value) {
+  _impl_.topics_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ReceiveRequest.topics)
+}
+inline void ReceiveRequest::add_topics(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.topics_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ReceiveRequest.topics)
+}
+inline void ReceiveRequest::add_topics(const char* value, size_t size) {
+  _impl_.topics_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ReceiveRequest.topics)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ReceiveRequest::topics() const {
+  // @@protoc_insertion_point(field_list:ReceiveRequest.topics)
+  return _impl_.topics_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ReceiveRequest::mutable_topics() {
+  // @@protoc_insertion_point(field_mutable_list:ReceiveRequest.topics)
+  return &_impl_.topics_;
+}
+
+// uint32 max_batch = 2;
+inline void ReceiveRequest::clear_max_batch() {
+  _impl_.max_batch_ = 0u;
+}
+inline uint32_t ReceiveRequest::_internal_max_batch() const {
+  return _impl_.max_batch_;
+}
+inline uint32_t ReceiveRequest::max_batch() const {
+  // @@protoc_insertion_point(field_get:ReceiveRequest.max_batch)
+  return _internal_max_batch();
+}
+inline void ReceiveRequest::_internal_set_max_batch(uint32_t value) {
+  
+  _impl_.max_batch_ = value;
+}
+inline void ReceiveRequest::set_max_batch(uint32_t value) {
+  _internal_set_max_batch(value);
+  // @@protoc_insertion_point(field_set:ReceiveRequest.max_batch)
+}
+
+// uint32 linger_us = 3;
+inline void ReceiveRequest::clear_linger_us() {
+  _impl_.linger_us_ = 0u;
+}
+inline uint32_t ReceiveRequest::_internal_linger_us() const {
+  return _impl_.linger_us_;
+}
+inline uint32_t ReceiveRequest::linger_us() const {
+  // @@protoc_insertion_point(field_get:ReceiveRequest.linger_us)
+  return _internal_linger_us();
+}
+inline void ReceiveRequest::_internal_set_linger_us(uint32_t value) {
+  
+  _impl_.linger_us_ = value;
+}
+inline void ReceiveRequest::set_linger_us(uint32_t value) {
+  _internal_set_linger_us(value);
+  // @@protoc_insertion_point(field_set:ReceiveRequest.linger_us)
+}
+
+// uint32 max_queue = 4;
+inline void ReceiveRequest::clear_max_queue() {
+  _impl_.max_queue_ = 0u;
+}
+inline uint32_t ReceiveRequest::_internal_max_queue() const {
+  return _impl_.max_queue_;
+}
+inline uint32_t ReceiveRequest::max_queue() const {
+  // @@protoc_insertion_point(field_get:ReceiveRequest.max_queue)
+  return _internal_max_queue();
+}
+inline void ReceiveRequest::_internal_set_max_queue(uint32_t value) {
+  
+  _impl_.max_queue_ = value;
+}
+inline void ReceiveRequest::set_max_queue(uint32_t value) {
+  _internal_set_max_queue(value);
+  // @@protoc_insertion_point(field_set:ReceiveRequest.max_queue)
+}
+
+// .ReceiveRequest.OverflowPolicy overflow_policy = 5;
+inline void ReceiveRequest::clear_overflow_policy() {
+  _impl_.overflow_policy_ = 0;
+}
+inline ::ReceiveRequest_OverflowPolicy ReceiveRequest::_internal_overflow_policy() const {
+  return static_cast< ::ReceiveRequest_OverflowPolicy >(_impl_.overflow_policy_);
+}
+inline ::ReceiveRequest_OverflowPolicy ReceiveRequest::overflow_policy() const {
+  // @@protoc_insertion_point(field_get:ReceiveRequest.overflow_policy)
+  return _internal_overflow_policy();
+}
+inline void ReceiveRequest::_internal_set_overflow_policy(::ReceiveRequest_OverflowPolicy value) {
+  
+  _impl_.overflow_policy_ = value;
+}
+inline void ReceiveRequest::set_overflow_policy(::ReceiveRequest_OverflowPolicy value) {
+  _internal_set_overflow_policy(value);
+  // @@protoc_insertion_point(field_set:ReceiveRequest.overflow_policy)
+}
+
+// map<string, uint64> start_offsets = 6;
+inline int ReceiveRequest::_internal_start_offsets_size() const {
+  return _impl_.start_offsets_.size();
+}
+inline int ReceiveRequest::start_offsets_size() const {
+  return _internal_start_offsets_size();
+}
+inline void ReceiveRequest::clear_start_offsets() {
+  _impl_.start_offsets_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+ReceiveRequest::_internal_start_offsets() const {
+  return _impl_.start_offsets_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+ReceiveRequest::start_offsets() const {
+  // @@protoc_insertion_point(field_map:ReceiveRequest.start_offsets)
+  return _internal_start_offsets();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+ReceiveRequest::_internal_mutable_start_offsets() {
+  return _impl_.start_offsets_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+ReceiveRequest::mutable_start_offsets() {
+  // @@protoc_insertion_point(field_mutable_map:ReceiveRequest.start_offsets)
+  return _internal_mutable_start_offsets();
+}
+
+// string group = 7;
+inline void ReceiveRequest::clear_group() {
+  _impl_.group_.ClearToEmpty();
+}
+inline const std::string& ReceiveRequest::group() const {
+  // @@protoc_insertion_point(field_get:ReceiveRequest.group)
+  return _internal_group();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReceiveRequest::set_group(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.group_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ReceiveRequest.group)
+}
+inline std::string* ReceiveRequest::mutable_group() {
+  std::string* _s = _internal_mutable_group();
+  // @@protoc_insertion_point(field_mutable:ReceiveRequest.group)
+  return _s;
+}
+inline const std::string& ReceiveRequest::_internal_group() const {
+  return _impl_.group_.Get();
+}
+inline void ReceiveRequest::_internal_set_group(const std::string& value) {
+  
+  _impl_.group_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReceiveRequest::_internal_mutable_group() {
+  
+  return _impl_.group_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReceiveRequest::release_group() {
+  // @@protoc_insertion_point(field_release:ReceiveRequest.group)
+  return _impl_.group_.Release();
+}
+inline void ReceiveRequest::set_allocated_group(std::string* group) {
+  if (group != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.group_.SetAllocated(group, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.group_.IsDefault()) {
+    _impl_.group_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ReceiveRequest.group)
+}
+
+// .ReceiveRequest.GroupBalancing group_balancing = 8;
+inline void ReceiveRequest::clear_group_balancing() {
+  _impl_.group_balancing_ = 0;
+}
+inline ::ReceiveRequest_GroupBalancing ReceiveRequest::_internal_group_balancing() const {
+  return static_cast< ::ReceiveRequest_GroupBalancing >(_impl_.group_balancing_);
+}
+inline ::ReceiveRequest_GroupBalancing ReceiveRequest::group_balancing() const {
+  // @@protoc_insertion_point(field_get:ReceiveRequest.group_balancing)
+  return _internal_group_balancing();
+}
+inline void ReceiveRequest::_internal_set_group_balancing(::ReceiveRequest_GroupBalancing value) {
+  
+  _impl_.group_balancing_ = value;
+}
+inline void ReceiveRequest::set_group_balancing(::ReceiveRequest_GroupBalancing value) {
+  _internal_set_group_balancing(value);
+  // @@protoc_insertion_point(field_set:ReceiveRequest.group_balancing)
+}
+
+// .ReceiveRequest.Compression compression = 9;
+inline void ReceiveRequest::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::ReceiveRequest_Compression ReceiveRequest::_internal_compression() const {
+  return static_cast< ::ReceiveRequest_Compression >(_impl_.compression_);
+}
+inline ::ReceiveRequest_Compression ReceiveRequest::compression() const {
+  // @@protoc_insertion_point(field_get:ReceiveRequest.compression)
+  return _internal_compression();
+}
+inline void ReceiveRequest::_internal_set_compression(::ReceiveRequest_Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void ReceiveRequest::set_compression(::ReceiveRequest_Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:ReceiveRequest.compression)
+}
+
+// string federation_peer = 10;
+inline void ReceiveRequest::clear_federation_peer() {
+  _impl_.federation_peer_.ClearToEmpty();
+}
+inline const std::string& ReceiveRequest::federation_peer() const {
+  // @@protoc_insertion_point(field_get:ReceiveRequest.federation_peer)
+  return _internal_federation_peer();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReceiveRequest::set_federation_peer(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.federation_peer_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ReceiveRequest.federation_peer)
+}
+inline std::string* ReceiveRequest::mutable_federation_peer() {
+  std::string* _s = _internal_mutable_federation_peer();
+  // @@protoc_insertion_point(field_mutable:ReceiveRequest.federation_peer)
+  return _s;
+}
+inline const std::string& ReceiveRequest::_internal_federation_peer() const {
+  return _impl_.federation_peer_.Get();
+}
+inline void ReceiveRequest::_internal_set_federation_peer(const std::string& value) {
+  
+  _impl_.federation_peer_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReceiveRequest::_internal_mutable_federation_peer() {
+  
+  return _impl_.federation_peer_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReceiveRequest::release_federation_peer() {
+  // @@protoc_insertion_point(field_release:ReceiveRequest.federation_peer)
+  return _impl_.federation_peer_.Release();
+}
+inline void ReceiveRequest::set_allocated_federation_peer(std::string* federation_peer) {
+  if (federation_peer != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.federation_peer_.SetAllocated(federation_peer, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.federation_peer_.IsDefault()) {
+    _impl_.federation_peer_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ReceiveRequest.federation_peer)
+}
+
+// .ReceiveRequest.Conflation conflation = 11;
+inline void ReceiveRequest::clear_conflation() {
+  _impl_.conflation_ = 0;
+}
+inline ::ReceiveRequest_Conflation ReceiveRequest::_internal_conflation() const {
+  return static_cast< ::ReceiveRequest_Conflation >(_impl_.conflation_);
+}
+inline ::ReceiveRequest_Conflation ReceiveRequest::conflation() const {
+  // @@protoc_insertion_point(field_get:ReceiveRequest.conflation)
+  return _internal_conflation();
+}
+inline void ReceiveRequest::_internal_set_conflation(::ReceiveRequest_Conflation value) {
+  
+  _impl_.conflation_ = value;
+}
+inline void ReceiveRequest::set_conflation(::ReceiveRequest_Conflation value) {
+  _internal_set_conflation(value);
+  // @@protoc_insertion_point(field_set:ReceiveRequest.conflation)
+}
+
+// uint32 max_rate = 12;
+inline void ReceiveRequest::clear_max_rate() {
+  _impl_.max_rate_ = 0u;
+}
+inline uint32_t ReceiveRequest::_internal_max_rate() const {
+  return _impl_.max_rate_;
+}
+inline uint32_t ReceiveRequest::max_rate() const {
+  // @@protoc_insertion_point(field_get:ReceiveRequest.max_rate)
+  return _internal_max_rate();
+}
+inline void ReceiveRequest::_internal_set_max_rate(uint32_t value) {
+  
+  _impl_.max_rate_ = value;
+}
+inline void ReceiveRequest::set_max_rate(uint32_t value) {
+  _internal_set_max_rate(value);
+  // @@protoc_insertion_point(field_set:ReceiveRequest.max_rate)
+}
+
+// map<string, string> filters = 13;
+inline int ReceiveRequest::_internal_filters_size() const {
+  return _impl_.filters_.size();
+}
+inline int ReceiveRequest::filters_size() const {
+  return _internal_filters_size();
+}
+inline void ReceiveRequest::clear_filters() {
+  _impl_.filters_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+ReceiveRequest::_internal_filters() const {
+  return _impl_.filters_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+ReceiveRequest::filters() const {
+  // @@protoc_insertion_point(field_map:ReceiveRequest.filters)
+  return _internal_filters();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+ReceiveRequest::_internal_mutable_filters() {
+  return _impl_.filters_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+ReceiveRequest::mutable_filters() {
+  // @@protoc_insertion_point(field_mutable_map:ReceiveRequest.filters)
+  return _internal_mutable_filters();
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// SubscribeRequest
+
+// repeated string subscribe = 1;
+inline int SubscribeRequest::_internal_subscribe_size() const {
+  return _impl_.subscribe_.size();
+}
+inline int SubscribeRequest::subscribe_size() const {
+  return _internal_subscribe_size();
+}
+inline void SubscribeRequest::clear_subscribe() {
+  _impl_.subscribe_.Clear();
+}
+inline std::string* SubscribeRequest::add_subscribe() {
+  std::string* _s = _internal_add_subscribe();
+  // @@protoc_insertion_point(field_add_mutable:SubscribeRequest.subscribe)
+  return _s;
+}
+inline const std::string& SubscribeRequest::_internal_subscribe(int index) const {
+  return _impl_.subscribe_.Get(index);
+}
+inline const std::string& SubscribeRequest::subscribe(int index) const {
+  // @@protoc_insertion_point(field_get:SubscribeRequest.subscribe)
+  return _internal_subscribe(index);
+}
+inline std::string* SubscribeRequest::mutable_subscribe(int index) {
+  // @@protoc_insertion_point(field_mutable:SubscribeRequest.subscribe)
+  return _impl_.subscribe_.Mutable(index);
+}
+inline void SubscribeRequest::set_subscribe(int index, const std::string& value) {
+  _impl_.subscribe_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:SubscribeRequest.subscribe)
+}
+inline void SubscribeRequest::set_subscribe(int index, std::string&& value) {
+  _impl_.subscribe_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:SubscribeRequest.subscribe)
+}
+inline void SubscribeRequest::set_subscribe(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.subscribe_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:SubscribeRequest.subscribe)
+}
+inline void SubscribeRequest::set_subscribe(int index, const char* value, size_t size) {
+  _impl_.subscribe_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:SubscribeRequest.subscribe)
+}
+inline std::string* SubscribeRequest::_internal_add_subscribe() {
+  return _impl_.subscribe_.Add();
+}
+inline void SubscribeRequest::add_subscribe(const std::string& value) {
+  _impl_.subscribe_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:SubscribeRequest.subscribe)
+}
+inline void SubscribeRequest::add_subscribe(std::string&& value) {
+  _impl_.subscribe_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:SubscribeRequest.subscribe)
+}
+inline void SubscribeRequest::add_subscribe(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.subscribe_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:SubscribeRequest.subscribe)
+}
+inline void SubscribeRequest::add_subscribe(const char* value, size_t size) {
+  _impl_.subscribe_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:SubscribeRequest.subscribe)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SubscribeRequest::subscribe() const {
+  // @@protoc_insertion_point(field_list:SubscribeRequest.subscribe)
+  return _impl_.subscribe_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SubscribeRequest::mutable_subscribe() {
+  // @@protoc_insertion_point(field_mutable_list:SubscribeRequest.subscribe)
+  return &_impl_.subscribe_;
+}
+
+// repeated string unsubscribe = 2;
+inline int SubscribeRequest::_internal_unsubscribe_size() const {
+  return _impl_.unsubscribe_.size();
+}
+inline int SubscribeRequest::unsubscribe_size() const {
+  return _internal_unsubscribe_size();
+}
+inline void SubscribeRequest::clear_unsubscribe() {
+  _impl_.unsubscribe_.Clear();
+}
+inline std::string* SubscribeRequest::add_unsubscribe() {
+  std::string* _s = _internal_add_unsubscribe();
+  // @@protoc_insertion_point(field_add_mutable:SubscribeRequest.unsubscribe)
+  return _s;
+}
+inline const std::string& SubscribeRequest::_internal_unsubscribe(int index) const {
+  return _impl_.unsubscribe_.Get(index);
+}
+inline const std::string& SubscribeRequest::unsubscribe(int index) const {
+  // @@protoc_insertion_point(field_get:SubscribeRequest.unsubscribe)
+  return _internal_unsubscribe(index);
+}
+inline std::string* SubscribeRequest::mutable_unsubscribe(int index) {
+  // @@protoc_insertion_point(field_mutable:SubscribeRequest.unsubscribe)
+  return _impl_.unsubscribe_.Mutable(index);
+}
+inline void SubscribeRequest::set_unsubscribe(int index, const std::string& value) {
+  _impl_.unsubscribe_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:SubscribeRequest.unsubscribe)
+}
+inline void SubscribeRequest::set_unsubscribe(int index, std::string&& value) {
+  _impl_.unsubscribe_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:SubscribeRequest.unsubscribe)
+}
+inline void SubscribeRequest::set_unsubscribe(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.unsubscribe_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:SubscribeRequest.unsubscribe)
+}
+inline void SubscribeRequest::set_unsubscribe(int index, const char* value, size_t size) {
+  _impl_.unsubscribe_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:SubscribeRequest.unsubscribe)
+}
+inline std::string* SubscribeRequest::_internal_add_unsubscribe() {
+  return _impl_.unsubscribe_.Add();
+}
+inline void SubscribeRequest::add_unsubscribe(const std::string& value) {
+  _impl_.unsubscribe_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:SubscribeRequest.unsubscribe)
+}
+inline void SubscribeRequest::add_unsubscribe(std::string&& value) {
+  _impl_.unsubscribe_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:SubscribeRequest.unsubscribe)
+}
+inline void SubscribeRequest::add_unsubscribe(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.unsubscribe_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:SubscribeRequest.unsubscribe)
+}
+inline void SubscribeRequest::add_unsubscribe(const char* value, size_t size) {
+  _impl_.unsubscribe_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:SubscribeRequest.unsubscribe)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SubscribeRequest::unsubscribe() const {
+  // @@protoc_insertion_point(field_list:SubscribeRequest.unsubscribe)
+  return _impl_.unsubscribe_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SubscribeRequest::mutable_unsubscribe() {
+  // @@protoc_insertion_point(field_mutable_list:SubscribeRequest.unsubscribe)
+  return &_impl_.unsubscribe_;
+}
+
+// map<string, uint64> start_offsets = 3;
+inline int SubscribeRequest::_internal_start_offsets_size() const {
+  return _impl_.start_offsets_.size();
+}
+inline int SubscribeRequest::start_offsets_size() const {
+  return _internal_start_offsets_size();
+}
+inline void SubscribeRequest::clear_start_offsets() {
+  _impl_.start_offsets_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+SubscribeRequest::_internal_start_offsets() const {
+  return _impl_.start_offsets_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >&
+SubscribeRequest::start_offsets() const {
+  // @@protoc_insertion_point(field_map:SubscribeRequest.start_offsets)
+  return _internal_start_offsets();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+SubscribeRequest::_internal_mutable_start_offsets() {
+  return _impl_.start_offsets_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, uint64_t >*
+SubscribeRequest::mutable_start_offsets() {
+  // @@protoc_insertion_point(field_mutable_map:SubscribeRequest.start_offsets)
+  return _internal_mutable_start_offsets();
+}
+
+// .ReceiveRequest delivery = 4;
+inline bool SubscribeRequest::_internal_has_delivery() const {
+  return this != internal_default_instance() && _impl_.delivery_ != nullptr;
+}
+inline bool SubscribeRequest::has_delivery() const {
+  return _internal_has_delivery();
+}
+inline void SubscribeRequest::clear_delivery() {
+  if (GetArenaForAllocation() == nullptr && _impl_.delivery_ != nullptr) {
+    delete _impl_.delivery_;
+  }
+  _impl_.delivery_ = nullptr;
+}
+inline const ::ReceiveRequest& SubscribeRequest::_internal_delivery() const {
+  const ::ReceiveRequest* p = _impl_.delivery_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ReceiveRequest&>(
+      ::_ReceiveRequest_default_instance_);
+}
+inline const ::ReceiveRequest& SubscribeRequest::delivery() const {
+  // @@protoc_insertion_point(field_get:SubscribeRequest.delivery)
+  return _internal_delivery();
+}
+inline void SubscribeRequest::unsafe_arena_set_allocated_delivery(
+    ::ReceiveRequest* delivery) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.delivery_);
+  }
+  _impl_.delivery_ = delivery;
+  if (delivery) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SubscribeRequest.delivery)
+}
+inline ::ReceiveRequest* SubscribeRequest::release_delivery() {
+  
+  ::ReceiveRequest* temp = _impl_.delivery_;
+  _impl_.delivery_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ReceiveRequest* SubscribeRequest::unsafe_arena_release_delivery() {
+  // @@protoc_insertion_point(field_release:SubscribeRequest.delivery)
+  
+  ::ReceiveRequest* temp = _impl_.delivery_;
+  _impl_.delivery_ = nullptr;
+  return temp;
+}
+inline ::ReceiveRequest* SubscribeRequest::_internal_mutable_delivery() {
+  
+  if (_impl_.delivery_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ReceiveRequest>(GetArenaForAllocation());
+    _impl_.delivery_ = p;
+  }
+  return _impl_.delivery_;
+}
+inline ::ReceiveRequest* SubscribeRequest::mutable_delivery() {
+  ::ReceiveRequest* _msg = _internal_mutable_delivery();
+  // @@protoc_insertion_point(field_mutable:SubscribeRequest.delivery)
+  return _msg;
+}
+inline void SubscribeRequest::set_allocated_delivery(::ReceiveRequest* delivery) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.delivery_;
+  }
+  if (delivery) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(delivery);
+    if (message_arena != submessage_arena) {
+      delivery = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, delivery, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.delivery_ = delivery;
+  // @@protoc_insertion_point(field_set_allocated:SubscribeRequest.delivery)
+}
+
+// .AckSettings acks = 5;
+inline bool SubscribeRequest::_internal_has_acks() const {
+  return this != internal_default_instance() && _impl_.acks_ != nullptr;
+}
+inline bool SubscribeRequest::has_acks() const {
+  return _internal_has_acks();
+}
+inline void SubscribeRequest::clear_acks() {
+  if (GetArenaForAllocation() == nullptr && _impl_.acks_ != nullptr) {
+    delete _impl_.acks_;
+  }
+  _impl_.acks_ = nullptr;
+}
+inline const ::AckSettings& SubscribeRequest::_internal_acks() const {
+  const ::AckSettings* p = _impl_.acks_;
+  return p != nullptr ? *p : reinterpret_cast<const ::AckSettings&>(
+      ::_AckSettings_default_instance_);
+}
+inline const ::AckSettings& SubscribeRequest::acks() const {
+  // @@protoc_insertion_point(field_get:SubscribeRequest.acks)
+  return _internal_acks();
+}
+inline void SubscribeRequest::unsafe_arena_set_allocated_acks(
+    ::AckSettings* acks) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.acks_);
+  }
+  _impl_.acks_ = acks;
+  if (acks) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SubscribeRequest.acks)
+}
+inline ::AckSettings* SubscribeRequest::release_acks() {
+  
+  ::AckSettings* temp = _impl_.acks_;
+  _impl_.acks_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::AckSettings* SubscribeRequest::unsafe_arena_release_acks() {
+  // @@protoc_insertion_point(field_release:SubscribeRequest.acks)
+  
+  ::AckSettings* temp = _impl_.acks_;
+  _impl_.acks_ = nullptr;
+  return temp;
+}
+inline ::AckSettings* SubscribeRequest::_internal_mutable_acks() {
+  
+  if (_impl_.acks_ == nullptr) {
+    auto* p = CreateMaybeMessage<::AckSettings>(GetArenaForAllocation());
+    _impl_.acks_ = p;
+  }
+  return _impl_.acks_;
+}
+inline ::AckSettings* SubscribeRequest::mutable_acks() {
+  ::AckSettings* _msg = _internal_mutable_acks();
+  // @@protoc_insertion_point(field_mutable:SubscribeRequest.acks)
+  return _msg;
+}
+inline void SubscribeRequest::set_allocated_acks(::AckSettings* acks) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.acks_;
+  }
+  if (acks) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(acks);
+    if (message_arena != submessage_arena) {
+      acks = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, acks, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.acks_ = acks;
+  // @@protoc_insertion_point(field_set_allocated:SubscribeRequest.acks)
+}
+
+// uint64 ack = 6;
+inline void SubscribeRequest::clear_ack() {
+  _impl_.ack_ = uint64_t{0u};
+}
+inline uint64_t SubscribeRequest::_internal_ack() const {
+  return _impl_.ack_;
+}
+inline uint64_t SubscribeRequest::ack() const {
+  // @@protoc_insertion_point(field_get:SubscribeRequest.ack)
+  return _internal_ack();
+}
+inline void SubscribeRequest::_internal_set_ack(uint64_t value) {
+  
+  _impl_.ack_ = value;
+}
+inline void SubscribeRequest::set_ack(uint64_t value) {
+  _internal_set_ack(value);
+  // @@protoc_insertion_point(field_set:SubscribeRequest.ack)
+}
+
+// map<string, string> filters = 7;
+inline int SubscribeRequest::_internal_filters_size() const {
+  return _impl_.filters_.size();
+}
+inline int SubscribeRequest::filters_size() const {
+  return _internal_filters_size();
+}
+inline void SubscribeRequest::clear_filters() {
+  _impl_.filters_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+SubscribeRequest::_internal_filters() const {
+  return _impl_.filters_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+SubscribeRequest::filters() const {
+  // @@protoc_insertion_point(field_map:SubscribeRequest.filters)
+  return _internal_filters();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+SubscribeRequest::_internal_mutable_filters() {
+  return _impl_.filters_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+SubscribeRequest::mutable_filters() {
+  // @@protoc_insertion_point(field_mutable_map:SubscribeRequest.filters)
+  return _internal_mutable_filters();
+}
+
+// -------------------------------------------------------------------
+
+// AckSettings
+
+// uint32 window = 1;
+inline void AckSettings::clear_window() {
+  _impl_.window_ = 0u;
+}
+inline uint32_t AckSettings::_internal_window() const {
+  return _impl_.window_;
+}
+inline uint32_t AckSettings::window() const {
+  // @@protoc_insertion_point(field_get:AckSettings.window)
+  return _internal_window();
+}
+inline void AckSettings::_internal_set_window(uint32_t value) {
+  
+  _impl_.window_ = value;
+}
+inline void AckSettings::set_window(uint32_t value) {
+  _internal_set_window(value);
+  // @@protoc_insertion_point(field_set:AckSettings.window)
+}
+
+// uint32 timeout_ms = 2;
+inline void AckSettings::clear_timeout_ms() {
+  _impl_.timeout_ms_ = 0u;
+}
+inline uint32_t AckSettings::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
+}
+inline uint32_t AckSettings::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:AckSettings.timeout_ms)
+  return _internal_timeout_ms();
+}
+inline void AckSettings::_internal_set_timeout_ms(uint32_t value) {
+  
+  _impl_.timeout_ms_ = value;
+}
+inline void AckSettings::set_timeout_ms(uint32_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:AckSettings.timeout_ms)
+}
+
+// string session = 3;
+inline void AckSettings::clear_session() {
+  _impl_.session_.ClearToEmpty();
+}
+inline const std::string& AckSettings::session() const {
+  // @@protoc_insertion_point(field_get:AckSettings.session)
+  return _internal_session();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AckSettings::set_session(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.session_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:AckSettings.session)
+}
+inline std::string* AckSettings::mutable_session() {
+  std::string* _s = _internal_mutable_session();
+  // @@protoc_insertion_point(field_mutable:AckSettings.session)
+  return _s;
+}
+inline const std::string& AckSettings::_internal_session() const {
+  return _impl_.session_.Get();
+}
+inline void AckSettings::_internal_set_session(const std::string& value) {
+  
+  _impl_.session_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AckSettings::_internal_mutable_session() {
+  
+  return _impl_.session_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AckSettings::release_session() {
+  // @@protoc_insertion_point(field_release:AckSettings.session)
+  return _impl_.session_.Release();
+}
+inline void AckSettings::set_allocated_session(std::string* session) {
+  if (session != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.session_.SetAllocated(session, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_.IsDefault()) {
+    _impl_.session_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:AckSettings.session)
+}
+
+// -------------------------------------------------------------------
+
+// ReceiveResponse
+
+// .Message message = 1;
+inline bool ReceiveResponse::_internal_has_message() const {
+  return this != internal_default_instance() && _impl_.message_ != nullptr;
+}
+inline bool ReceiveResponse::has_message() const {
+  return _internal_has_message();
+}
+inline void ReceiveResponse::clear_message() {
+  if (GetArenaForAllocation() == nullptr && _impl_.message_ != nullptr) {
+    delete _impl_.message_;
+  }
+  _impl_.message_ = nullptr;
+}
+inline const ::Message& ReceiveResponse::_internal_message() const {
+  const ::Message* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::Message&>(
+      ::_Message_default_instance_);
+}
+inline const ::Message& ReceiveResponse::message() const {
+  // @@protoc_insertion_point(field_get:ReceiveResponse.message)
+  return _internal_message();
+}
+inline void ReceiveResponse::unsafe_arena_set_allocated_message(
+    ::Message* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ReceiveResponse.message)
+}
+inline ::Message* ReceiveResponse::release_message() {
+  
+  ::Message* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::Message* ReceiveResponse::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:ReceiveResponse.message)
+  
+  ::Message* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::Message* ReceiveResponse::_internal_mutable_message() {
+  
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::Message>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::Message* ReceiveResponse::mutable_message() {
+  ::Message* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:ReceiveResponse.message)
+  return _msg;
+}
+inline void ReceiveResponse::set_allocated_message(::Message* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.message_;
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(message);
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:ReceiveResponse.message)
+}
+
+// repeated .Message messages = 2;
+inline int ReceiveResponse::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int ReceiveResponse::messages_size() const {
+  return _internal_messages_size();
+}
+inline void ReceiveResponse::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::Message* ReceiveResponse::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:ReceiveResponse.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Message >*
+ReceiveResponse::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:ReceiveResponse.messages)
+  return &_impl_.messages_;
+}
+inline const ::Message& ReceiveResponse::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::Message& ReceiveResponse::messages(int index) const {
+  // @@protoc_insertion_point(field_get:ReceiveResponse.messages)
+  return _internal_messages(index);
+}
+inline ::Message* ReceiveResponse::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::Message* ReceiveResponse::add_messages() {
+  ::Message* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:ReceiveResponse.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Message >&
+ReceiveResponse::messages() const {
+  // @@protoc_insertion_point(field_list:ReceiveResponse.messages)
+  return _impl_.messages_;
+}
+
+// uint64 sequence = 3;
+inline void ReceiveResponse::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
+}
+inline uint64_t ReceiveResponse::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t ReceiveResponse::sequence() const {
+  // @@protoc_insertion_point(field_get:ReceiveResponse.sequence)
+  return _internal_sequence();
+}
+inline void ReceiveResponse::_internal_set_sequence(uint64_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void ReceiveResponse::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:ReceiveResponse.sequence)
+}
 
-// ===================================================================
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Message
+// StatsRequest
+
+// -------------------------------------------------------------------
+
+// TopicStats
 
 // string topic = 1;
-inline void Message::clear_topic() {
-  topic_.ClearToEmpty();
+inline void TopicStats::clear_topic() {
+  _impl_.topic_.ClearToEmpty();
 }
-inline const std::string& Message::topic() const {
-  // @@protoc_insertion_point(field_get:Message.topic)
+inline const std::string& TopicStats::topic() const {
+  // @@protoc_insertion_point(field_get:TopicStats.topic)
   return _internal_topic();
 }
-inline void Message::set_topic(const std::string& value) {
-  _internal_set_topic(value);
-  // @@protoc_insertion_point(field_set:Message.topic)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TopicStats::set_topic(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.topic_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TopicStats.topic)
 }
-inline std::string* Message::mutable_topic() {
-  // @@protoc_insertion_point(field_mutable:Message.topic)
-  return _internal_mutable_topic();
+inline std::string* TopicStats::mutable_topic() {
+  std::string* _s = _internal_mutable_topic();
+  // @@protoc_insertion_point(field_mutable:TopicStats.topic)
+  return _s;
 }
-inline const std::string& Message::_internal_topic() const {
-  return topic_.Get();
+inline const std::string& TopicStats::_internal_topic() const {
+  return _impl_.topic_.Get();
 }
-inline void Message::_internal_set_topic(const std::string& value) {
+inline void TopicStats::_internal_set_topic(const std::string& value) {
   
-  topic_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+  _impl_.topic_.Set(value, GetArenaForAllocation());
 }
-inline void Message::set_topic(std::string&& value) {
+inline std::string* TopicStats::_internal_mutable_topic() {
   
-  topic_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Message.topic)
+  return _impl_.topic_.Mutable(GetArenaForAllocation());
 }
-inline void Message::set_topic(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline std::string* TopicStats::release_topic() {
+  // @@protoc_insertion_point(field_release:TopicStats.topic)
+  return _impl_.topic_.Release();
+}
+inline void TopicStats::set_allocated_topic(std::string* topic) {
+  if (topic != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.topic_.SetAllocated(topic, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.topic_.IsDefault()) {
+    _impl_.topic_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TopicStats.topic)
+}
+
+// uint64 topic_id = 2;
+inline void TopicStats::clear_topic_id() {
+  _impl_.topic_id_ = uint64_t{0u};
+}
+inline uint64_t TopicStats::_internal_topic_id() const {
+  return _impl_.topic_id_;
+}
+inline uint64_t TopicStats::topic_id() const {
+  // @@protoc_insertion_point(field_get:TopicStats.topic_id)
+  return _internal_topic_id();
+}
+inline void TopicStats::_internal_set_topic_id(uint64_t value) {
   
-  topic_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:Message.topic)
+  _impl_.topic_id_ = value;
+}
+inline void TopicStats::set_topic_id(uint64_t value) {
+  _internal_set_topic_id(value);
+  // @@protoc_insertion_point(field_set:TopicStats.topic_id)
+}
+
+// uint64 messages = 3;
+inline void TopicStats::clear_messages() {
+  _impl_.messages_ = uint64_t{0u};
 }
-inline void Message::set_topic(const char* value,
-    size_t size) {
+inline uint64_t TopicStats::_internal_messages() const {
+  return _impl_.messages_;
+}
+inline uint64_t TopicStats::messages() const {
+  // @@protoc_insertion_point(field_get:TopicStats.messages)
+  return _internal_messages();
+}
+inline void TopicStats::_internal_set_messages(uint64_t value) {
   
-  topic_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Message.topic)
+  _impl_.messages_ = value;
 }
-inline std::string* Message::_internal_mutable_topic() {
+inline void TopicStats::set_messages(uint64_t value) {
+  _internal_set_messages(value);
+  // @@protoc_insertion_point(field_set:TopicStats.messages)
+}
+
+// uint64 bytes = 4;
+inline void TopicStats::clear_bytes() {
+  _impl_.bytes_ = uint64_t{0u};
+}
+inline uint64_t TopicStats::_internal_bytes() const {
+  return _impl_.bytes_;
+}
+inline uint64_t TopicStats::bytes() const {
+  // @@protoc_insertion_point(field_get:TopicStats.bytes)
+  return _internal_bytes();
+}
+inline void TopicStats::_internal_set_bytes(uint64_t value) {
   
-  return topic_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  _impl_.bytes_ = value;
 }
-inline std::string* Message::release_topic() {
-  // @@protoc_insertion_point(field_release:Message.topic)
-  return topic_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void TopicStats::set_bytes(uint64_t value) {
+  _internal_set_bytes(value);
+  // @@protoc_insertion_point(field_set:TopicStats.bytes)
 }
-inline void Message::set_allocated_topic(std::string* topic) {
-  if (topic != nullptr) {
+
+// double messages_per_second = 5;
+inline void TopicStats::clear_messages_per_second() {
+  _impl_.messages_per_second_ = 0;
+}
+inline double TopicStats::_internal_messages_per_second() const {
+  return _impl_.messages_per_second_;
+}
+inline double TopicStats::messages_per_second() const {
+  // @@protoc_insertion_point(field_get:TopicStats.messages_per_second)
+  return _internal_messages_per_second();
+}
+inline void TopicStats::_internal_set_messages_per_second(double value) {
+  
+  _impl_.messages_per_second_ = value;
+}
+inline void TopicStats::set_messages_per_second(double value) {
+  _internal_set_messages_per_second(value);
+  // @@protoc_insertion_point(field_set:TopicStats.messages_per_second)
+}
+
+// double bytes_per_second = 6;
+inline void TopicStats::clear_bytes_per_second() {
+  _impl_.bytes_per_second_ = 0;
+}
+inline double TopicStats::_internal_bytes_per_second() const {
+  return _impl_.bytes_per_second_;
+}
+inline double TopicStats::bytes_per_second() const {
+  // @@protoc_insertion_point(field_get:TopicStats.bytes_per_second)
+  return _internal_bytes_per_second();
+}
+inline void TopicStats::_internal_set_bytes_per_second(double value) {
+  
+  _impl_.bytes_per_second_ = value;
+}
+inline void TopicStats::set_bytes_per_second(double value) {
+  _internal_set_bytes_per_second(value);
+  // @@protoc_insertion_point(field_set:TopicStats.bytes_per_second)
+}
+
+// uint64 subscribers = 7;
+inline void TopicStats::clear_subscribers() {
+  _impl_.subscribers_ = uint64_t{0u};
+}
+inline uint64_t TopicStats::_internal_subscribers() const {
+  return _impl_.subscribers_;
+}
+inline uint64_t TopicStats::subscribers() const {
+  // @@protoc_insertion_point(field_get:TopicStats.subscribers)
+  return _internal_subscribers();
+}
+inline void TopicStats::_internal_set_subscribers(uint64_t value) {
+  
+  _impl_.subscribers_ = value;
+}
+inline void TopicStats::set_subscribers(uint64_t value) {
+  _internal_set_subscribers(value);
+  // @@protoc_insertion_point(field_set:TopicStats.subscribers)
+}
+
+// -------------------------------------------------------------------
+
+// SubscriberStats
+
+// uint64 id = 1;
+inline void SubscriberStats::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t SubscriberStats::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t SubscriberStats::id() const {
+  // @@protoc_insertion_point(field_get:SubscriberStats.id)
+  return _internal_id();
+}
+inline void SubscriberStats::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void SubscriberStats::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:SubscriberStats.id)
+}
+
+// uint64 topics = 2;
+inline void SubscriberStats::clear_topics() {
+  _impl_.topics_ = uint64_t{0u};
+}
+inline uint64_t SubscriberStats::_internal_topics() const {
+  return _impl_.topics_;
+}
+inline uint64_t SubscriberStats::topics() const {
+  // @@protoc_insertion_point(field_get:SubscriberStats.topics)
+  return _internal_topics();
+}
+inline void SubscriberStats::_internal_set_topics(uint64_t value) {
+  
+  _impl_.topics_ = value;
+}
+inline void SubscriberStats::set_topics(uint64_t value) {
+  _internal_set_topics(value);
+  // @@protoc_insertion_point(field_set:SubscriberStats.topics)
+}
+
+// uint64 patterns = 3;
+inline void SubscriberStats::clear_patterns() {
+  _impl_.patterns_ = uint64_t{0u};
+}
+inline uint64_t SubscriberStats::_internal_patterns() const {
+  return _impl_.patterns_;
+}
+inline uint64_t SubscriberStats::patterns() const {
+  // @@protoc_insertion_point(field_get:SubscriberStats.patterns)
+  return _internal_patterns();
+}
+inline void SubscriberStats::_internal_set_patterns(uint64_t value) {
+  
+  _impl_.patterns_ = value;
+}
+inline void SubscriberStats::set_patterns(uint64_t value) {
+  _internal_set_patterns(value);
+  // @@protoc_insertion_point(field_set:SubscriberStats.patterns)
+}
+
+// uint64 groups = 4;
+inline void SubscriberStats::clear_groups() {
+  _impl_.groups_ = uint64_t{0u};
+}
+inline uint64_t SubscriberStats::_internal_groups() const {
+  return _impl_.groups_;
+}
+inline uint64_t SubscriberStats::groups() const {
+  // @@protoc_insertion_point(field_get:SubscriberStats.groups)
+  return _internal_groups();
+}
+inline void SubscriberStats::_internal_set_groups(uint64_t value) {
+  
+  _impl_.groups_ = value;
+}
+inline void SubscriberStats::set_groups(uint64_t value) {
+  _internal_set_groups(value);
+  // @@protoc_insertion_point(field_set:SubscriberStats.groups)
+}
+
+// uint64 queue_depth = 5;
+inline void SubscriberStats::clear_queue_depth() {
+  _impl_.queue_depth_ = uint64_t{0u};
+}
+inline uint64_t SubscriberStats::_internal_queue_depth() const {
+  return _impl_.queue_depth_;
+}
+inline uint64_t SubscriberStats::queue_depth() const {
+  // @@protoc_insertion_point(field_get:SubscriberStats.queue_depth)
+  return _internal_queue_depth();
+}
+inline void SubscriberStats::_internal_set_queue_depth(uint64_t value) {
+  
+  _impl_.queue_depth_ = value;
+}
+inline void SubscriberStats::set_queue_depth(uint64_t value) {
+  _internal_set_queue_depth(value);
+  // @@protoc_insertion_point(field_set:SubscriberStats.queue_depth)
+}
+
+// uint64 queue_capacity = 6;
+inline void SubscriberStats::clear_queue_capacity() {
+  _impl_.queue_capacity_ = uint64_t{0u};
+}
+inline uint64_t SubscriberStats::_internal_queue_capacity() const {
+  return _impl_.queue_capacity_;
+}
+inline uint64_t SubscriberStats::queue_capacity() const {
+  // @@protoc_insertion_point(field_get:SubscriberStats.queue_capacity)
+  return _internal_queue_capacity();
+}
+inline void SubscriberStats::_internal_set_queue_capacity(uint64_t value) {
+  
+  _impl_.queue_capacity_ = value;
+}
+inline void SubscriberStats::set_queue_capacity(uint64_t value) {
+  _internal_set_queue_capacity(value);
+  // @@protoc_insertion_point(field_set:SubscriberStats.queue_capacity)
+}
+
+// uint64 max_queue_depth = 7;
+inline void SubscriberStats::clear_max_queue_depth() {
+  _impl_.max_queue_depth_ = uint64_t{0u};
+}
+inline uint64_t SubscriberStats::_internal_max_queue_depth() const {
+  return _impl_.max_queue_depth_;
+}
+inline uint64_t SubscriberStats::max_queue_depth() const {
+  // @@protoc_insertion_point(field_get:SubscriberStats.max_queue_depth)
+  return _internal_max_queue_depth();
+}
+inline void SubscriberStats::_internal_set_max_queue_depth(uint64_t value) {
+  
+  _impl_.max_queue_depth_ = value;
+}
+inline void SubscriberStats::set_max_queue_depth(uint64_t value) {
+  _internal_set_max_queue_depth(value);
+  // @@protoc_insertion_point(field_set:SubscriberStats.max_queue_depth)
+}
+
+// uint64 dropped = 8;
+inline void SubscriberStats::clear_dropped() {
+  _impl_.dropped_ = uint64_t{0u};
+}
+inline uint64_t SubscriberStats::_internal_dropped() const {
+  return _impl_.dropped_;
+}
+inline uint64_t SubscriberStats::dropped() const {
+  // @@protoc_insertion_point(field_get:SubscriberStats.dropped)
+  return _internal_dropped();
+}
+inline void SubscriberStats::_internal_set_dropped(uint64_t value) {
+  
+  _impl_.dropped_ = value;
+}
+inline void SubscriberStats::set_dropped(uint64_t value) {
+  _internal_set_dropped(value);
+  // @@protoc_insertion_point(field_set:SubscriberStats.dropped)
+}
+
+// uint64 conflated = 9;
+inline void SubscriberStats::clear_conflated() {
+  _impl_.conflated_ = uint64_t{0u};
+}
+inline uint64_t SubscriberStats::_internal_conflated() const {
+  return _impl_.conflated_;
+}
+inline uint64_t SubscriberStats::conflated() const {
+  // @@protoc_insertion_point(field_get:SubscriberStats.conflated)
+  return _internal_conflated();
+}
+inline void SubscriberStats::_internal_set_conflated(uint64_t value) {
+  
+  _impl_.conflated_ = value;
+}
+inline void SubscriberStats::set_conflated(uint64_t value) {
+  _internal_set_conflated(value);
+  // @@protoc_insertion_point(field_set:SubscriberStats.conflated)
+}
+
+// bool lightweight = 10;
+inline void SubscriberStats::clear_lightweight() {
+  _impl_.lightweight_ = false;
+}
+inline bool SubscriberStats::_internal_lightweight() const {
+  return _impl_.lightweight_;
+}
+inline bool SubscriberStats::lightweight() const {
+  // @@protoc_insertion_point(field_get:SubscriberStats.lightweight)
+  return _internal_lightweight();
+}
+inline void SubscriberStats::_internal_set_lightweight(bool value) {
+  
+  _impl_.lightweight_ = value;
+}
+inline void SubscriberStats::set_lightweight(bool value) {
+  _internal_set_lightweight(value);
+  // @@protoc_insertion_point(field_set:SubscriberStats.lightweight)
+}
+
+// -------------------------------------------------------------------
+
+// DispatcherThreadStats
+
+// string thread_id = 1;
+inline void DispatcherThreadStats::clear_thread_id() {
+  _impl_.thread_id_.ClearToEmpty();
+}
+inline const std::string& DispatcherThreadStats::thread_id() const {
+  // @@protoc_insertion_point(field_get:DispatcherThreadStats.thread_id)
+  return _internal_thread_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DispatcherThreadStats::set_thread_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.thread_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:DispatcherThreadStats.thread_id)
+}
+inline std::string* DispatcherThreadStats::mutable_thread_id() {
+  std::string* _s = _internal_mutable_thread_id();
+  // @@protoc_insertion_point(field_mutable:DispatcherThreadStats.thread_id)
+  return _s;
+}
+inline const std::string& DispatcherThreadStats::_internal_thread_id() const {
+  return _impl_.thread_id_.Get();
+}
+inline void DispatcherThreadStats::_internal_set_thread_id(const std::string& value) {
+  
+  _impl_.thread_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DispatcherThreadStats::_internal_mutable_thread_id() {
+  
+  return _impl_.thread_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DispatcherThreadStats::release_thread_id() {
+  // @@protoc_insertion_point(field_release:DispatcherThreadStats.thread_id)
+  return _impl_.thread_id_.Release();
+}
+inline void DispatcherThreadStats::set_allocated_thread_id(std::string* thread_id) {
+  if (thread_id != nullptr) {
     
   } else {
     
   }
-  topic_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), topic,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:Message.topic)
+  _impl_.thread_id_.SetAllocated(thread_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.thread_id_.IsDefault()) {
+    _impl_.thread_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:DispatcherThreadStats.thread_id)
+}
+
+// uint64 events = 2;
+inline void DispatcherThreadStats::clear_events() {
+  _impl_.events_ = uint64_t{0u};
+}
+inline uint64_t DispatcherThreadStats::_internal_events() const {
+  return _impl_.events_;
+}
+inline uint64_t DispatcherThreadStats::events() const {
+  // @@protoc_insertion_point(field_get:DispatcherThreadStats.events)
+  return _internal_events();
+}
+inline void DispatcherThreadStats::_internal_set_events(uint64_t value) {
+  
+  _impl_.events_ = value;
+}
+inline void DispatcherThreadStats::set_events(uint64_t value) {
+  _internal_set_events(value);
+  // @@protoc_insertion_point(field_set:DispatcherThreadStats.events)
+}
+
+// double busy_seconds = 3;
+inline void DispatcherThreadStats::clear_busy_seconds() {
+  _impl_.busy_seconds_ = 0;
+}
+inline double DispatcherThreadStats::_internal_busy_seconds() const {
+  return _impl_.busy_seconds_;
+}
+inline double DispatcherThreadStats::busy_seconds() const {
+  // @@protoc_insertion_point(field_get:DispatcherThreadStats.busy_seconds)
+  return _internal_busy_seconds();
+}
+inline void DispatcherThreadStats::_internal_set_busy_seconds(double value) {
+  
+  _impl_.busy_seconds_ = value;
+}
+inline void DispatcherThreadStats::set_busy_seconds(double value) {
+  _internal_set_busy_seconds(value);
+  // @@protoc_insertion_point(field_set:DispatcherThreadStats.busy_seconds)
+}
+
+// double utilization = 4;
+inline void DispatcherThreadStats::clear_utilization() {
+  _impl_.utilization_ = 0;
+}
+inline double DispatcherThreadStats::_internal_utilization() const {
+  return _impl_.utilization_;
+}
+inline double DispatcherThreadStats::utilization() const {
+  // @@protoc_insertion_point(field_get:DispatcherThreadStats.utilization)
+  return _internal_utilization();
+}
+inline void DispatcherThreadStats::_internal_set_utilization(double value) {
+  
+  _impl_.utilization_ = value;
+}
+inline void DispatcherThreadStats::set_utilization(double value) {
+  _internal_set_utilization(value);
+  // @@protoc_insertion_point(field_set:DispatcherThreadStats.utilization)
+}
+
+// -------------------------------------------------------------------
+
+// LatencyHistogram_Bucket
+
+// uint64 up_to_ns = 1;
+inline void LatencyHistogram_Bucket::clear_up_to_ns() {
+  _impl_.up_to_ns_ = uint64_t{0u};
+}
+inline uint64_t LatencyHistogram_Bucket::_internal_up_to_ns() const {
+  return _impl_.up_to_ns_;
+}
+inline uint64_t LatencyHistogram_Bucket::up_to_ns() const {
+  // @@protoc_insertion_point(field_get:LatencyHistogram.Bucket.up_to_ns)
+  return _internal_up_to_ns();
+}
+inline void LatencyHistogram_Bucket::_internal_set_up_to_ns(uint64_t value) {
+  
+  _impl_.up_to_ns_ = value;
+}
+inline void LatencyHistogram_Bucket::set_up_to_ns(uint64_t value) {
+  _internal_set_up_to_ns(value);
+  // @@protoc_insertion_point(field_set:LatencyHistogram.Bucket.up_to_ns)
+}
+
+// uint64 count = 2;
+inline void LatencyHistogram_Bucket::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t LatencyHistogram_Bucket::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t LatencyHistogram_Bucket::count() const {
+  // @@protoc_insertion_point(field_get:LatencyHistogram.Bucket.count)
+  return _internal_count();
+}
+inline void LatencyHistogram_Bucket::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void LatencyHistogram_Bucket::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:LatencyHistogram.Bucket.count)
+}
+
+// -------------------------------------------------------------------
+
+// LatencyHistogram
+
+// uint64 count = 1;
+inline void LatencyHistogram::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t LatencyHistogram::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t LatencyHistogram::count() const {
+  // @@protoc_insertion_point(field_get:LatencyHistogram.count)
+  return _internal_count();
+}
+inline void LatencyHistogram::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void LatencyHistogram::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:LatencyHistogram.count)
+}
+
+// uint64 p50_ns = 2;
+inline void LatencyHistogram::clear_p50_ns() {
+  _impl_.p50_ns_ = uint64_t{0u};
+}
+inline uint64_t LatencyHistogram::_internal_p50_ns() const {
+  return _impl_.p50_ns_;
+}
+inline uint64_t LatencyHistogram::p50_ns() const {
+  // @@protoc_insertion_point(field_get:LatencyHistogram.p50_ns)
+  return _internal_p50_ns();
+}
+inline void LatencyHistogram::_internal_set_p50_ns(uint64_t value) {
+  
+  _impl_.p50_ns_ = value;
+}
+inline void LatencyHistogram::set_p50_ns(uint64_t value) {
+  _internal_set_p50_ns(value);
+  // @@protoc_insertion_point(field_set:LatencyHistogram.p50_ns)
+}
+
+// uint64 p90_ns = 3;
+inline void LatencyHistogram::clear_p90_ns() {
+  _impl_.p90_ns_ = uint64_t{0u};
+}
+inline uint64_t LatencyHistogram::_internal_p90_ns() const {
+  return _impl_.p90_ns_;
 }
-
-// string content = 2;
-inline void Message::clear_content() {
-  content_.ClearToEmpty();
+inline uint64_t LatencyHistogram::p90_ns() const {
+  // @@protoc_insertion_point(field_get:LatencyHistogram.p90_ns)
+  return _internal_p90_ns();
 }
-inline const std::string& Message::content() const {
-  // @@protoc_insertion_point(field_get:Message.content)
-  return _internal_content();
+inline void LatencyHistogram::_internal_set_p90_ns(uint64_t value) {
+  
+  _impl_.p90_ns_ = value;
 }
-inline void Message::set_content(const std::string& value) {
-  _internal_set_content(value);
-  // @@protoc_insertion_point(field_set:Message.content)
+inline void LatencyHistogram::set_p90_ns(uint64_t value) {
+  _internal_set_p90_ns(value);
+  // @@protoc_insertion_point(field_set:LatencyHistogram.p90_ns)
 }
-inline std::string* Message::mutable_content() {
-  // @@protoc_insertion_point(field_mutable:Message.content)
-  return _internal_mutable_content();
+
+// uint64 p99_ns = 4;
+inline void LatencyHistogram::clear_p99_ns() {
+  _impl_.p99_ns_ = uint64_t{0u};
 }
-inline const std::string& Message::_internal_content() const {
-  return content_.Get();
+inline uint64_t LatencyHistogram::_internal_p99_ns() const {
+  return _impl_.p99_ns_;
 }
-inline void Message::_internal_set_content(const std::string& value) {
-  
-  content_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+inline uint64_t LatencyHistogram::p99_ns() const {
+  // @@protoc_insertion_point(field_get:LatencyHistogram.p99_ns)
+  return _internal_p99_ns();
 }
-inline void Message::set_content(std::string&& value) {
+inline void LatencyHistogram::_internal_set_p99_ns(uint64_t value) {
   
-  content_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Message.content)
+  _impl_.p99_ns_ = value;
 }
-inline void Message::set_content(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  content_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:Message.content)
+inline void LatencyHistogram::set_p99_ns(uint64_t value) {
+  _internal_set_p99_ns(value);
+  // @@protoc_insertion_point(field_set:LatencyHistogram.p99_ns)
 }
-inline void Message::set_content(const char* value,
-    size_t size) {
-  
-  content_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Message.content)
+
+// uint64 p999_ns = 5;
+inline void LatencyHistogram::clear_p999_ns() {
+  _impl_.p999_ns_ = uint64_t{0u};
 }
-inline std::string* Message::_internal_mutable_content() {
-  
-  return content_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+inline uint64_t LatencyHistogram::_internal_p999_ns() const {
+  return _impl_.p999_ns_;
 }
-inline std::string* Message::release_content() {
-  // @@protoc_insertion_point(field_release:Message.content)
-  return content_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline uint64_t LatencyHistogram::p999_ns() const {
+  // @@protoc_insertion_point(field_get:LatencyHistogram.p999_ns)
+  return _internal_p999_ns();
 }
-inline void Message::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
-    
-  } else {
-    
-  }
-  content_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), content,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:Message.content)
+inline void LatencyHistogram::_internal_set_p999_ns(uint64_t value) {
+  
+  _impl_.p999_ns_ = value;
+}
+inline void LatencyHistogram::set_p999_ns(uint64_t value) {
+  _internal_set_p999_ns(value);
+  // @@protoc_insertion_point(field_set:LatencyHistogram.p999_ns)
 }
 
-// -------------------------------------------------------------------
-
-// SendRequest
+// uint64 max_ns = 6;
+inline void LatencyHistogram::clear_max_ns() {
+  _impl_.max_ns_ = uint64_t{0u};
+}
+inline uint64_t LatencyHistogram::_internal_max_ns() const {
+  return _impl_.max_ns_;
+}
+inline uint64_t LatencyHistogram::max_ns() const {
+  // @@protoc_insertion_point(field_get:LatencyHistogram.max_ns)
+  return _internal_max_ns();
+}
+inline void LatencyHistogram::_internal_set_max_ns(uint64_t value) {
+  
+  _impl_.max_ns_ = value;
+}
+inline void LatencyHistogram::set_max_ns(uint64_t value) {
+  _internal_set_max_ns(value);
+  // @@protoc_insertion_point(field_set:LatencyHistogram.max_ns)
+}
 
-// repeated .Message messages = 1;
-inline int SendRequest::_internal_messages_size() const {
-  return messages_.size();
+// repeated .LatencyHistogram.Bucket buckets = 7;
+inline int LatencyHistogram::_internal_buckets_size() const {
+  return _impl_.buckets_.size();
 }
-inline int SendRequest::messages_size() const {
-  return _internal_messages_size();
+inline int LatencyHistogram::buckets_size() const {
+  return _internal_buckets_size();
 }
-inline void SendRequest::clear_messages() {
-  messages_.Clear();
+inline void LatencyHistogram::clear_buckets() {
+  _impl_.buckets_.Clear();
 }
-inline ::Message* SendRequest::mutable_messages(int index) {
-  // @@protoc_insertion_point(field_mutable:SendRequest.messages)
-  return messages_.Mutable(index);
+inline ::LatencyHistogram_Bucket* LatencyHistogram::mutable_buckets(int index) {
+  // @@protoc_insertion_point(field_mutable:LatencyHistogram.buckets)
+  return _impl_.buckets_.Mutable(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Message >*
-SendRequest::mutable_messages() {
-  // @@protoc_insertion_point(field_mutable_list:SendRequest.messages)
-  return &messages_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::LatencyHistogram_Bucket >*
+LatencyHistogram::mutable_buckets() {
+  // @@protoc_insertion_point(field_mutable_list:LatencyHistogram.buckets)
+  return &_impl_.buckets_;
 }
-inline const ::Message& SendRequest::_internal_messages(int index) const {
-  return messages_.Get(index);
+inline const ::LatencyHistogram_Bucket& LatencyHistogram::_internal_buckets(int index) const {
+  return _impl_.buckets_.Get(index);
 }
-inline const ::Message& SendRequest::messages(int index) const {
-  // @@protoc_insertion_point(field_get:SendRequest.messages)
-  return _internal_messages(index);
+inline const ::LatencyHistogram_Bucket& LatencyHistogram::buckets(int index) const {
+  // @@protoc_insertion_point(field_get:LatencyHistogram.buckets)
+  return _internal_buckets(index);
 }
-inline ::Message* SendRequest::_internal_add_messages() {
-  return messages_.Add();
+inline ::LatencyHistogram_Bucket* LatencyHistogram::_internal_add_buckets() {
+  return _impl_.buckets_.Add();
 }
-inline ::Message* SendRequest::add_messages() {
-  // @@protoc_insertion_point(field_add:SendRequest.messages)
-  return _internal_add_messages();
+inline ::LatencyHistogram_Bucket* LatencyHistogram::add_buckets() {
+  ::LatencyHistogram_Bucket* _add = _internal_add_buckets();
+  // @@protoc_insertion_point(field_add:LatencyHistogram.buckets)
+  return _add;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Message >&
-SendRequest::messages() const {
-  // @@protoc_insertion_point(field_list:SendRequest.messages)
-  return messages_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::LatencyHistogram_Bucket >&
+LatencyHistogram::buckets() const {
+  // @@protoc_insertion_point(field_list:LatencyHistogram.buckets)
+  return _impl_.buckets_;
 }
 
 // -------------------------------------------------------------------
 
-// SendResponse
-
-// -------------------------------------------------------------------
-
-// ReceiveRequest
+// StatsResponse
 
-// repeated string topics = 1;
-inline int ReceiveRequest::_internal_topics_size() const {
-  return topics_.size();
+// repeated .TopicStats topics = 1;
+inline int StatsResponse::_internal_topics_size() const {
+  return _impl_.topics_.size();
 }
-inline int ReceiveRequest::topics_size() const {
+inline int StatsResponse::topics_size() const {
   return _internal_topics_size();
 }
-inline void ReceiveRequest::clear_topics() {
-  topics_.Clear();
+inline void StatsResponse::clear_topics() {
+  _impl_.topics_.Clear();
 }
-inline std::string* ReceiveRequest::add_topics() {
-  // @@protoc_insertion_point(field_add_mutable:ReceiveRequest.topics)
-  return _internal_add_topics();
+inline ::TopicStats* StatsResponse::mutable_topics(int index) {
+  // @@protoc_insertion_point(field_mutable:StatsResponse.topics)
+  return _impl_.topics_.Mutable(index);
 }
-inline const std::string& ReceiveRequest::_internal_topics(int index) const {
-  return topics_.Get(index);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TopicStats >*
+StatsResponse::mutable_topics() {
+  // @@protoc_insertion_point(field_mutable_list:StatsResponse.topics)
+  return &_impl_.topics_;
 }
-inline const std::string& ReceiveRequest::topics(int index) const {
-  // @@protoc_insertion_point(field_get:ReceiveRequest.topics)
+inline const ::TopicStats& StatsResponse::_internal_topics(int index) const {
+  return _impl_.topics_.Get(index);
+}
+inline const ::TopicStats& StatsResponse::topics(int index) const {
+  // @@protoc_insertion_point(field_get:StatsResponse.topics)
   return _internal_topics(index);
 }
-inline std::string* ReceiveRequest::mutable_topics(int index) {
-  // @@protoc_insertion_point(field_mutable:ReceiveRequest.topics)
-  return topics_.Mutable(index);
+inline ::TopicStats* StatsResponse::_internal_add_topics() {
+  return _impl_.topics_.Add();
 }
-inline void ReceiveRequest::set_topics(int index, const std::string& value) {
-  // @@protoc_insertion_point(field_set:ReceiveRequest.topics)
-  topics_.Mutable(index)->assign(value);
+inline ::TopicStats* StatsResponse::add_topics() {
+  ::TopicStats* _add = _internal_add_topics();
+  // @@protoc_insertion_point(field_add:StatsResponse.topics)
+  return _add;
 }
-inline void ReceiveRequest::set_topics(int index, std::string&& value) {
-  // @@protoc_insertion_point(field_set:ReceiveRequest.topics)
-  topics_.Mutable(index)->assign(std::move(value));
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TopicStats >&
+StatsResponse::topics() const {
+  // @@protoc_insertion_point(field_list:StatsResponse.topics)
+  return _impl_.topics_;
 }
-inline void ReceiveRequest::set_topics(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  topics_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:ReceiveRequest.topics)
+
+// repeated .SubscriberStats subscribers = 2;
+inline int StatsResponse::_internal_subscribers_size() const {
+  return _impl_.subscribers_.size();
 }
-inline void ReceiveRequest::set_topics(int index, const char* value, size_t size) {
-  topics_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:ReceiveRequest.topics)
+inline int StatsResponse::subscribers_size() const {
+  return _internal_subscribers_size();
 }
-inline std::string* ReceiveRequest::_internal_add_topics() {
-  return topics_.Add();
+inline void StatsResponse::clear_subscribers() {
+  _impl_.subscribers_.Clear();
 }
-inline void ReceiveRequest::add_topics(const std::string& value) {
-  topics_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:ReceiveRequest.topics)
+inline ::SubscriberStats* StatsResponse::mutable_subscribers(int index) {
+  // @@protoc_insertion_point(field_mutable:StatsResponse.subscribers)
+  return _impl_.subscribers_.Mutable(index);
 }
-inline void ReceiveRequest::add_topics(std::string&& value) {
-  topics_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:ReceiveRequest.topics)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SubscriberStats >*
+StatsResponse::mutable_subscribers() {
+  // @@protoc_insertion_point(field_mutable_list:StatsResponse.subscribers)
+  return &_impl_.subscribers_;
 }
-inline void ReceiveRequest::add_topics(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  topics_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:ReceiveRequest.topics)
+inline const ::SubscriberStats& StatsResponse::_internal_subscribers(int index) const {
+  return _impl_.subscribers_.Get(index);
 }
-inline void ReceiveRequest::add_topics(const char* value, size_t size) {
-  topics_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:ReceiveRequest.topics)
+inline const ::SubscriberStats& StatsResponse::subscribers(int index) const {
+  // @@protoc_insertion_point(field_get:StatsResponse.subscribers)
+  return _internal_subscribers(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-ReceiveRequest::topics() const {
-  // @@protoc_insertion_point(field_list:ReceiveRequest.topics)
-  return topics_;
+inline ::SubscriberStats* StatsResponse::_internal_add_subscribers() {
+  return _impl_.subscribers_.Add();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-ReceiveRequest::mutable_topics() {
-  // @@protoc_insertion_point(field_mutable_list:ReceiveRequest.topics)
-  return &topics_;
+inline ::SubscriberStats* StatsResponse::add_subscribers() {
+  ::SubscriberStats* _add = _internal_add_subscribers();
+  // @@protoc_insertion_point(field_add:StatsResponse.subscribers)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SubscriberStats >&
+StatsResponse::subscribers() const {
+  // @@protoc_insertion_point(field_list:StatsResponse.subscribers)
+  return _impl_.subscribers_;
 }
 
-// -------------------------------------------------------------------
-
-// ReceiveResponse
+// repeated .DispatcherThreadStats dispatcher_threads = 3;
+inline int StatsResponse::_internal_dispatcher_threads_size() const {
+  return _impl_.dispatcher_threads_.size();
+}
+inline int StatsResponse::dispatcher_threads_size() const {
+  return _internal_dispatcher_threads_size();
+}
+inline void StatsResponse::clear_dispatcher_threads() {
+  _impl_.dispatcher_threads_.Clear();
+}
+inline ::DispatcherThreadStats* StatsResponse::mutable_dispatcher_threads(int index) {
+  // @@protoc_insertion_point(field_mutable:StatsResponse.dispatcher_threads)
+  return _impl_.dispatcher_threads_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::DispatcherThreadStats >*
+StatsResponse::mutable_dispatcher_threads() {
+  // @@protoc_insertion_point(field_mutable_list:StatsResponse.dispatcher_threads)
+  return &_impl_.dispatcher_threads_;
+}
+inline const ::DispatcherThreadStats& StatsResponse::_internal_dispatcher_threads(int index) const {
+  return _impl_.dispatcher_threads_.Get(index);
+}
+inline const ::DispatcherThreadStats& StatsResponse::dispatcher_threads(int index) const {
+  // @@protoc_insertion_point(field_get:StatsResponse.dispatcher_threads)
+  return _internal_dispatcher_threads(index);
+}
+inline ::DispatcherThreadStats* StatsResponse::_internal_add_dispatcher_threads() {
+  return _impl_.dispatcher_threads_.Add();
+}
+inline ::DispatcherThreadStats* StatsResponse::add_dispatcher_threads() {
+  ::DispatcherThreadStats* _add = _internal_add_dispatcher_threads();
+  // @@protoc_insertion_point(field_add:StatsResponse.dispatcher_threads)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::DispatcherThreadStats >&
+StatsResponse::dispatcher_threads() const {
+  // @@protoc_insertion_point(field_list:StatsResponse.dispatcher_threads)
+  return _impl_.dispatcher_threads_;
+}
 
-// .Message message = 1;
-inline bool ReceiveResponse::_internal_has_message() const {
-  return this != internal_default_instance() && message_ != nullptr;
+// .LatencyHistogram publish_to_write = 4;
+inline bool StatsResponse::_internal_has_publish_to_write() const {
+  return this != internal_default_instance() && _impl_.publish_to_write_ != nullptr;
 }
-inline bool ReceiveResponse::has_message() const {
-  return _internal_has_message();
+inline bool StatsResponse::has_publish_to_write() const {
+  return _internal_has_publish_to_write();
 }
-inline void ReceiveResponse::clear_message() {
-  if (GetArena() == nullptr && message_ != nullptr) {
-    delete message_;
+inline void StatsResponse::clear_publish_to_write() {
+  if (GetArenaForAllocation() == nullptr && _impl_.publish_to_write_ != nullptr) {
+    delete _impl_.publish_to_write_;
   }
-  message_ = nullptr;
+  _impl_.publish_to_write_ = nullptr;
 }
-inline const ::Message& ReceiveResponse::_internal_message() const {
-  const ::Message* p = message_;
-  return p != nullptr ? *p : reinterpret_cast<const ::Message&>(
-      ::_Message_default_instance_);
+inline const ::LatencyHistogram& StatsResponse::_internal_publish_to_write() const {
+  const ::LatencyHistogram* p = _impl_.publish_to_write_;
+  return p != nullptr ? *p : reinterpret_cast<const ::LatencyHistogram&>(
+      ::_LatencyHistogram_default_instance_);
 }
-inline const ::Message& ReceiveResponse::message() const {
-  // @@protoc_insertion_point(field_get:ReceiveResponse.message)
-  return _internal_message();
+inline const ::LatencyHistogram& StatsResponse::publish_to_write() const {
+  // @@protoc_insertion_point(field_get:StatsResponse.publish_to_write)
+  return _internal_publish_to_write();
 }
-inline void ReceiveResponse::unsafe_arena_set_allocated_message(
-    ::Message* message) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message_);
+inline void StatsResponse::unsafe_arena_set_allocated_publish_to_write(
+    ::LatencyHistogram* publish_to_write) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.publish_to_write_);
   }
-  message_ = message;
-  if (message) {
+  _impl_.publish_to_write_ = publish_to_write;
+  if (publish_to_write) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ReceiveResponse.message)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:StatsResponse.publish_to_write)
 }
-inline ::Message* ReceiveResponse::release_message() {
+inline ::LatencyHistogram* StatsResponse::release_publish_to_write() {
   
-  ::Message* temp = message_;
-  message_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::LatencyHistogram* temp = _impl_.publish_to_write_;
+  _impl_.publish_to_write_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::Message* ReceiveResponse::unsafe_arena_release_message() {
-  // @@protoc_insertion_point(field_release:ReceiveResponse.message)
+inline ::LatencyHistogram* StatsResponse::unsafe_arena_release_publish_to_write() {
+  // @@protoc_insertion_point(field_release:StatsResponse.publish_to_write)
   
-  ::Message* temp = message_;
-  message_ = nullptr;
+  ::LatencyHistogram* temp = _impl_.publish_to_write_;
+  _impl_.publish_to_write_ = nullptr;
   return temp;
 }
-inline ::Message* ReceiveResponse::_internal_mutable_message() {
+inline ::LatencyHistogram* StatsResponse::_internal_mutable_publish_to_write() {
   
-  if (message_ == nullptr) {
-    auto* p = CreateMaybeMessage<::Message>(GetArena());
-    message_ = p;
+  if (_impl_.publish_to_write_ == nullptr) {
+    auto* p = CreateMaybeMessage<::LatencyHistogram>(GetArenaForAllocation());
+    _impl_.publish_to_write_ = p;
   }
-  return message_;
+  return _impl_.publish_to_write_;
 }
-inline ::Message* ReceiveResponse::mutable_message() {
-  // @@protoc_insertion_point(field_mutable:ReceiveResponse.message)
-  return _internal_mutable_message();
+inline ::LatencyHistogram* StatsResponse::mutable_publish_to_write() {
+  ::LatencyHistogram* _msg = _internal_mutable_publish_to_write();
+  // @@protoc_insertion_point(field_mutable:StatsResponse.publish_to_write)
+  return _msg;
 }
-inline void ReceiveResponse::set_allocated_message(::Message* message) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+inline void StatsResponse::set_allocated_publish_to_write(::LatencyHistogram* publish_to_write) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete message_;
+    delete _impl_.publish_to_write_;
   }
-  if (message) {
+  if (publish_to_write) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(message);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(publish_to_write);
     if (message_arena != submessage_arena) {
-      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, message, submessage_arena);
+      publish_to_write = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, publish_to_write, submessage_arena);
     }
     
   } else {
     
   }
-  message_ = message;
-  // @@protoc_insertion_point(field_set_allocated:ReceiveResponse.message)
+  _impl_.publish_to_write_ = publish_to_write;
+  // @@protoc_insertion_point(field_set_allocated:StatsResponse.publish_to_write)
+}
+
+// -------------------------------------------------------------------
+
+// DictionariesRequest
+
+// repeated uint64 topic_ids = 1;
+inline int DictionariesRequest::_internal_topic_ids_size() const {
+  return _impl_.topic_ids_.size();
+}
+inline int DictionariesRequest::topic_ids_size() const {
+  return _internal_topic_ids_size();
+}
+inline void DictionariesRequest::clear_topic_ids() {
+  _impl_.topic_ids_.Clear();
+}
+inline uint64_t DictionariesRequest::_internal_topic_ids(int index) const {
+  return _impl_.topic_ids_.Get(index);
+}
+inline uint64_t DictionariesRequest::topic_ids(int index) const {
+  // @@protoc_insertion_point(field_get:DictionariesRequest.topic_ids)
+  return _internal_topic_ids(index);
+}
+inline void DictionariesRequest::set_topic_ids(int index, uint64_t value) {
+  _impl_.topic_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:DictionariesRequest.topic_ids)
+}
+inline void DictionariesRequest::_internal_add_topic_ids(uint64_t value) {
+  _impl_.topic_ids_.Add(value);
+}
+inline void DictionariesRequest::add_topic_ids(uint64_t value) {
+  _internal_add_topic_ids(value);
+  // @@protoc_insertion_point(field_add:DictionariesRequest.topic_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+DictionariesRequest::_internal_topic_ids() const {
+  return _impl_.topic_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+DictionariesRequest::topic_ids() const {
+  // @@protoc_insertion_point(field_list:DictionariesRequest.topic_ids)
+  return _internal_topic_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+DictionariesRequest::_internal_mutable_topic_ids() {
+  return &_impl_.topic_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+DictionariesRequest::mutable_topic_ids() {
+  // @@protoc_insertion_point(field_mutable_list:DictionariesRequest.topic_ids)
+  return _internal_mutable_topic_ids();
+}
+
+// -------------------------------------------------------------------
+
+// Dictionary
+
+// uint64 topic_id = 1;
+inline void Dictionary::clear_topic_id() {
+  _impl_.topic_id_ = uint64_t{0u};
+}
+inline uint64_t Dictionary::_internal_topic_id() const {
+  return _impl_.topic_id_;
+}
+inline uint64_t Dictionary::topic_id() const {
+  // @@protoc_insertion_point(field_get:Dictionary.topic_id)
+  return _internal_topic_id();
+}
+inline void Dictionary::_internal_set_topic_id(uint64_t value) {
+  
+  _impl_.topic_id_ = value;
+}
+inline void Dictionary::set_topic_id(uint64_t value) {
+  _internal_set_topic_id(value);
+  // @@protoc_insertion_point(field_set:Dictionary.topic_id)
+}
+
+// uint32 id = 2;
+inline void Dictionary::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t Dictionary::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t Dictionary::id() const {
+  // @@protoc_insertion_point(field_get:Dictionary.id)
+  return _internal_id();
+}
+inline void Dictionary::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Dictionary::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:Dictionary.id)
+}
+
+// bytes data = 3;
+inline void Dictionary::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& Dictionary::data() const {
+  // @@protoc_insertion_point(field_get:Dictionary.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Dictionary::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:Dictionary.data)
+}
+inline std::string* Dictionary::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:Dictionary.data)
+  return _s;
+}
+inline const std::string& Dictionary::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void Dictionary::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Dictionary::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Dictionary::release_data() {
+  // @@protoc_insertion_point(field_release:Dictionary.data)
+  return _impl_.data_.Release();
+}
+inline void Dictionary::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:Dictionary.data)
+}
+
+// -------------------------------------------------------------------
+
+// DictionariesResponse
+
+// repeated .Dictionary dictionaries = 1;
+inline int DictionariesResponse::_internal_dictionaries_size() const {
+  return _impl_.dictionaries_.size();
+}
+inline int DictionariesResponse::dictionaries_size() const {
+  return _internal_dictionaries_size();
+}
+inline void DictionariesResponse::clear_dictionaries() {
+  _impl_.dictionaries_.Clear();
+}
+inline ::Dictionary* DictionariesResponse::mutable_dictionaries(int index) {
+  // @@protoc_insertion_point(field_mutable:DictionariesResponse.dictionaries)
+  return _impl_.dictionaries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Dictionary >*
+DictionariesResponse::mutable_dictionaries() {
+  // @@protoc_insertion_point(field_mutable_list:DictionariesResponse.dictionaries)
+  return &_impl_.dictionaries_;
+}
+inline const ::Dictionary& DictionariesResponse::_internal_dictionaries(int index) const {
+  return _impl_.dictionaries_.Get(index);
+}
+inline const ::Dictionary& DictionariesResponse::dictionaries(int index) const {
+  // @@protoc_insertion_point(field_get:DictionariesResponse.dictionaries)
+  return _internal_dictionaries(index);
+}
+inline ::Dictionary* DictionariesResponse::_internal_add_dictionaries() {
+  return _impl_.dictionaries_.Add();
+}
+inline ::Dictionary* DictionariesResponse::add_dictionaries() {
+  ::Dictionary* _add = _internal_add_dictionaries();
+  // @@protoc_insertion_point(field_add:DictionariesResponse.dictionaries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Dictionary >&
+DictionariesResponse::dictionaries() const {
+  // @@protoc_insertion_point(field_list:DictionariesResponse.dictionaries)
+  return _impl_.dictionaries_;
 }
 
 #ifdef __GNUC__
@@ -1163,10 +7171,75 @@ inline void ReceiveResponse::set_allocated_message(::Message* message) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::ReceiveRequest_GroupBalancing> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ReceiveRequest_GroupBalancing>() {
+  return ::ReceiveRequest_GroupBalancing_descriptor();
+}
+template <> struct is_proto_enum< ::ReceiveRequest_Compression> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ReceiveRequest_Compression>() {
+  return ::ReceiveRequest_Compression_descriptor();
+}
+template <> struct is_proto_enum< ::ReceiveRequest_OverflowPolicy> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ReceiveRequest_OverflowPolicy>() {
+  return ::ReceiveRequest_OverflowPolicy_descriptor();
+}
+template <> struct is_proto_enum< ::ReceiveRequest_Conflation> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ReceiveRequest_Conflation>() {
+  return ::ReceiveRequest_Conflation_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
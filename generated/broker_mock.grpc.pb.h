@@ -5,8 +5,8 @@
 #include "broker.pb.h"
 #include "broker.grpc.pb.h"
 
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/sync_stream.h>
 #include <gmock/gmock.h>
 
 class MockMessageBrokerStub : public MessageBroker::StubInterface {
@@ -17,5 +17,20 @@ class MockMessageBrokerStub : public MessageBroker::StubInterface {
   MOCK_METHOD2(ReceiveRaw, ::grpc::ClientReaderInterface< ::ReceiveResponse>*(::grpc::ClientContext* context, const ::ReceiveRequest& request));
   MOCK_METHOD4(AsyncReceiveRaw, ::grpc::ClientAsyncReaderInterface< ::ReceiveResponse>*(::grpc::ClientContext* context, const ::ReceiveRequest& request, ::grpc::CompletionQueue* cq, void* tag));
   MOCK_METHOD3(PrepareAsyncReceiveRaw, ::grpc::ClientAsyncReaderInterface< ::ReceiveResponse>*(::grpc::ClientContext* context, const ::ReceiveRequest& request, ::grpc::CompletionQueue* cq));
+  MOCK_METHOD3(Resolve, ::grpc::Status(::grpc::ClientContext* context, const ::ResolveRequest& request, ::ResolveResponse* response));
+  MOCK_METHOD3(AsyncResolveRaw, ::grpc::ClientAsyncResponseReaderInterface< ::ResolveResponse>*(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq));
+  MOCK_METHOD3(PrepareAsyncResolveRaw, ::grpc::ClientAsyncResponseReaderInterface< ::ResolveResponse>*(::grpc::ClientContext* context, const ::ResolveRequest& request, ::grpc::CompletionQueue* cq));
+  MOCK_METHOD1(PublishRaw, ::grpc::ClientReaderWriterInterface< ::SendRequest, ::PublishAck>*(::grpc::ClientContext* context));
+  MOCK_METHOD3(AsyncPublishRaw, ::grpc::ClientAsyncReaderWriterInterface<::SendRequest, ::PublishAck>*(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag));
+  MOCK_METHOD2(PrepareAsyncPublishRaw, ::grpc::ClientAsyncReaderWriterInterface<::SendRequest, ::PublishAck>*(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq));
+  MOCK_METHOD1(SubscribeRaw, ::grpc::ClientReaderWriterInterface< ::SubscribeRequest, ::ReceiveResponse>*(::grpc::ClientContext* context));
+  MOCK_METHOD3(AsyncSubscribeRaw, ::grpc::ClientAsyncReaderWriterInterface<::SubscribeRequest, ::ReceiveResponse>*(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag));
+  MOCK_METHOD2(PrepareAsyncSubscribeRaw, ::grpc::ClientAsyncReaderWriterInterface<::SubscribeRequest, ::ReceiveResponse>*(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq));
+  MOCK_METHOD3(Stats, ::grpc::Status(::grpc::ClientContext* context, const ::StatsRequest& request, ::StatsResponse* response));
+  MOCK_METHOD3(AsyncStatsRaw, ::grpc::ClientAsyncResponseReaderInterface< ::StatsResponse>*(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq));
+  MOCK_METHOD3(PrepareAsyncStatsRaw, ::grpc::ClientAsyncResponseReaderInterface< ::StatsResponse>*(::grpc::ClientContext* context, const ::StatsRequest& request, ::grpc::CompletionQueue* cq));
+  MOCK_METHOD3(Dictionaries, ::grpc::Status(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::DictionariesResponse* response));
+  MOCK_METHOD3(AsyncDictionariesRaw, ::grpc::ClientAsyncResponseReaderInterface< ::DictionariesResponse>*(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq));
+  MOCK_METHOD3(PrepareAsyncDictionariesRaw, ::grpc::ClientAsyncResponseReaderInterface< ::DictionariesResponse>*(::grpc::ClientContext* context, const ::DictionariesRequest& request, ::grpc::CompletionQueue* cq));
 };
 
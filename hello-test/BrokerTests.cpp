@@ -0,0 +1,1575 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstring>
+#include <filesystem>
+#include <thread>
+#include <grpcpp/server_builder.h>
+#include "../broker-client/broker-client.h"
+#include "../broker-client/message-batcher.h"
+#include "../message-broker/broker-options.h"
+#include "../message-broker/broker-stats.h"
+#include "../message-broker/compression.h"
+#include "../message-broker/consumer-group.h"
+#include "../message-broker/cumulative-acknowledger.h"
+#include "../message-broker/embedded-broker.h"
+#include "../message-broker/encoded-message.h"
+#include "../message-broker/in-flight-window.h"
+#include "../message-broker/last-value-cache.h"
+#include "../message-broker/light-subscriptions.h"
+#include "../message-broker/message-filter.h"
+#include "../message-broker/outbound-queue.h"
+#include "../message-broker/publish-reactor.h"
+#include "../message-broker/request-arenas.h"
+#include "../message-broker/shard-balancer.h"
+#include "../message-broker/topic-interest.h"
+#include "../message-broker/topic-log.h"
+#include "../message-broker/topic-partitions.h"
+#include "../message-broker/topic-registry.h"
+#include "../message-broker/topic-trie.h"
+
+using namespace testing;
+
+static grpc::ByteBuffer FrameOf(const std::string& content)
+{
+	const grpc::Slice slice{ content };
+	return grpc::ByteBuffer{ &slice, 1 };
+}
+
+static std::string ContentOf(const grpc::ByteBuffer& frame)
+{
+	std::vector<grpc::Slice> slices;
+	frame.Dump(&slices);
+	std::string content;
+	for (const auto& slice : slices)
+	{
+		content.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+	}
+	return content;
+}
+
+static std::vector<std::string> Drain(OutboundQueue& queue)
+{
+	std::vector<std::string> contents;
+	while (const auto frame = queue.Pop())
+	{
+		contents.push_back(ContentOf(*frame));
+	}
+	return contents;
+}
+
+TEST(OutboundQueueTests, DropOldestShouldMakeRoomForTheIncomingFrame)
+{
+	OutboundQueue queue{ 2, OverflowPolicy::drop_oldest };
+	queue.Push(1, FrameOf("a"));
+	queue.Push(1, FrameOf("b"));
+	EXPECT_THAT(queue.Push(1, FrameOf("c")), Eq(OutboundQueue::PushResult::dropped));
+
+	EXPECT_THAT(queue.Stats().dropped, Eq(1));
+	EXPECT_THAT(Drain(queue), ElementsAre("b", "c"));
+}
+
+TEST(OutboundQueueTests, DropNewestShouldKeepThePendingFrames)
+{
+	OutboundQueue queue{ 2, OverflowPolicy::drop_newest };
+	queue.Push(1, FrameOf("a"));
+	queue.Push(1, FrameOf("b"));
+	EXPECT_THAT(queue.Push(1, FrameOf("c")), Eq(OutboundQueue::PushResult::dropped));
+
+	EXPECT_THAT(Drain(queue), ElementsAre("a", "b"));
+}
+
+TEST(OutboundQueueTests, ConflateShouldReplaceThePendingFrameWithTheSameKey)
+{
+	OutboundQueue queue{ 2, OverflowPolicy::conflate };
+	queue.Push(1, FrameOf("a1"));
+	queue.Push(2, FrameOf("b1"));
+	EXPECT_THAT(queue.Push(1, FrameOf("a2")), Eq(OutboundQueue::PushResult::conflated));
+	// no pending frames with key 3, the oldest is dropped
+	EXPECT_THAT(queue.Push(3, FrameOf("c1")), Eq(OutboundQueue::PushResult::dropped));
+
+	EXPECT_THAT(queue.Stats().conflated, Eq(1));
+	EXPECT_THAT(queue.Stats().dropped, Eq(1));
+	EXPECT_THAT(Drain(queue), ElementsAre("b1", "c1"));
+}
+
+TEST(OutboundQueueTests, DisconnectShouldReportTheOverflow)
+{
+	OutboundQueue queue{ 1, OverflowPolicy::disconnect };
+	EXPECT_THAT(queue.Push(1, FrameOf("a")), Eq(OutboundQueue::PushResult::queued));
+	EXPECT_THAT(queue.Push(1, FrameOf("b")), Eq(OutboundQueue::PushResult::overflow));
+}
+
+TEST(OutboundQueueTests, StatsShouldTrackTheMaximumDepth)
+{
+	OutboundQueue queue{ 10, OverflowPolicy::drop_oldest };
+	queue.Push(1, FrameOf("a"));
+	queue.Push(1, FrameOf("b"));
+	queue.Pop();
+
+	EXPECT_THAT(queue.Stats().depth, Eq(1));
+	EXPECT_THAT(queue.Stats().maxDepth, Eq(2));
+}
+
+TEST(OutboundQueueTests, TakeAllShouldEmptyTheQueueKeepingTheKeys)
+{
+	OutboundQueue queue{ 10, OverflowPolicy::drop_oldest };
+	queue.Push(1, FrameOf("a"));
+	queue.Push(2, FrameOf("b"));
+
+	const auto frames = queue.TakeAll();
+	ASSERT_THAT(frames.size(), Eq(2));
+	EXPECT_THAT(frames[1].first, Eq(2));
+	EXPECT_THAT(ContentOf(frames[1].second), Eq("b"));
+	EXPECT_TRUE(queue.Empty());
+}
+
+TEST(OutboundQueueTests, ConflatingQueueShouldKeepOnlyTheLatestPendingFramePerKey)
+{
+	OutboundQueue queue{ 10, OverflowPolicy::drop_oldest, true };
+	queue.Push(1, FrameOf("a1"));
+	queue.Push(2, FrameOf("b1"));
+	EXPECT_THAT(queue.Push(1, FrameOf("a2")), Eq(OutboundQueue::PushResult::conflated));
+	EXPECT_THAT(queue.Push(1, FrameOf("a3")), Eq(OutboundQueue::PushResult::conflated));
+	queue.Push(0, FrameOf("x1"));
+	EXPECT_THAT(queue.Push(0, FrameOf("x2")), Eq(OutboundQueue::PushResult::queued)); // 0 is never conflated
+
+	EXPECT_THAT(queue.Stats().conflated, Eq(2));
+	EXPECT_THAT(Drain(queue), ElementsAre("a3", "b1", "x1", "x2"));
+}
+
+TEST(OutboundQueueTests, FramesWrittenShouldNotBeConflatedAnymore)
+{
+	OutboundQueue queue{ 2, OverflowPolicy::drop_oldest, true };
+	queue.Push(1, FrameOf("a1"));
+	queue.Push(2, FrameOf("b1"));
+	const auto written = queue.PopWithKey();
+	ASSERT_TRUE(written);
+	EXPECT_THAT(written->first, Eq(1));
+
+	// "a1" is gone (e.g. it is being written), thus "a2" is pending on its own
+	EXPECT_THAT(queue.Push(1, FrameOf("a2")), Eq(OutboundQueue::PushResult::queued));
+	EXPECT_THAT(queue.Push(3, FrameOf("c1")), Eq(OutboundQueue::PushResult::dropped));
+	EXPECT_THAT(queue.Push(1, FrameOf("a3")), Eq(OutboundQueue::PushResult::conflated));
+	EXPECT_THAT(Drain(queue), ElementsAre("a3", "c1"));
+}
+
+TEST(TopicRegistryTests, InternShouldRegisterEveryTopicOnce)
+{
+	auto channels = 0;
+	TopicRegistry<std::string> registry{ [&](const std::string& name) { ++channels; return "mbox:" + name; } };
+
+	const auto& first = registry.Intern("prices.eu");
+	const auto& second = registry.Intern("prices.us");
+	const auto& again = registry.Intern("prices.eu");
+
+	EXPECT_THAT(&again, Eq(&first));
+	EXPECT_THAT(first.channel, Eq("mbox:prices.eu"));
+	EXPECT_THAT(second.id, Ne(first.id));
+	EXPECT_THAT(channels, Eq(2));
+}
+
+TEST(TopicRegistryTests, FindShouldWorkByNameAndById)
+{
+	TopicRegistry<int> registry{ [](const std::string&) { return 42; } };
+	const auto& topic = registry.Intern("Channel1");
+
+	EXPECT_THAT(registry.Find("Channel1"), Eq(&topic));
+	EXPECT_THAT(registry.Find(topic.id), Eq(&topic));
+	EXPECT_THAT(registry.Find("Channel2"), IsNull());
+	EXPECT_THAT(registry.Find(TopicId{ 0 }), IsNull());
+	EXPECT_THAT(registry.Find(topic.id + 1), IsNull());
+}
+
+TEST(TopicRegistryTests, InternShouldKeepTopicsFindableWhileGrowing)
+{
+	TopicRegistry<int> registry{ [](const std::string&) { return 0; } };
+	std::vector<TopicId> ids;
+	for (auto i = 0; i < 10000; ++i)
+	{
+		ids.push_back(registry.Intern("topic" + std::to_string(i)).id);
+	}
+
+	EXPECT_THAT(registry.Size(), Eq(10000));
+	for (auto i = 0; i < 10000; ++i)
+	{
+		ASSERT_THAT(registry.Find("topic" + std::to_string(i)), NotNull());
+		EXPECT_THAT(registry.Find(ids[i])->name, Eq("topic" + std::to_string(i)));
+	}
+}
+
+TEST(TopicRegistryTests, ConcurrentInternShouldAgreeOnIds)
+{
+	TopicRegistry<int> registry{ [](const std::string&) { return 0; } };
+	std::vector<std::vector<TopicId>> idsByThread(4);
+	std::vector<std::thread> threads;
+	for (auto& ids : idsByThread)
+	{
+		threads.emplace_back([&] {
+			for (auto i = 0; i < 5000; ++i)
+			{
+				ids.push_back(registry.Intern("topic" + std::to_string(i)).id);
+			}
+		});
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	EXPECT_THAT(registry.Size(), Eq(5000));
+	for (const auto& ids : idsByThread)
+	{
+		EXPECT_THAT(ids, Eq(idsByThread.front()));
+	}
+}
+
+class TopicLogTests : public Test
+{
+protected:
+	void SetUp() override
+	{
+		m_directory = std::filesystem::temp_directory_path() / ("hello-test-" + std::string(UnitTest::GetInstance()->current_test_info()->name()));
+		std::filesystem::remove_all(m_directory);
+	}
+
+	void TearDown() override
+	{
+		std::filesystem::remove_all(m_directory);
+	}
+
+	static void AppendAll(TopicLog& log, const std::vector<std::string>& contents)
+	{
+		std::vector<grpc::ByteBuffer> frames;
+		log.Append(contents.size(), [&](size_t index, uint64_t) { return FrameOf(contents[index]); }, frames);
+	}
+
+	static std::vector<std::string> ReadAll(const TopicLog& log, uint64_t offset)
+	{
+		std::vector<std::string> contents;
+		std::vector<grpc::ByteBuffer> frames;
+		while (true)
+		{
+			frames.clear();
+			offset = log.Read(offset, 2, frames);
+			if (frames.empty())
+			{
+				return contents;
+			}
+			offset += frames.size();
+			std::ranges::transform(frames, back_inserter(contents), ContentOf);
+		}
+	}
+
+	std::filesystem::path m_directory;
+};
+
+TEST_F(TopicLogTests, AppendShouldAssignConsecutiveOffsets)
+{
+	TopicLog log{ m_directory, {} };
+	std::vector<grpc::ByteBuffer> frames;
+	std::vector<uint64_t> offsets;
+	const auto first = log.Append(2, [&](size_t, uint64_t offset) { offsets.push_back(offset); return FrameOf("a"); }, frames);
+	const auto second = log.Append(1, [&](size_t, uint64_t offset) { offsets.push_back(offset); return FrameOf("b"); }, frames);
+
+	EXPECT_THAT(first, Eq(0));
+	EXPECT_THAT(second, Eq(2));
+	EXPECT_THAT(offsets, ElementsAre(0, 1, 2));
+	EXPECT_THAT(frames.size(), Eq(3));
+	EXPECT_THAT(log.EndOffset(), Eq(3));
+}
+
+TEST_F(TopicLogTests, ReadShouldReplayFromTheGivenOffset)
+{
+	TopicLog log{ m_directory, {} };
+	AppendAll(log, { "a", "b", "c", "d", "e" });
+
+	EXPECT_THAT(ReadAll(log, 0), ElementsAre("a", "b", "c", "d", "e"));
+	EXPECT_THAT(ReadAll(log, 3), ElementsAre("d", "e"));
+	EXPECT_THAT(ReadAll(log, 5), IsEmpty());
+}
+
+TEST_F(TopicLogTests, LogShouldSurviveReopening)
+{
+	{
+		TopicLog log{ m_directory, { .segmentSize = 64, .fsync = FsyncPolicy::batch } };
+		AppendAll(log, { "first message", "second message", "third message", "fourth message" });
+	}
+	TopicLog log{ m_directory, { .segmentSize = 64 } };
+	AppendAll(log, { "fifth message" });
+
+	EXPECT_THAT(log.EndOffset(), Eq(5));
+	EXPECT_THAT(ReadAll(log, 0), ElementsAre("first message", "second message", "third message", "fourth message", "fifth message"));
+}
+
+TEST_F(TopicLogTests, RetentionShouldDropTheOldestSegments)
+{
+	// every segment holds 2 records of 16 bytes (the 4-byte length included)
+	TopicLog log{ m_directory, { .segmentSize = 32, .retainedSegments = 2 } };
+	AppendAll(log, { "000000000001", "000000000002", "000000000003", "000000000004", "000000000005" });
+
+	EXPECT_THAT(log.StartOffset(), Eq(2));
+	// offsets not retained anymore start from the oldest retained one
+	EXPECT_THAT(ReadAll(log, 0), ElementsAre("000000000003", "000000000004", "000000000005"));
+	EXPECT_THAT(std::distance(std::filesystem::directory_iterator(m_directory), std::filesystem::directory_iterator{}), Eq(2));
+}
+
+TEST_F(TopicLogTests, RecordsBiggerThanSegmentsShouldGetTheirOwnSegment)
+{
+	TopicLog log{ m_directory, { .segmentSize = 16 } };
+	const std::string big(100, 'x');
+	AppendAll(log, { "a", big, "b" });
+
+	EXPECT_THAT(ReadAll(log, 0), ElementsAre("a", big, "b"));
+}
+
+static std::vector<std::string> MatchesOf(const TopicTrie<std::string>& trie, std::string_view topic)
+{
+	std::vector<std::string> matches;
+	trie.Match(topic, [&](const std::string& subscriber) { matches.push_back(subscriber); });
+	return matches;
+}
+
+TEST(BrokerOptionsTests, SizesShouldBeWholeUnsignedNumbers)
+{
+	EXPECT_EQ(42, ParseSize("max-queue", "42"));
+	EXPECT_THROW(ParseSize("max-queue", "-1"), std::invalid_argument);
+	EXPECT_THROW(ParseSize("max-queue", "12abc"), std::invalid_argument);
+	EXPECT_THROW(ParseSize("max-queue", ""), std::invalid_argument);
+	EXPECT_THROW(ParseSize("max-queue", "99999999999999999999999"), std::invalid_argument);
+	EXPECT_THROW(ParsePartitions("orders:8x"), std::invalid_argument);
+	EXPECT_THAT(ParsePartitions("orders:8"), ElementsAre(Pair("orders", 8)));
+}
+
+TEST(TopicTrieTests, IsTopicPatternShouldDetectWholeSegmentWildcards)
+{
+	EXPECT_TRUE(IsTopicPattern("prices.eu.*"));
+	EXPECT_TRUE(IsTopicPattern("#"));
+	EXPECT_TRUE(IsTopicPattern("prices.*.SAP"));
+	EXPECT_FALSE(IsTopicPattern("prices.eu*"));
+	EXPECT_FALSE(IsTopicPattern("prices.eu.XETR.SAP"));
+}
+
+TEST(TopicTrieTests, StarShouldMatchExactlyOneSegment)
+{
+	TopicTrie<std::string> trie;
+	trie.Add("prices.eu.*", 1, "s1");
+	trie.Add("prices.*.XETR", 2, "s2");
+
+	EXPECT_THAT(MatchesOf(trie, "prices.eu.XETR"), ElementsAre("s1", "s2"));
+	EXPECT_THAT(MatchesOf(trie, "prices.eu"), IsEmpty());
+	EXPECT_THAT(MatchesOf(trie, "prices.eu.XETR.SAP"), IsEmpty());
+}
+
+TEST(TopicTrieTests, HashShouldMatchZeroOrMoreSegments)
+{
+	TopicTrie<std::string> trie;
+	trie.Add("prices.#", 1, "s1");
+	trie.Add("#.SAP", 2, "s2");
+
+	EXPECT_THAT(MatchesOf(trie, "prices"), ElementsAre("s1"));
+	EXPECT_THAT(MatchesOf(trie, "prices.eu.XETR.SAP"), ElementsAre("s1", "s2"));
+	EXPECT_THAT(MatchesOf(trie, "SAP"), ElementsAre("s2"));
+	EXPECT_THAT(MatchesOf(trie, "news.eu"), IsEmpty());
+}
+
+TEST(TopicTrieTests, SubscribersShouldBeMatchedOnceEvenIfManyPatternsMatch)
+{
+	TopicTrie<std::string> trie;
+	trie.Add("prices.#", 1, "s1");
+	trie.Add("prices.eu.*", 1, "s1");
+	trie.Add("prices.eu.XETR", 1, "s1");
+
+	EXPECT_THAT(MatchesOf(trie, "prices.eu.XETR"), ElementsAre("s1"));
+}
+
+TEST(TopicTrieTests, RemoveShouldDropOnlyTheGivenSubscription)
+{
+	TopicTrie<std::string> trie;
+	trie.Add("prices.eu.*", 1, "s1");
+	trie.Add("prices.eu.*", 2, "s2");
+	trie.Add("prices.#", 1, "s1");
+
+	trie.Remove("prices.eu.*", 1);
+	EXPECT_THAT(MatchesOf(trie, "prices.eu.XETR"), ElementsAre("s1", "s2"));
+	trie.Remove("prices.#", 1);
+	trie.Remove("prices.#", 1); // not there anymore
+	EXPECT_THAT(MatchesOf(trie, "prices.eu.XETR"), ElementsAre("s2"));
+	EXPECT_THAT(trie.Size(), Eq(1));
+}
+
+TEST(TopicTrieTests, HashesInARowShouldBeTheSameAsOne)
+{
+	TopicTrie<std::string> trie;
+	trie.Add("prices.#.#", 1, "s1");
+
+	EXPECT_THAT(MatchesOf(trie, "prices"), ElementsAre("s1"));
+	EXPECT_THAT(MatchesOf(trie, "prices.eu.XETR"), ElementsAre("s1"));
+	trie.Remove("prices.#", 1);
+	EXPECT_THAT(trie.Size(), Eq(0));
+}
+
+TEST(TopicTrieTests, ManyHashesShouldMatchInBoundedTime)
+{
+	TopicTrie<std::string> trie;
+	trie.Add("#.#.#.#.#.#.#.#.#.#.#.x", 1, "s1");
+	trie.Add("#.a.#.a.#.a.#.a.#.a.#.a.#.a.#.a.#.y", 2, "s2");
+	std::string topic = "a";
+	for (auto i = 0; i < 30; ++i)
+	{
+		topic += ".a";
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	EXPECT_THAT(MatchesOf(trie, topic), IsEmpty());
+	EXPECT_THAT(MatchesOf(trie, topic + ".x"), ElementsAre("s1"));
+	EXPECT_THAT(MatchesOf(trie, topic + ".y"), ElementsAre("s2"));
+	// trying every way the hashes can split the topic takes minutes
+	EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+struct FakeMember
+{
+	std::string name;
+	size_t outstanding = 0;
+
+	[[nodiscard]] size_t Outstanding() const
+	{
+		return outstanding;
+	}
+};
+
+using FakeGroup = ConsumerGroup<FakeMember, int>;
+
+class ConsumerGroupTests : public Test
+{
+protected:
+	auto Recorder()
+	{
+		return [this](const FakeMember& member, int item) { m_delivered.emplace_back(member.name, item); };
+	}
+
+	std::vector<std::pair<std::string, int>> m_delivered;
+};
+
+TEST_F(ConsumerGroupTests, RoundRobinShouldAlternateMembers)
+{
+	FakeGroup group{ GroupBalancing::round_robin, 10 };
+	group.Join(1, { "a" }, Recorder());
+	group.Join(2, { "b" }, Recorder());
+	for (auto i = 0; i < 4; ++i)
+	{
+		group.Dispatch(0, i, Recorder());
+	}
+
+	EXPECT_THAT(m_delivered, ElementsAre(Pair("a", 0), Pair("b", 1), Pair("a", 2), Pair("b", 3)));
+}
+
+TEST_F(ConsumerGroupTests, LeastOutstandingShouldPickTheLeastBusyMember)
+{
+	FakeGroup group{ GroupBalancing::least_outstanding, 10 };
+	group.Join(1, { "a", 5 }, Recorder());
+	group.Join(2, { "b", 2 }, Recorder());
+	group.Join(3, { "c", 7 }, Recorder());
+	group.Dispatch(0, 42, Recorder());
+
+	EXPECT_THAT(m_delivered, ElementsAre(Pair("b", 42)));
+}
+
+TEST_F(ConsumerGroupTests, MessagesWithTheSameKeyShouldStickToTheSameMember)
+{
+	FakeGroup group{ GroupBalancing::round_robin, 10 };
+	group.Join(1, { "a" }, Recorder());
+	group.Join(2, { "b" }, Recorder());
+	group.Join(3, { "c" }, Recorder());
+	for (auto i = 0; i < 5; ++i)
+	{
+		group.Dispatch(KeyHashOf("SAP"), i, Recorder());
+	}
+
+	ASSERT_THAT(m_delivered.size(), Eq(5));
+	EXPECT_THAT(m_delivered, Each(Field(&std::pair<std::string, int>::first, Eq(m_delivered.front().first))));
+}
+
+TEST_F(ConsumerGroupTests, LeavingShouldMoveOnlyTheKeysOfTheMemberThatLeft)
+{
+	FakeGroup group{ GroupBalancing::round_robin, 10 };
+	group.Join(1, { "a" }, Recorder());
+	group.Join(2, { "b" }, Recorder());
+	group.Join(3, { "c" }, Recorder());
+	std::vector<std::string> keys;
+	for (auto i = 0; i < 100; ++i)
+	{
+		keys.push_back("key" + std::to_string(i));
+		group.Dispatch(KeyHashOf(keys.back()), i, Recorder());
+	}
+	const auto before = m_delivered;
+	m_delivered.clear();
+
+	group.Leave(2);
+	for (auto i = 0; i < 100; ++i)
+	{
+		group.Dispatch(KeyHashOf(keys[i]), i, Recorder());
+	}
+
+	for (auto i = 0; i < 100; ++i)
+	{
+		EXPECT_THAT(m_delivered[i].first, Ne("b"));
+		if (before[i].first != "b")
+		{
+			EXPECT_THAT(m_delivered[i].first, Eq(before[i].first));
+		}
+	}
+}
+
+TEST_F(ConsumerGroupTests, MessagesShouldWaitForTheNextMemberWhenTheGroupIsEmpty)
+{
+	FakeGroup group{ GroupBalancing::round_robin, 2 };
+	group.Dispatch(0, 1, Recorder());
+	group.Dispatch(0, 2, Recorder());
+	group.Dispatch(0, 3, Recorder()); // the oldest is dropped
+	EXPECT_THAT(m_delivered, IsEmpty());
+	EXPECT_THAT(group.Backlog(), Eq(2));
+
+	group.Join(1, { "a" }, Recorder());
+	EXPECT_THAT(m_delivered, ElementsAre(Pair("a", 2), Pair("a", 3)));
+	EXPECT_THAT(group.Backlog(), Eq(0));
+}
+
+TEST(ConsumerGroupsTests, GroupsShouldExpireOnceEmptyAndNotHeldByFormerMembers)
+{
+	using Groups = ConsumerGroups<FakeMember, int>;
+	Groups groups{ std::chrono::milliseconds(100) };
+	const auto now = Groups::Clock::now();
+	auto billing = groups.Get("billing", GroupBalancing::round_robin, 10, now);
+	billing->Join(1, { "a" }, [](const FakeMember&, int) {});
+	EXPECT_EQ(billing, groups.Get("billing", GroupBalancing::round_robin, 10, now));
+	billing->Leave(1, now);
+	billing->Dispatch(0, 42, [](const FakeMember&, int) {});
+	EXPECT_EQ(1, billing->Backlog());
+
+	// still held by the member that left (e.g. while it hands its pending messages back)
+	groups.Get("audit", GroupBalancing::round_robin, 10, now + std::chrono::milliseconds(200));
+	EXPECT_EQ(2, groups.Size());
+
+	billing.reset();
+	groups.Get("reports", GroupBalancing::round_robin, 10, now + std::chrono::milliseconds(50));
+	EXPECT_EQ(3, groups.Size()); // nothing has expired yet
+	groups.Get("alerts", GroupBalancing::round_robin, 10, now + std::chrono::milliseconds(200));
+	EXPECT_EQ(1, groups.Size());
+	EXPECT_EQ(0, groups.Get("billing", GroupBalancing::round_robin, 10, now + std::chrono::milliseconds(200))->Backlog()); // a new group
+}
+
+TEST(ConsumerGroupsTests, NewGroupsShouldBeRefusedBeyondTheMaximum)
+{
+	using Groups = ConsumerGroups<FakeMember, int>;
+	Groups groups{ std::chrono::minutes(1), 2 };
+	const auto first = groups.Get("first", GroupBalancing::round_robin, 10);
+	const auto second = groups.Get("second", GroupBalancing::round_robin, 10);
+	EXPECT_THROW(groups.Get("third", GroupBalancing::round_robin, 10), std::length_error);
+	EXPECT_EQ(first, groups.Get("first", GroupBalancing::round_robin, 10));
+	EXPECT_EQ(2, groups.Size());
+}
+
+class CumulativeAcknowledgerTests : public Test
+{
+protected:
+	std::function<bool(uint64_t)> Recorder()
+	{
+		return [this](uint64_t acknowledged) {
+			std::lock_guard lock{ m_mutex };
+			m_acks.push_back(acknowledged);
+			return true;
+		};
+	}
+
+	std::vector<uint64_t> Acks()
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_acks;
+	}
+
+	AckWindowTimer m_timer;
+	std::mutex m_mutex;
+	std::vector<uint64_t> m_acks;
+};
+
+TEST_F(CumulativeAcknowledgerTests, AcksShouldBeCumulativeEveryNMessages)
+{
+	CumulativeAcknowledger acknowledger{ 10, std::chrono::hours(1), Recorder(), m_timer };
+	acknowledger.Accepted(4);
+	acknowledger.Accepted(6);
+	EXPECT_EQ(10, acknowledger.Acknowledged()); // written by the caller
+	acknowledger.Accepted(3);
+	acknowledger.Finish();
+
+	EXPECT_THAT(Acks(), ElementsAre(10, 13));
+}
+
+TEST_F(CumulativeAcknowledgerTests, PendingMessagesShouldBeAcknowledgedWhenTheWindowIsOver)
+{
+	CumulativeAcknowledger acknowledger{ 1000, std::chrono::milliseconds(1), Recorder(), m_timer };
+	acknowledger.Accepted(3);
+	while (acknowledger.Acknowledged() < 3)
+	{
+		std::this_thread::yield();
+	}
+
+	EXPECT_THAT(Acks(), ElementsAre(3));
+}
+
+TEST_F(CumulativeAcknowledgerTests, FinishShouldNotAckIfNothingIsPending)
+{
+	CumulativeAcknowledger acknowledger{ 1, std::chrono::hours(1), Recorder(), m_timer };
+	acknowledger.Finish();
+
+	EXPECT_THAT(Acks(), IsEmpty());
+}
+
+TEST_F(CumulativeAcknowledgerTests, OneTimerShouldServeTheWindowsOfManyStreams)
+{
+	std::vector<std::unique_ptr<CumulativeAcknowledger>> acknowledgers;
+	for (auto i = 0; i < 100; ++i)
+	{
+		acknowledgers.push_back(std::make_unique<CumulativeAcknowledger>(1000, std::chrono::milliseconds(1 + i % 5), Recorder(), m_timer));
+		acknowledgers.back()->Accepted(i + 1);
+	}
+	// an acknowledger going away cancels its window
+	acknowledgers.back().reset();
+	for (auto i = 0; i < 99; ++i)
+	{
+		while (acknowledgers[i]->Acknowledged() < static_cast<uint64_t>(i + 1))
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	EXPECT_THAT(Acks(), SizeIs(100)); // the last one on Finish
+}
+
+// "Publish" alone, served as the broker does (see ServiceImpl::CallbackPublish), every request is accepted
+class PublishOnlyService final : public MessageBroker::Service
+{
+public:
+	PublishOnlyService(uint64_t ackEvery, std::chrono::milliseconds ackWindow)
+	{
+	#ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+		MarkMethodCallback(3,
+	#else
+		experimental().MarkMethodCallback(3,
+	#endif
+			new grpc::internal::CallbackBidiHandler<SendRequest, PublishAck>([=, this]([[maybe_unused]] grpc::CallbackServerContext* context) {
+				return new PublishReactor([](SendRequest&) { return grpc::Status::OK; }, ackEvery, ackWindow, m_timer);
+			}));
+	}
+private:
+	AckWindowTimer m_timer;
+};
+
+TEST(PublishReactorTests, AProducerNotReadingItsAcksShouldNotDelayTheAcksOfTheOthers)
+{
+	PublishOnlyService service{ 1000, std::chrono::milliseconds(1) };
+	grpc::ServerBuilder builder;
+	builder.RegisterService(&service);
+	const auto server = builder.BuildAndStart();
+	const auto stub = MessageBroker::NewStub(server->InProcessChannel(grpc::ChannelArguments{}));
+	SendRequest request;
+	request.add_messages()->set_topic("orders");
+
+	// its acks are never read, thus writing them stops completing
+	grpc::ClientContext stuckContext;
+	const auto stuck = stub->Publish(&stuckContext);
+	for (auto i = 0; i < 100; ++i)
+	{
+		ASSERT_TRUE(stuck->Write(request));
+		std::this_thread::sleep_for(std::chrono::milliseconds(2)); // a window is over now and then
+	}
+
+	grpc::ClientContext context;
+	context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(5));
+	const auto producer = stub->Publish(&context);
+	ASSERT_TRUE(producer->Write(request));
+	PublishAck ack;
+	ASSERT_TRUE(producer->Read(&ack));
+	EXPECT_EQ(1, ack.acknowledged());
+
+	ASSERT_TRUE(producer->WritesDone());
+	EXPECT_TRUE(producer->Finish().ok());
+	stuckContext.TryCancel();
+	server->Shutdown();
+}
+
+TEST(ShardBalancerTests, SubscribersShouldGoToTheLeastLoadedShard)
+{
+	ShardBalancer balancer{ 3 };
+	EXPECT_EQ(0, balancer.Acquire());
+	EXPECT_EQ(1, balancer.Acquire());
+	EXPECT_EQ(2, balancer.Acquire());
+	balancer.Release(1);
+	EXPECT_EQ(1, balancer.Acquire());
+	EXPECT_EQ(0, balancer.Acquire());
+
+	EXPECT_EQ(2, balancer.Load(0));
+	EXPECT_EQ(1, balancer.Load(1));
+	EXPECT_EQ(1, balancer.Load(2));
+}
+
+TEST(ShardBalancerTests, ThereShouldBeAtLeastOneShard)
+{
+	ShardBalancer balancer{ 0 };
+	EXPECT_EQ(1, balancer.Size());
+	EXPECT_EQ(0, balancer.Acquire());
+}
+
+class InFlightWindowTests : public Test
+{
+protected:
+	using Window = InFlightWindow<std::string>;
+
+	auto Recorder()
+	{
+		return [this](uint64_t sequence, const std::string& item) {
+			m_sent.emplace_back(sequence, item);
+		};
+	}
+
+	std::vector<std::pair<uint64_t, std::string>> TakeSent()
+	{
+		return std::exchange(m_sent, {});
+	}
+
+	Window::Clock::time_point m_now = Window::Clock::now();
+	std::vector<std::pair<uint64_t, std::string>> m_sent;
+};
+
+TEST_F(InFlightWindowTests, ItemsShouldWaitForAcksWhenTheWindowIsFull)
+{
+	Window window{ 2, 1 };
+	EXPECT_TRUE(window.Push("a", m_now, Recorder()));
+	EXPECT_TRUE(window.Push("b", m_now, Recorder()));
+	EXPECT_TRUE(window.Push("c", m_now, Recorder()));
+	EXPECT_FALSE(window.Push("d", m_now, Recorder()));
+	EXPECT_THAT(TakeSent(), ElementsAre(Pair(1, "a"), Pair(2, "b")));
+
+	EXPECT_EQ(1, window.Acknowledge(1, m_now, Recorder()));
+	EXPECT_THAT(TakeSent(), ElementsAre(Pair(3, "c")));
+	EXPECT_EQ(2, window.InFlight());
+	EXPECT_EQ(0, window.Waiting());
+}
+
+TEST_F(InFlightWindowTests, AcksShouldBeCumulative)
+{
+	Window window{ 10, 10 };
+	for (const auto* item : { "a", "b", "c" })
+	{
+		window.Push(item, m_now, Recorder());
+	}
+	EXPECT_EQ(2, window.Acknowledge(2, m_now, Recorder()));
+	EXPECT_EQ(0, window.Acknowledge(2, m_now, Recorder()));
+	EXPECT_EQ(1, window.Acknowledge(100, m_now, Recorder()));
+	EXPECT_EQ(0, window.InFlight());
+	EXPECT_EQ(3, window.LastSequence());
+}
+
+TEST_F(InFlightWindowTests, ExpiredDeliveriesShouldBeSentAgainWithTheSameSequence)
+{
+	Window window{ 10, 10 };
+	window.Push("a", m_now, Recorder());
+	window.Push("b", m_now + std::chrono::milliseconds(50), Recorder());
+	TakeSent();
+
+	EXPECT_EQ(1, window.RedeliverExpired(m_now + std::chrono::milliseconds(100), std::chrono::milliseconds(100), Recorder()));
+	EXPECT_THAT(TakeSent(), ElementsAre(Pair(1, "a")));
+	window.RedeliverAll(m_now, Recorder());
+	EXPECT_THAT(TakeSent(), ElementsAre(Pair(1, "a"), Pair(2, "b")));
+}
+
+TEST(AckSessionsTests, SessionsShouldBeResumedUntilTheyExpire)
+{
+	using Sessions = AckSessions<std::string>;
+	Sessions sessions{ std::chrono::milliseconds(100) };
+	const auto now = Sessions::Clock::now();
+	const auto window = sessions.Attach("dashboard", 10, 10, now);
+	ASSERT_NE(nullptr, window);
+	EXPECT_EQ(nullptr, sessions.Attach("dashboard", 10, 10, now));
+	EXPECT_NE(window, sessions.Attach("", 10, 10, now));
+
+	sessions.Detach("dashboard", now);
+	EXPECT_EQ(window, sessions.Attach("dashboard", 10, 10, now + std::chrono::milliseconds(50)));
+	sessions.Detach("dashboard", now);
+	EXPECT_NE(window, sessions.Attach("dashboard", 10, 10, now + std::chrono::milliseconds(100)));
+}
+
+TEST(LastValueCacheTests, ValuesShouldBeKeptPerTopicAndKeyInTheOrderTheyWereFirstPut)
+{
+	LastValueCache<std::string> cache{ 1024 * 1024 };
+	cache.Put(1, 0, "a", 1);
+	cache.Put(1, 7, "b", 1);
+	cache.Put(2, 0, "c", 1);
+	cache.Put(1, 0, "A", 1);
+	EXPECT_THAT(cache.Get(1), ElementsAre("A", "b"));
+	EXPECT_THAT(cache.Get(2), ElementsAre("c"));
+	EXPECT_THAT(cache.Get(3), IsEmpty());
+
+	cache.Erase(1, 7);
+	EXPECT_THAT(cache.Get(1), ElementsAre("A"));
+	EXPECT_EQ(2, cache.Size());
+}
+
+TEST(LastValueCacheTests, LeastRecentlyUsedValuesShouldBeEvictedFirst)
+{
+	LastValueCache<std::string> probe{ 1024 * 1024 };
+	probe.Put(1, 0, "value", 100);
+	const auto entryCost = probe.Bytes();
+
+	LastValueCache<std::string> cache{ 3 * entryCost };
+	cache.Put(1, 0, "one", 100);
+	cache.Put(2, 0, "two", 100);
+	cache.Put(3, 0, "three", 100);
+	cache.Get(1); // delivering a value is a use too
+	cache.Put(4, 0, "four", 100);
+	EXPECT_THAT(cache.Get(2), IsEmpty());
+	EXPECT_THAT(cache.Get(1), ElementsAre("one"));
+	EXPECT_EQ(3, cache.Size());
+	EXPECT_EQ(3 * entryCost, cache.Bytes());
+}
+
+TEST(LastValueCacheTests, ValuesBiggerThanTheBudgetShouldNotBeKept)
+{
+	LastValueCache<std::string> cache{ 1000 };
+	cache.Put(1, 0, "small", 10);
+	cache.Put(1, 0, "huge", 5000);
+	EXPECT_THAT(cache.Get(1), IsEmpty());
+	EXPECT_EQ(0, cache.Size());
+	EXPECT_EQ(0, cache.Bytes());
+}
+
+TEST(BrokerStatsTests, HistogramBucketsShouldKeepTheRelativeErrorSmall)
+{
+	for (const auto value : std::initializer_list<uint64_t>{ 0, 15, 16, 1000, 123456789, uint64_t{ 1 } << 40, UINT64_MAX })
+	{
+		const auto bucket = HistogramCounters::BucketOf(value);
+		ASSERT_LT(bucket, HistogramCounters::Buckets);
+		EXPECT_GE(HistogramCounters::UpperBoundOf(bucket), value);
+		EXPECT_LE(HistogramCounters::UpperBoundOf(bucket) - value, value / 16);
+		if (bucket)
+		{
+			EXPECT_LT(HistogramCounters::UpperBoundOf(bucket - 1), value);
+		}
+	}
+}
+
+TEST(BrokerStatsTests, PercentilesShouldComeFromTheSumOfTheHistograms)
+{
+	HistogramCounters fast, slow;
+	for (auto i = 0; i < 90; ++i)
+	{
+		fast.Record(std::chrono::microseconds(10));
+	}
+	for (auto i = 0; i < 10; ++i)
+	{
+		slow.Record(std::chrono::milliseconds(2));
+	}
+	HistogramSnapshot snapshot;
+	snapshot.Add(fast);
+	snapshot.Add(slow);
+	EXPECT_EQ(100, snapshot.Count());
+	EXPECT_NEAR(10000, snapshot.ValueAt(0.5), 10000 / 16);
+	EXPECT_NEAR(10000, snapshot.ValueAt(0.9), 10000 / 16);
+	EXPECT_EQ(2000000, snapshot.ValueAt(0.99));
+	EXPECT_EQ(2000000, snapshot.Max());
+	EXPECT_EQ(0, HistogramSnapshot{}.ValueAt(0.99));
+}
+
+TEST(BrokerStatsTests, EveryThreadShouldCountOnItsOwnShard)
+{
+	PerThread<ThreadStats> stats;
+	std::vector<std::jthread> publishers;
+	for (auto i = 0; i < 4; ++i)
+	{
+		publishers.emplace_back([&] {
+			for (auto j = 0; j < 1000; ++j)
+			{
+				stats.Local().topics.Add(1, 10);
+				stats.Local().topics.Add(5000, 1); // another segment
+			}
+		});
+	}
+	publishers.clear();
+
+	size_t shards = 0;
+	uint64_t messages = 0, bytes = 0;
+	stats.ForEach([&](std::thread::id, const ThreadStats& thread) {
+		++shards;
+		thread.topics.ForEach([&](TopicId id, uint64_t topicMessages, uint64_t topicBytes) {
+			EXPECT_THAT(id, AnyOf(1, 5000));
+			messages += topicMessages;
+			bytes += topicBytes;
+		});
+	});
+	EXPECT_EQ(4, shards);
+	EXPECT_EQ(8000, messages);
+	EXPECT_EQ(44000, bytes);
+}
+
+TEST(EncodedMessageTests, SequenceShouldBeAppendedToTheSharedFrame)
+{
+	::Message message; // not testing::Message
+	message.set_content("hello");
+	const auto frame = EncodeReceiveResponse(message, "Channel1", 1);
+
+	ReceiveResponse response;
+	auto numbered = WithSequence(frame, 300);
+	ASSERT_TRUE(grpc::SerializationTraits<ReceiveResponse>::Deserialize(&numbered, &response).ok());
+	EXPECT_EQ(300, response.sequence());
+	EXPECT_EQ("hello", response.message().content());
+	EXPECT_EQ("Channel1", response.message().topic());
+}
+
+TEST(EncodedMessageTests, MessageShouldBeCompletedInPlaceAndNotOwnedByTheFrame)
+{
+	::Message message; // not testing::Message
+	message.set_topic_id(1);
+	message.set_offset(42); // publishers do not set offsets
+	message.set_content("hello");
+	auto frame = EncodeReceiveResponse(message, "Channel1", 1);
+	EXPECT_EQ("Channel1", message.topic());
+	EXPECT_FALSE(message.has_offset());
+	EXPECT_EQ("hello", message.content());
+
+	ReceiveResponse response;
+	ASSERT_TRUE(grpc::SerializationTraits<ReceiveResponse>::Deserialize(&frame, &response).ok());
+	EXPECT_EQ("Channel1", response.message().topic());
+	EXPECT_EQ(1, response.message().topic_id());
+	EXPECT_FALSE(response.message().has_offset());
+	EXPECT_EQ("hello", response.message().content());
+}
+
+// the same bytes split into slices of "sliceSize" (a frame is not necessarily a single slice)
+static grpc::ByteBuffer SplitFrame(const grpc::ByteBuffer& frame, size_t sliceSize)
+{
+	const auto content = ContentOf(frame);
+	std::vector<grpc::Slice> slices;
+	for (size_t start = 0; start < content.size(); start += sliceSize)
+	{
+		// small slices are usually inlined, and gRPC merges adjacent inlined slices: these ones are never inlined
+		const auto size = std::min<size_t>(sliceSize, content.size() - start);
+		grpc::Slice slice{ grpc_slice_malloc_large(size), grpc::Slice::STEAL_REF };
+		std::memcpy(const_cast<uint8_t*>(slice.begin()), content.data() + start, size);
+		slices.push_back(std::move(slice));
+	}
+	grpc::ByteBuffer split{ slices.data(), slices.size() };
+	std::vector<grpc::Slice> dumped;
+	split.Dump(&dumped);
+	EXPECT_EQ(slices.size(), dumped.size());
+	return split;
+}
+
+TEST(EncodedMessageTests, BatchShouldBeAReceiveResponseWithEveryMessage)
+{
+	TopicDictionary dictionary{ 0 };
+	std::vector<::Message> messages(4); // not testing::Message
+	messages[0].set_content("hello");
+	messages[1].set_content("split");
+	messages[1].set_key("key");
+	messages[2].set_content(std::string(1000, 'a'));
+	messages[3].set_content("last");
+	std::vector<grpc::ByteBuffer> frames;
+	for (size_t i = 0; i < messages.size(); ++i)
+	{
+		frames.push_back(EncodeReceiveResponse(messages[i], "Channel1", 1, i));
+	}
+	// the tag alone in the first slice, then a few bytes per slice
+	frames[1] = SplitFrame(frames[1], 1);
+	frames[3] = SplitFrame(frames[3], 3);
+	frames[2] = DeflateFrame(frames[2], dictionary);
+
+	auto batch = EncodeBatch(frames);
+	ReceiveResponse response;
+	ASSERT_TRUE(grpc::SerializationTraits<ReceiveResponse>::Deserialize(&batch, &response).ok());
+	EXPECT_FALSE(response.has_message());
+	ASSERT_EQ(4, response.messages_size());
+	for (int i = 0; i < response.messages_size(); ++i)
+	{
+		const auto& message = response.messages(i);
+		EXPECT_EQ("Channel1", message.topic());
+		EXPECT_EQ(1, message.topic_id());
+		EXPECT_EQ(static_cast<uint64_t>(i), message.offset());
+	}
+	EXPECT_EQ("hello", response.messages(0).content());
+	EXPECT_EQ("split", response.messages(1).content());
+	EXPECT_EQ("key", response.messages(1).key());
+	EXPECT_TRUE(response.messages(2).content().empty());
+	EXPECT_EQ(std::string(1000, 'a'), Inflate(response.messages(2).deflated()));
+	EXPECT_EQ("last", response.messages(3).content());
+}
+
+TEST(RequestArenasTests, HoldersShouldBeReusedUpToTheIdleLimit)
+{
+	ArenaMessageAllocator<SendRequest, SendResponse> allocator{ 1 };
+	auto* first = allocator.AllocateMessages();
+	auto* second = allocator.AllocateMessages();
+	EXPECT_NE(nullptr, first->request()->GetArena());
+	EXPECT_EQ(first->request()->GetArena(), first->response()->GetArena());
+	EXPECT_NE(first->request()->GetArena(), second->request()->GetArena());
+	first->request()->add_messages()->set_content("hello");
+	first->Release();
+	second->Release();
+	EXPECT_EQ(1, allocator.Idle());
+
+	auto* again = allocator.AllocateMessages();
+	EXPECT_EQ(first, again);
+	EXPECT_EQ(0, again->request()->messages_size()); // a new request on the same arena
+	EXPECT_EQ(0, allocator.Idle());
+	again->Release();
+}
+
+TEST(CompressionTests, DictionaryShouldMakeSmallMessagesSmaller)
+{
+	const std::string content = R"({"symbol":"SAP","venue":"XETR","bid":142.50,"ask":142.55})";
+	TopicDictionary dictionary{ 1024 };
+	for (auto i = 0; dictionary.Get() == nullptr; ++i)
+	{
+		dictionary.Learn(content);
+		ASSERT_LT(i, TopicDictionary::MaxSamples);
+	}
+
+	const auto alone = Deflate(content);
+	const auto withDictionary = Deflate(content, *dictionary.Get());
+	ASSERT_TRUE(alone && withDictionary);
+	EXPECT_LT(withDictionary->size(), alone->size());
+	EXPECT_EQ(content, Inflate(*alone));
+	EXPECT_EQ(content, Inflate(*withDictionary, *dictionary.Get()));
+	EXPECT_THROW(Inflate("not deflated at all"), std::runtime_error);
+}
+
+TEST(CompressionTests, DictionaryShouldBeFrozenOnceFull)
+{
+	TopicDictionary dictionary{ 8 };
+	dictionary.Learn("hello");
+	EXPECT_EQ(nullptr, dictionary.Get());
+	dictionary.Learn("world");
+	ASSERT_NE(nullptr, dictionary.Get());
+	EXPECT_EQ("hellowor", *dictionary.Get());
+	const auto id = dictionary.Id();
+	EXPECT_NE(0, id);
+	dictionary.Learn("again");
+	EXPECT_EQ("hellowor", *dictionary.Get());
+	EXPECT_EQ(id, dictionary.Id());
+
+	TopicDictionary off{ 0 };
+	off.Learn("hello");
+	EXPECT_EQ(nullptr, off.Get());
+}
+
+TEST(CompressionTests, FramesShouldBeDeflatedOnlyIfSmaller)
+{
+	TopicDictionary dictionary{ 0 };
+	::Message message; // not testing::Message
+	message.set_content(std::string(1000, 'a'));
+	auto deflated = DeflateFrame(EncodeReceiveResponse(message, "Channel1", 1), dictionary);
+	ReceiveResponse response;
+	ASSERT_TRUE(grpc::SerializationTraits<ReceiveResponse>::Deserialize(&deflated, &response).ok());
+	EXPECT_TRUE(response.message().content().empty());
+	EXPECT_EQ(0, response.message().dictionary());
+	EXPECT_EQ(message.content(), Inflate(response.message().deflated()));
+	EXPECT_EQ("Channel1", response.message().topic());
+
+	message.set_content("hi");
+	const auto frame = EncodeReceiveResponse(message, "Channel1", 1);
+	EXPECT_EQ(ContentOf(frame), ContentOf(DeflateFrame(frame, dictionary)));
+}
+
+TEST(TopicInterestTests, ListenersShouldSeeOnlyTheFirstAndTheLastSubscriber)
+{
+	auto table = std::make_shared<InterestTable>();
+	table->Add("prices.#");
+	std::vector<std::pair<std::string, bool>> changes;
+	const auto listener = table->Listen([&](const std::string& topic, bool interested) {
+		changes.emplace_back(topic, interested);
+	});
+
+	table->Add("orders");
+	table->Add("orders");
+	table->Remove("orders");
+	EXPECT_EQ(2, table->Size());
+	table->Remove("orders");
+	table->Remove("unknown");
+	table->StopListening(listener);
+	table->Remove("prices.#");
+
+	EXPECT_THAT(changes, ElementsAre(Pair("prices.#", true), Pair("orders", true), Pair("orders", false)));
+	EXPECT_EQ(0, table->Size());
+}
+
+TEST(TopicInterestTests, SubscriberInterestsShouldCountOnceAndBeWithdrawnOnClear)
+{
+	auto table = std::make_shared<InterestTable>();
+	{
+		SubscriberInterests first{ table };
+		SubscriberInterests second{ table };
+		first.Add("orders");
+		first.Add("orders");
+		second.Add("orders");
+		second.Add("prices.*");
+		first.Remove("orders");
+		EXPECT_EQ(2, table->Size());
+		second.Clear();
+		EXPECT_EQ(0, table->Size());
+		first.Add("orders");
+	}
+	EXPECT_EQ(0, table->Size());
+
+	SubscriberInterests peer; // no table: it does not count
+	peer.Add("orders");
+	EXPECT_EQ(0, table->Size());
+}
+
+TEST(LightSubscriptionsTests, ReleasedSlotsShouldBeReusedWithANewGeneration)
+{
+	SubscriberSlots<std::string> slots{ 1 };
+	EXPECT_EQ(SubscriberSlots<std::string>::ChunkSize, slots.Capacity());
+	const auto first = *slots.Acquire("first");
+	const auto second = *slots.Acquire("second");
+	EXPECT_NE(first.index, second.index);
+
+	EXPECT_EQ("first", slots.Release(first));
+	EXPECT_EQ(std::nullopt, slots.Release(first));
+	const auto third = *slots.Acquire("third");
+	EXPECT_EQ(first.index, third.index);
+	EXPECT_NE(first.generation, third.generation);
+
+	std::string visited;
+	EXPECT_FALSE(slots.Visit(first, [&](const std::string& subscriber) { visited = subscriber; }));
+	EXPECT_TRUE(slots.Visit(third, [&](const std::string& subscriber) { visited = subscriber; }));
+	EXPECT_EQ("third", visited);
+	EXPECT_EQ(2, slots.Size());
+}
+
+TEST(LightSubscriptionsTests, SlotsShouldGrowByChunksWithoutMoving)
+{
+	SubscriberSlots<int> slots{ 1 };
+	const auto first = *slots.Acquire(0);
+	const int* address = nullptr;
+	slots.Visit(first, [&](const int& subscriber) { address = &subscriber; });
+	std::vector<SlotRef> refs;
+	for (int i = 1; i <= static_cast<int>(SubscriberSlots<int>::ChunkSize); ++i)
+	{
+		refs.push_back(*slots.Acquire(i));
+	}
+	EXPECT_EQ(2 * SubscriberSlots<int>::ChunkSize, slots.Capacity());
+	slots.Visit(first, [&](const int& subscriber) { EXPECT_EQ(address, &subscriber); });
+
+	int sum = 0;
+	slots.ForEach([&](SlotRef, int subscriber) { sum += subscriber; });
+	EXPECT_EQ(1024 * 1025 / 2, sum);
+}
+
+TEST(LightSubscriptionsTests, SubscribersShouldBeRefusedWhenAllTheSlotsAreTaken)
+{
+	SubscriberSlots<int> slots{ 1, 1 };
+	std::vector<SlotRef> refs;
+	for (int i = 0; i < static_cast<int>(SubscriberSlots<int>::ChunkSize); ++i)
+	{
+		refs.push_back(*slots.Acquire(i));
+	}
+	EXPECT_EQ(std::nullopt, slots.Acquire(-1));
+	EXPECT_EQ(SubscriberSlots<int>::ChunkSize, slots.Capacity());
+
+	// a released slot makes room for the next one
+	slots.Release(refs.front());
+	EXPECT_NE(std::nullopt, slots.Acquire(-1));
+	EXPECT_EQ(SubscriberSlots<int>::ChunkSize, slots.Size());
+}
+
+TEST(LightSubscriptionsTests, FanoutSnapshotsShouldNotChangeWhenSubscribersComeAndGo)
+{
+	LightFanout fanout;
+	EXPECT_EQ(nullptr, fanout.Get());
+	fanout.Add({ 1, 0 });
+	fanout.Add({ 2, 0 });
+	const auto snapshot = fanout.Get();
+	fanout.Remove({ 1, 0 });
+	fanout.Remove({ 1, 0 });
+	fanout.Add({ 3, 0 });
+
+	EXPECT_THAT(*snapshot, ElementsAre(SlotRef{ 1, 0 }, SlotRef{ 2, 0 }));
+	EXPECT_THAT(*fanout.Get(), ElementsAre(SlotRef{ 2, 0 }, SlotRef{ 3, 0 }));
+	fanout.Remove({ 2, 0 });
+	fanout.Remove({ 3, 0 });
+	EXPECT_EQ(nullptr, fanout.Get());
+}
+
+TEST(LightSubscriptionsTests, PublishersShouldReadWholeSnapshotsWhileSubscribersChurn)
+{
+	LightFanout fanout;
+	fanout.Add({ 0, 0 });
+	std::atomic<bool> done = false;
+	std::thread churn{ [&] {
+		for (uint32_t i = 1; i < 2000; ++i)
+		{
+			fanout.Add({ i, 0 });
+			fanout.Remove({ i, 0 });
+		}
+		done = true;
+	} };
+	while (!done)
+	{
+		// a snapshot is never updated in place: the first subscriber plus the one coming and going, if any
+		const auto snapshot = fanout.Get();
+		EXPECT_NE(nullptr, snapshot);
+		if (snapshot)
+		{
+			EXPECT_THAT(snapshot->size(), AllOf(Ge(1), Le(2)));
+			EXPECT_EQ((SlotRef{ 0, 0 }), snapshot->front());
+		}
+	}
+	churn.join();
+	EXPECT_THAT(*fanout.Get(), ElementsAre(SlotRef{ 0, 0 }));
+}
+
+TEST(MessageFilterTests, FiltersShouldMatchKeysContentsAndHeaders)
+{
+	::Message message;
+	message.set_key("EU.DAX");
+	message.set_content("42");
+	(*message.mutable_headers())["venue"] = "XETR";
+
+	EXPECT_TRUE(MessageFilter::Compile(R"(key ^= "EU." and headers.venue = 'XETR')")->Matches(message));
+	EXPECT_TRUE(MessageFilter::Compile(R"(not (content = "41" or headers.kind != ""))")->Matches(message));
+	EXPECT_FALSE(MessageFilter::Compile(R"(key = "EU" or headers.venue ^= "XE\\T")")->Matches(message));
+	EXPECT_THROW(MessageFilter::Compile(R"(key ^= "EU." and)"), std::invalid_argument);
+	EXPECT_THROW(MessageFilter::Compile(R"(price = "1")"), std::invalid_argument);
+	EXPECT_THROW(MessageFilter::Compile(R"(key = "unterminated)"), std::invalid_argument);
+}
+
+TEST(MessageFilterTests, DeeplyNestedFiltersShouldBeRefusedWhileParsing)
+{
+	std::string nots;
+	std::string parentheses;
+	for (size_t i = 0; i < 1000; ++i)
+	{
+		nots += "not ";
+		parentheses += "(";
+	}
+	EXPECT_THROW(MessageFilter::Compile(nots + R"(key = "a")"), std::invalid_argument);
+	EXPECT_THROW(MessageFilter::Compile(parentheses + R"(key = "a")"), std::invalid_argument);
+
+	std::string nested = R"(key = "a")";
+	for (size_t i = 0; i < MessageFilter::MaxDepth; ++i)
+	{
+		nested = "not (" + nested + ")";
+	}
+	EXPECT_THROW(MessageFilter::Compile(nested), std::invalid_argument);
+	EXPECT_NO_THROW(MessageFilter::Compile(R"(not not (not (key = "a")))"));
+}
+
+TEST(MessageFilterTests, LongFiltersShouldBeRefused)
+{
+	std::string comparisons = R"(key = "0")";
+	for (size_t i = 1; i < MessageFilter::MaxInstructions; ++i)
+	{
+		comparisons += " or key = \"" + std::to_string(i % 10) + "\"";
+	}
+	ASSERT_LE(comparisons.size(), MessageFilter::MaxLength);
+	EXPECT_THROW(MessageFilter::Compile(comparisons), std::invalid_argument);
+	EXPECT_THROW(MessageFilter::Compile(R"(key = ")" + std::string(MessageFilter::MaxLength, 'a') + "\""), std::invalid_argument);
+
+	auto flat = MessageFilter::Compile(R"(key = "a" or key = "b" or not (key = "c" and content = "d" and headers.x != "e"))");
+	EXPECT_EQ(R"((key = "a" or key = "b" or not (key = "c" and content = "d" and headers.x != "e")))", flat->Canonical());
+}
+
+TEST(MessageFilterTests, IdenticalFiltersShouldShareOneSlotAndOneEvaluation)
+{
+	TopicFilters filters;
+	auto first = MessageFilter::Compile(R"(key = "a")");
+	auto same = MessageFilter::Compile(R"(  key='a' )");
+	auto other = MessageFilter::Compile(R"(key != "a")");
+	EXPECT_EQ(filters.Acquire(first), 0);
+	EXPECT_EQ(filters.Acquire(same), 0);
+	EXPECT_EQ(same, first);
+	EXPECT_EQ(filters.Acquire(other), 1);
+	EXPECT_EQ(filters.Active(), 2);
+
+	::Message message;
+	message.set_key("a");
+	const auto results = filters.Evaluate(message);
+	EXPECT_THAT(results.Passed(0, *first), Optional(true));
+	EXPECT_THAT(results.Passed(1, *other), Optional(false));
+}
+
+TEST(MessageFilterTests, ResultsShouldNotApplyToFiltersTakingAReleasedSlot)
+{
+	TopicFilters filters;
+	::Message message;
+	EXPECT_FALSE(filters.Evaluate(message).snapshot); // no filters, nothing evaluated
+
+	auto first = MessageFilter::Compile(R"(key = "")");
+	const auto slot = filters.Acquire(first);
+	const auto results = filters.Evaluate(message);
+	filters.Release(slot);
+	EXPECT_EQ(filters.Active(), 0);
+
+	auto next = MessageFilter::Compile(R"(key = "b")");
+	EXPECT_EQ(filters.Acquire(next), slot);
+	EXPECT_THAT(results.Passed(slot, *first), Optional(true));
+	EXPECT_EQ(results.Passed(slot, *next), std::nullopt);
+}
+
+TEST(TopicPartitionsTests, PartitionNamesShouldBeSplitBack)
+{
+	EXPECT_EQ(PartitionName("orders", 2), "orders[2]");
+	EXPECT_THAT(SplitPartitionName("orders[12]"), Optional(Pair("orders", 12)));
+	EXPECT_THAT(SplitPartitionName("a[b][3]"), Optional(Pair("a[b]", 3)));
+	EXPECT_EQ(SplitPartitionName("orders"), std::nullopt);
+	EXPECT_EQ(SplitPartitionName("orders[]"), std::nullopt);
+	EXPECT_EQ(SplitPartitionName("orders[x1]"), std::nullopt);
+	EXPECT_EQ(SplitPartitionName("[1]"), std::nullopt);
+}
+
+TEST(TopicPartitionsTests, KeysShouldStickToAPartitionAndTheOthersTakeTurns)
+{
+	TopicPartitions partitions{ 4 };
+	std::set<size_t> used;
+	for (auto i = 0; i < 100; ++i)
+	{
+		const auto key = KeyHashOf("key-" + std::to_string(i));
+		const auto partition = partitions.PartitionOf(key);
+		EXPECT_EQ(partitions.PartitionOf(key), partition);
+		used.insert(partition);
+	}
+	EXPECT_THAT(used, ElementsAre(0, 1, 2, 3));
+	EXPECT_THAT((std::vector{ partitions.PartitionOf(0), partitions.PartitionOf(0), partitions.PartitionOf(0), partitions.PartitionOf(0) }), UnorderedElementsAre(0, 1, 2, 3));
+
+	auto interned = 0;
+	const auto intern = [&](size_t partition) {
+		++interned;
+		return TopicId{ 10 + partition };
+	};
+	EXPECT_EQ(partitions.Get(3, intern), 13);
+	EXPECT_EQ(partitions.Get(0, intern), 10);
+	EXPECT_EQ(interned, 4);
+}
+
+TEST(MessageBatcherTests, BatchesShouldBeSealedByCountOrBytes)
+{
+	const auto now = MessageBatcher::Clock::now();
+	::Message message;
+	message.set_topic("t");
+	message.set_content(std::string(100, 'x'));
+
+	MessageBatcher byCount{ 3, 0, std::chrono::milliseconds(1) };
+	EXPECT_EQ(byCount.Add(message, now), std::nullopt);
+	EXPECT_EQ(byCount.Add(message, now), std::nullopt);
+	const auto batch = byCount.Add(message, now);
+	ASSERT_TRUE(batch);
+	EXPECT_EQ(batch->messages().size(), 3);
+	EXPECT_EQ(byCount.Deadline(), std::nullopt);
+
+	MessageBatcher byBytes{ 100, 250, std::chrono::milliseconds(1) };
+	EXPECT_EQ(byBytes.Add(message, now), std::nullopt);
+	EXPECT_EQ(byBytes.Add(message, now), std::nullopt);
+	EXPECT_THAT(byBytes.Add(message, now), Optional(Property(&SendRequest::messages_size, 3)));
+}
+
+TEST(MessageBatcherTests, DeadlineShouldComeFromTheFirstMessageOfTheBatch)
+{
+	const auto now = MessageBatcher::Clock::now();
+	MessageBatcher batcher{ 100, 0, std::chrono::milliseconds(5) };
+	EXPECT_EQ(batcher.Seal(), std::nullopt);
+	batcher.Add(::Message{}, now);
+	batcher.Add(::Message{}, now + std::chrono::milliseconds(3));
+	EXPECT_THAT(batcher.Deadline(), Optional(now + std::chrono::milliseconds(5)));
+	EXPECT_THAT(batcher.Seal(), Optional(Property(&SendRequest::messages_size, 2)));
+	EXPECT_EQ(batcher.Deadline(), std::nullopt);
+}
+
+// a slow "Send", recording the contents in the order the broker gets them
+class RecordingSendService final : public MessageBroker::Service
+{
+public:
+	grpc::Status Send([[maybe_unused]] grpc::ServerContext* context, const SendRequest* request, [[maybe_unused]] SendResponse* response) override
+	{
+		std::this_thread::sleep_for(std::chrono::microseconds(200));
+		std::lock_guard lock{ m_mutex };
+		for (const auto& message : request->messages())
+		{
+			m_contents.push_back(std::stoi(message.content()));
+		}
+		return grpc::Status::OK;
+	}
+
+	std::vector<int> Contents()
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_contents;
+	}
+private:
+	std::mutex m_mutex;
+	std::vector<int> m_contents;
+};
+
+TEST(BrokerProducerTests, OneBatchInFlightShouldKeepTheMessagesInOrder)
+{
+	RecordingSendService service;
+	grpc::ServerBuilder builder;
+	builder.RegisterService(&service);
+	const auto server = builder.BuildAndStart();
+	{
+		// the lingerer seals batches as well as the sending thread, both wait for the batch in flight
+		BrokerProducer producer{ server->InProcessChannel(grpc::ChannelArguments{}), ProducerSettings{ .maxBatch = 3, .linger = std::chrono::microseconds(100), .maxInFlight = 1 } };
+		for (auto i = 0; i < 1000; ++i)
+		{
+			producer.Send("orders", std::to_string(i));
+			if (i % 7 == 0)
+			{
+				std::this_thread::sleep_for(std::chrono::microseconds(150));
+			}
+		}
+	}
+	const auto contents = service.Contents();
+	EXPECT_EQ(1000, contents.size());
+	EXPECT_TRUE(std::ranges::is_sorted(contents));
+	server->Shutdown();
+}
+
+/* The broker core in process (see EmbeddedBroker), also served by gRPC on an in-process channel */
+class EmbeddedBrokerTests : public Test
+{
+protected:
+	EmbeddedBrokerTests()
+	{
+		grpc::ServerBuilder builder;
+		builder.RegisterService(&m_broker.Service());
+		m_server = builder.BuildAndStart();
+		m_stub = MessageBroker::NewStub(m_server->InProcessChannel(grpc::ChannelArguments{}));
+	}
+
+	~EmbeddedBrokerTests() override
+	{
+		// as message-broker does: agents first, then the server
+		m_broker.Stop();
+		m_server->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(5));
+	}
+
+	// true once "Stats" tells the topic has "count" gRPC subscribers, false if this does not happen in a few seconds
+	bool WaitForSubscribers(const std::string& topic, size_t count)
+	{
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while (std::chrono::steady_clock::now() < deadline)
+		{
+			grpc::ClientContext context;
+			StatsResponse stats;
+			if (m_stub->Stats(&context, StatsRequest{}, &stats).ok() && std::ranges::any_of(stats.topics(), [&](const TopicStats& topicStats) {
+				return topicStats.topic() == topic && topicStats.subscribers() == count;
+			}))
+			{
+				return true;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+		return false;
+	}
+
+	static ::Message MessageTo(const std::string& topic, const std::string& content)
+	{
+		::Message message; // not testing::Message
+		message.set_topic(topic);
+		message.set_content(content);
+		return message;
+	}
+
+	// the contents an in-process subscriber gets
+	class Received
+	{
+	public:
+		LocalHandler Handler()
+		{
+			return [this](const ::Message& message) {
+				std::lock_guard lock{ m_mutex };
+				m_contents.push_back(message.content());
+				m_arrived.notify_all();
+			};
+		}
+
+		// what has been received once "count" contents have arrived (or after a few seconds)
+		std::vector<std::string> WaitFor(size_t count)
+		{
+			std::unique_lock lock{ m_mutex };
+			m_arrived.wait_for(lock, std::chrono::seconds(5), [&] { return m_contents.size() >= count; });
+			return m_contents;
+		}
+	private:
+		std::mutex m_mutex;
+		std::condition_variable m_arrived;
+		std::vector<std::string> m_contents;
+	};
+
+	EmbeddedBroker m_broker{ BrokerOptions{} };
+	std::unique_ptr<grpc::Server> m_server;
+	std::unique_ptr<MessageBroker::Stub> m_stub;
+};
+
+TEST_F(EmbeddedBrokerTests, InProcessPublishShouldReachInProcessAndGrpcSubscribers)
+{
+	grpc::ClientContext context;
+	context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(10));
+	ReceiveRequest request;
+	request.add_topics("orders");
+	const auto reader = m_stub->Receive(&context, request);
+	ASSERT_TRUE(WaitForSubscribers("orders", 1));
+	Received local;
+	const auto subscription = m_broker.Subscribe({ "orders" }, local.Handler());
+
+	ASSERT_TRUE(m_broker.Publish(MessageTo("orders", "hello")).ok());
+	EXPECT_THAT(local.WaitFor(1), ElementsAre("hello"));
+	ReceiveResponse response;
+	ASSERT_TRUE(reader->Read(&response));
+	EXPECT_EQ("hello", response.message().content());
+	EXPECT_EQ("orders", response.message().topic());
+	context.TryCancel();
+}
+
+TEST_F(EmbeddedBrokerTests, InProcessSubscribersShouldGetNothingOnceUnsubscribed)
+{
+	Received first;
+	Received second;
+	auto subscription = std::make_optional(m_broker.Subscribe({ "orders" }, first.Handler()));
+	const auto other = m_broker.Subscribe({ "orders" }, second.Handler());
+	ASSERT_TRUE(m_broker.Publish(MessageTo("orders", "1")).ok());
+	EXPECT_THAT(first.WaitFor(1), ElementsAre("1"));
+
+	subscription.reset();
+	ASSERT_TRUE(m_broker.Publish(MessageTo("orders", "2")).ok());
+	EXPECT_THAT(second.WaitFor(2), ElementsAre("1", "2"));
+	EXPECT_THAT(first.WaitFor(1), ElementsAre("1"));
+	EXPECT_THROW(m_broker.Subscribe({ "orders.*" }, first.Handler()), std::invalid_argument);
+}
+
+TEST_F(EmbeddedBrokerTests, SubscribeShouldChangeTopicsOnTheSameStream)
+{
+	grpc::ClientContext context;
+	context.set_deadline(std::chrono::system_clock::now() + std::chrono::seconds(10));
+	const auto stream = m_stub->Subscribe(&context);
+	SubscribeRequest command;
+	command.add_subscribe("prices.SAP");
+	ASSERT_TRUE(stream->Write(command));
+	ASSERT_TRUE(WaitForSubscribers("prices.SAP", 1));
+	ASSERT_TRUE(m_broker.Publish(MessageTo("prices.SAP", "1")).ok());
+	ReceiveResponse response;
+	ASSERT_TRUE(stream->Read(&response));
+	EXPECT_EQ("1", response.message().content());
+
+	// the agent stays, only its topics change
+	command.Clear();
+	command.add_unsubscribe("prices.SAP");
+	command.add_subscribe("prices.DTE");
+	ASSERT_TRUE(stream->Write(command));
+	ASSERT_TRUE(WaitForSubscribers("prices.SAP", 0));
+	ASSERT_TRUE(WaitForSubscribers("prices.DTE", 1));
+	ASSERT_TRUE(m_broker.Publish(MessageTo("prices.SAP", "2")).ok());
+	ASSERT_TRUE(m_broker.Publish(MessageTo("prices.DTE", "3")).ok());
+	ASSERT_TRUE(stream->Read(&response));
+	EXPECT_EQ("3", response.message().content());
+	EXPECT_EQ("prices.DTE", response.message().topic());
+	context.TryCancel();
+}
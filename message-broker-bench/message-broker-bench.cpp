@@ -0,0 +1,1253 @@
+#define _WINSOCKAPI_
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <so_5/all.hpp>
+#include <Windows.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/server_builder.h>
+#include "../generated/broker.grpc.pb.h"
+#include "../broker-client/broker-client.h"
+#include "../message-broker/broker-options.h"
+#include "../message-broker/broker-stats.h"
+#include "../message-broker/embedded-broker.h"
+#include "../message-broker/encoded-message.h"
+#include "../message-broker/subscriber-stream.h"
+#include "../message-broker/topic-log.h"
+
+/* A few micro-benchmarks of the MessageBroker hot paths.
+   Usage: message-broker-bench <scenario> [arguments...]
+   Every scenario prints its own results to stdout.
+*/
+
+using Clock = std::chrono::steady_clock;
+using Arguments = std::vector<std::string>;
+
+static size_t ArgumentOr(const Arguments& args, size_t index, size_t defaultValue)
+{
+	return index < args.size() ? std::stoull(args[index]) : defaultValue;
+}
+
+template<typename Action>
+static double MeasureSeconds(Action action)
+{
+	const auto start = Clock::now();
+	action();
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// user + kernel time of this process
+static double ProcessCpuSeconds()
+{
+	FILETIME creation, exit, kernel, user;
+	GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+	const auto toSeconds = [](const FILETIME& time) {
+		return static_cast<double>(ULARGE_INTEGER{ time.dwLowDateTime, time.dwHighDateTime }.QuadPart) / 1e7; // 100ns ticks
+	};
+	return toSeconds(kernel) + toSeconds(user);
+}
+
+/* fanout [subscribers] [messages] [payload]
+   Compares the two ways of delivering a published message to many subscribers:
+   - "per-subscriber encoding": every subscriber builds and serializes its own ReceiveResponse (what ServerWriter::Write does with a proto);
+   - "serialize-once": the message is encoded once into a grpc::ByteBuffer shared by all the subscribers.
+   "bytes copied" is measured on one message delivered to every subscriber, apart from the timing: the bytes copied into the fields of responses
+   plus the bytes of frames in memory of their own (frames sharing the slices of another frame copy nothing), amortized per delivered message.
+*/
+static size_t BytesOfOwnSlices(const grpc::ByteBuffer& frame, const std::vector<grpc::Slice>& shared)
+{
+	std::vector<grpc::Slice> slices;
+	frame.Dump(&slices);
+	size_t bytes = 0;
+	for (const auto& slice : slices)
+	{
+		if (std::ranges::none_of(shared, [&](const grpc::Slice& other) { return slice.begin() >= other.begin() && slice.end() <= other.end(); }))
+		{
+			bytes += slice.size();
+		}
+	}
+	return bytes;
+}
+
+static void FanOut(const Arguments& args)
+{
+	const auto subscribers = ArgumentOr(args, 0, 2000);
+	const auto messages = ArgumentOr(args, 1, 1000);
+	const auto payload = ArgumentOr(args, 2, 64);
+
+	Message message;
+	message.set_topic("Channel1");
+	message.set_content(std::string(payload, 'x'));
+	const auto encodedSize = EncodeReceiveResponse(message, message.topic(), 1).Length();
+	const auto deliveries = static_cast<double>(subscribers * messages);
+
+	size_t perSubscriberCopied = 0;
+	for (auto s = 0u; s < subscribers; ++s)
+	{
+		ReceiveResponse response;
+		response.mutable_message()->set_topic(message.topic());
+		response.mutable_message()->set_content(message.content());
+		const auto copied = [](const std::string& field, const std::string& source) { return field.data() == source.data() ? 0 : field.size(); };
+		perSubscriberCopied += copied(response.message().topic(), message.topic()) + copied(response.message().content(), message.content());
+		grpc::ByteBuffer frame;
+		bool ownBuffer = false;
+		grpc::SerializationTraits<ReceiveResponse>::Serialize(response, &frame, &ownBuffer);
+		perSubscriberCopied += BytesOfOwnSlices(frame, {});
+	}
+	size_t serializeOnceCopied = 0;
+	{
+		// the content is copied once, into the frame (EncodeReceiveResponse completes the message in place)
+		const auto frame = EncodeReceiveResponse(message, message.topic(), 1);
+		std::vector<grpc::Slice> frameSlices;
+		frame.Dump(&frameSlices);
+		serializeOnceCopied += BytesOfOwnSlices(frame, {});
+		for (auto s = 0u; s < subscribers; ++s)
+		{
+			const grpc::ByteBuffer shared = frame; // this is what writing the frame to a stream does
+			serializeOnceCopied += BytesOfOwnSlices(shared, frameSlices);
+		}
+	}
+
+	size_t sink = 0; // just to prevent the optimizer from dropping the work
+	const auto perSubscriberSeconds = MeasureSeconds([&] {
+		for (auto i = 0u; i < messages; ++i)
+		{
+			for (auto s = 0u; s < subscribers; ++s)
+			{
+				ReceiveResponse response;
+				response.mutable_message()->set_topic(message.topic());
+				response.mutable_message()->set_content(message.content());
+				grpc::ByteBuffer frame;
+				bool ownBuffer = false;
+				grpc::SerializationTraits<ReceiveResponse>::Serialize(response, &frame, &ownBuffer);
+				sink += frame.Length();
+			}
+		}
+	});
+
+	const auto serializeOnceSeconds = MeasureSeconds([&] {
+		for (auto i = 0u; i < messages; ++i)
+		{
+			const auto frame = EncodeReceiveResponse(message, message.topic(), 1);
+			for (auto s = 0u; s < subscribers; ++s)
+			{
+				const grpc::ByteBuffer shared = frame; // this is what writing the frame to a stream does
+				sink += shared.Length();
+			}
+		}
+	});
+
+	std::cout << "fanout: subscribers=" << subscribers << " messages=" << messages << " payload=" << payload << " frame=" << encodedSize << " bytes (sink=" << sink << ")\n";
+	std::cout << "  per-subscriber encoding: " << deliveries / perSubscriberSeconds << " deliveries/s, "
+		<< static_cast<double>(perSubscriberCopied) / static_cast<double>(subscribers) << " bytes copied per delivery (measured)\n";
+	std::cout << "  serialize-once:          " << deliveries / serializeOnceSeconds << " deliveries/s, "
+		<< static_cast<double>(serializeOnceCopied) / static_cast<double>(subscribers) << " bytes copied per delivery (measured)\n";
+}
+
+// a subscriber of the "dispatch" scenario: it reads every frame, as writing it to a stream would do
+class CountingSubscriber final : public so_5::agent_t
+{
+public:
+	CountingSubscriber(context_t c, so_5::mbox_t topic, size_t expected, std::atomic<size_t>& done)
+		: agent_t(std::move(c)), m_topic(std::move(topic)), m_expected(expected), m_done(done)
+	{
+	}
+private:
+	void so_define_agent() override
+	{
+		so_subscribe(m_topic).event([this](so_5::mhood_t<EncodedMessage> data) {
+			m_bytes += data->frame.Length();
+			// counted here and not in a shared counter, which would be cross-core traffic of its own
+			if (++m_received == m_expected)
+			{
+				m_done.fetch_add(1, std::memory_order_release);
+			}
+		});
+	}
+
+	so_5::mbox_t m_topic;
+	size_t m_expected;
+	std::atomic<size_t>& m_done;
+	size_t m_received = 0;
+	size_t m_bytes = 0;
+};
+
+// the same as the broker's ShardRelay: it hands the messages of its shard to the local mbox of their topic
+class BenchShardRelay final : public so_5::agent_t
+{
+public:
+	BenchShardRelay(context_t c, std::vector<so_5::mbox_t> topics, std::optional<size_t> core)
+		: agent_t(std::move(c)), m_topics(std::move(topics)), m_core(core)
+	{
+	}
+private:
+	void so_define_agent() override
+	{
+		so_subscribe_self().event([this](so_5::mhood_t<EncodedMessage> data) {
+			so_5::send(m_topics[data->topicId], data.make_holder());
+		});
+	}
+
+	void so_evt_start() override
+	{
+		if (m_core)
+		{
+			SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR{ 1 } << (*m_core % (sizeof(DWORD_PTR) * 8)));
+		}
+	}
+
+	std::vector<so_5::mbox_t> m_topics;
+	std::optional<size_t> m_core;
+};
+
+/* dispatch [subscribers] [topics] [messages] [threads] [pin: 0|1]
+   Compares the dispatch modes of the broker (see DispatchMode), every subscriber gets the messages of one topic:
+   - "pool": subscribers float across the threads of a pool, a message is queued once per subscriber of its topic;
+   - "sharded": every subscriber stays on a shard (a thread, optionally pinned to a core), a message is queued once per shard
+     with subscribers of its topic and then the relay of the shard hands it to the local subscribers.
+   "cross-thread handoffs" counts how many times a message is queued by the publisher to the dispatcher threads,
+   a proxy for the cross-core cache traffic (hardware counters are not portable, use a profiler for those).
+*/
+static void Dispatch(const Arguments& args)
+{
+	const auto subscribers = ArgumentOr(args, 0, 1000);
+	const auto topics = std::max<size_t>(ArgumentOr(args, 1, 10), 1);
+	const auto messages = ArgumentOr(args, 2, 100000);
+	const auto cores = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	const auto threads = std::max<size_t>(ArgumentOr(args, 3, cores), 1);
+	const auto pin = ArgumentOr(args, 4, 0) != 0;
+
+	Message message;
+	message.set_content(std::string(64, 'x'));
+	const auto frame = EncodeReceiveResponse(message, "bench", 1);
+	const auto messagesOn = [&](size_t topic) {
+		return messages / topics + (topic < messages % topics ? 1 : 0);
+	};
+
+	const auto measure = [&](bool sharded) {
+		so_5::wrapped_env_t sobj;
+		auto& env = sobj.environment();
+		std::atomic<size_t> done = 0;
+		size_t waiting = 0; // subscribers expecting at least one message
+		std::vector<std::vector<so_5::mbox_t>> targets(topics); // where the publisher sends the messages of every topic
+		if (sharded)
+		{
+			// every shard has its own mbox per topic
+			std::vector<std::vector<so_5::mbox_t>> local(threads);
+			std::vector<so_5::disp_binder_shptr_t> shards;
+			for (size_t shard = 0; shard < threads; ++shard)
+			{
+				shards.push_back(so_5::disp::one_thread::make_dispatcher(env).binder());
+				for (size_t topic = 0; topic < topics; ++topic)
+				{
+					local[shard].push_back(env.create_mbox());
+				}
+			}
+			std::vector<std::vector<bool>> hasSubscribers(topics, std::vector<bool>(threads));
+			env.introduce_coop([&](so_5::coop_t& coop) {
+				for (size_t i = 0; i < subscribers; ++i)
+				{
+					const auto shard = i % threads, topic = i % topics;
+					coop.make_agent_with_binder<CountingSubscriber>(shards[shard], local[shard][topic], messagesOn(topic), done);
+					hasSubscribers[topic][shard] = true;
+					waiting += messagesOn(topic) ? 1 : 0;
+				}
+			});
+			env.introduce_coop([&](so_5::coop_t& coop) {
+				for (size_t shard = 0; shard < threads; ++shard)
+				{
+					const auto relay = coop.make_agent_with_binder<BenchShardRelay>(shards[shard], local[shard], pin ? std::optional<size_t>{ shard % cores } : std::nullopt)->so_direct_mbox();
+					for (size_t topic = 0; topic < topics; ++topic)
+					{
+						if (hasSubscribers[topic][shard])
+						{
+							targets[topic].push_back(relay);
+						}
+					}
+				}
+			});
+		}
+		else
+		{
+			for (size_t topic = 0; topic < topics; ++topic)
+			{
+				targets[topic].push_back(env.create_mbox());
+			}
+			env.introduce_coop(so_5::disp::thread_pool::make_dispatcher(env, threads).binder(), [&](so_5::coop_t& coop) {
+				for (size_t i = 0; i < subscribers; ++i)
+				{
+					coop.make_agent<CountingSubscriber>(targets[i % topics][0], messagesOn(i % topics), done);
+					waiting += messagesOn(i % topics) ? 1 : 0;
+				}
+			});
+		}
+
+		const auto cpuStart = ProcessCpuSeconds();
+		const auto seconds = MeasureSeconds([&] {
+			for (size_t i = 0; i < messages; ++i)
+			{
+				const auto published = so_5::message_holder_t<EncodedMessage>::make(frame, i % topics);
+				for (const auto& target : targets[i % topics])
+				{
+					so_5::send(target, published);
+				}
+			}
+			while (done.load(std::memory_order_acquire) < waiting)
+			{
+				std::this_thread::yield();
+			}
+		});
+		const auto cpu = ProcessCpuSeconds() - cpuStart;
+		sobj.stop_then_join();
+
+		size_t handoffs = 0;
+		for (size_t topic = 0; topic < topics; ++topic)
+		{
+			// to a topic mbox, every subscriber gets its own demand
+			handoffs += messagesOn(topic) * (sharded ? targets[topic].size() : (subscribers / topics + (topic < subscribers % topics ? 1 : 0)));
+		}
+		std::cout << "  " << (sharded ? "sharded:" : "pool:   ") << " " << static_cast<double>(messages) / seconds << " messages/s, "
+			<< cpu << " CPU seconds, " << static_cast<double>(handoffs) / static_cast<double>(messages) << " cross-thread handoffs per message\n";
+	};
+
+	std::cout << "dispatch: subscribers=" << subscribers << " topics=" << topics << " messages=" << messages << " threads=" << threads << " pinned=" << pin << "\n";
+	measure(false);
+	measure(true);
+}
+
+/* idle-subscribers [subscribers] [seconds] [address]
+   Measures the CPU burnt by idle "Receive" subscribers of a broker served on [address], with both receive modes (see ReceiveMode):
+   - "sync": every subscriber parks a gRPC thread, which checks for disconnections every SyncSubscriberStream::DisconnectionCheckInterval;
+   - "callback": idle subscribers hold no threads, disconnections are notified by gRPC.
+   The subscribers are opened with the async client API (no client threads) to a topic nobody sends to, then the process CPU time is measured for [seconds].
+*/
+static void IdleSubscribers(const Arguments& args)
+{
+	const auto subscribers = ArgumentOr(args, 0, 1000);
+	const auto seconds = std::chrono::seconds(ArgumentOr(args, 1, 30));
+	const auto address = args.size() > 2 ? args[2] : "localhost:50052";
+
+	const auto measure = [&](ReceiveMode mode) -> std::optional<double> {
+		BrokerOptions options;
+		options.receiveMode = mode;
+		EmbeddedBroker broker{ options };
+		grpc::ServerBuilder builder;
+		builder.AddListeningPort(address, grpc::InsecureServerCredentials());
+		builder.RegisterService(&broker.Service());
+		const auto server = builder.BuildAndStart();
+		if (!server)
+		{
+			return std::nullopt;
+		}
+
+		struct IdleClient
+		{
+			grpc::ClientContext context;
+			std::unique_ptr<grpc::ClientAsyncReader<ReceiveResponse>> reader;
+			grpc::Status status;
+		};
+		const auto stub = MessageBroker::NewStub(grpc::CreateChannel(address, grpc::InsecureChannelCredentials()));
+		grpc::CompletionQueue queue;
+		ReceiveRequest request;
+		request.add_topics("bench.idle");
+		std::vector<std::unique_ptr<IdleClient>> clients;
+		for (size_t i = 0; i < subscribers; ++i)
+		{
+			auto& client = *clients.emplace_back(std::make_unique<IdleClient>());
+			client.reader = stub->AsyncReceive(&client.context, request, &queue, &client);
+		}
+		// measuring starts once the broker sees every subscriber (see Stats)
+		const auto deadline = Clock::now() + std::chrono::seconds(30);
+		auto subscribed = false;
+		while (!subscribed && Clock::now() < deadline)
+		{
+			grpc::ClientContext context;
+			StatsResponse stats;
+			subscribed = stub->Stats(&context, StatsRequest{}, &stats).ok() && std::ranges::any_of(stats.topics(), [&](const TopicStats& topic) {
+				return topic.topic() == "bench.idle" && topic.subscribers() >= subscribers;
+			});
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		std::optional<double> cpu;
+		if (subscribed)
+		{
+			const auto start = ProcessCpuSeconds();
+			std::this_thread::sleep_for(seconds);
+			cpu = ProcessCpuSeconds() - start;
+		}
+
+		// as message-broker does: agents first, then the server (the subscribers get their streams closed)
+		broker.Stop();
+		server->Shutdown();
+		server->Wait();
+		for (auto& client : clients)
+		{
+			client->reader->Finish(&client->status, client.get());
+		}
+		queue.Shutdown();
+		void* tag = nullptr;
+		auto ok = false;
+		while (queue.Next(&tag, &ok))
+		{
+		}
+		if (!subscribed)
+		{
+			throw std::runtime_error("the subscribers did not subscribe in time");
+		}
+		return cpu;
+	};
+
+	std::cout << "idle-subscribers: subscribers=" << subscribers << " seconds=" << seconds.count() << " sync check interval=" << SyncSubscriberStream::DisconnectionCheckInterval.count() << "s\n";
+	for (const auto mode : { ReceiveMode::sync, ReceiveMode::callback })
+	{
+		const auto* name = mode == ReceiveMode::sync ? "sync:    " : "callback:";
+		if (const auto cpu = measure(mode))
+		{
+			std::cout << "  " << name << " " << *cpu << " CPU seconds\n";
+		}
+		else
+		{
+			std::cout << "  " << name << " can't serve on " << address << "\n";
+		}
+	}
+}
+
+/* topic-log [messages] [payload] [batch] [fsync: none|interval|batch]
+   Measures the throughput of the topic log (in a temporary directory):
+   - "append": messages are encoded and logged in batches of [batch], as Send does;
+   - "replay": the whole log is read back in chunks, as a subscriber with a start offset does.
+*/
+static void TopicLogThroughput(const Arguments& args)
+{
+	const auto messages = ArgumentOr(args, 0, 1000000);
+	const auto payload = ArgumentOr(args, 1, 64);
+	const auto batch = std::max<size_t>(ArgumentOr(args, 2, 100), 1);
+	TopicLogSettings settings;
+	settings.fsync = args.size() > 3 ? ParseFsyncPolicy(args[3]) : FsyncPolicy::none;
+	settings.retainedSegments = (std::numeric_limits<size_t>::max)(); // parenthesized because of the max macro in Windows.h
+
+	const auto directory = std::filesystem::temp_directory_path() / "message-broker-bench-log";
+	std::filesystem::remove_all(directory);
+	double appendSeconds = 0, replaySeconds = 0;
+	size_t bytes = 0;
+	{
+		TopicLog log{ directory, settings };
+		Message message;
+		message.set_content(std::string(payload, 'x'));
+		std::vector<grpc::ByteBuffer> frames;
+		appendSeconds = MeasureSeconds([&] {
+			for (size_t sent = 0; sent < messages; sent += batch)
+			{
+				frames.clear();
+				log.Append(std::min<size_t>(batch, messages - sent), [&](size_t, uint64_t offset) {
+					return EncodeReceiveResponse(message, "Channel1", 1, offset);
+				}, frames);
+			}
+		});
+
+		replaySeconds = MeasureSeconds([&] {
+			uint64_t offset = 0;
+			do
+			{
+				frames.clear();
+				offset = log.Read(offset, 256, frames) + frames.size();
+				for (const auto& frame : frames)
+				{
+					bytes += frame.Length();
+				}
+			} while (!frames.empty());
+		});
+	}
+	std::filesystem::remove_all(directory);
+
+	const auto megabytes = static_cast<double>(bytes) / (1024 * 1024);
+	std::cout << "topic-log: messages=" << messages << " payload=" << payload << " batch=" << batch << " fsync=" << (args.size() > 3 ? args[3] : "none") << "\n";
+	std::cout << "  append: " << static_cast<double>(messages) / appendSeconds << " messages/s, " << megabytes / appendSeconds << " MB/s\n";
+	std::cout << "  replay: " << static_cast<double>(messages) / replaySeconds << " messages/s, " << megabytes / replaySeconds << " MB/s\n";
+}
+
+/* publish [messages] [payload] [address]
+   Producer-side throughput against a running message-broker (default localhost:50051), at 1, 10 and 100 messages per batch:
+   - "unary Send": one RPC per batch, each one waits for its response;
+   - "streaming Publish": all the batches are written to a single stream, acks are cumulative and the producer waits only for the last one.
+*/
+static void PublishThroughput(const Arguments& args)
+{
+	const auto messages = ArgumentOr(args, 0, 100000);
+	const auto payload = ArgumentOr(args, 1, 64);
+	const auto address = args.size() > 2 ? args[2] : "localhost:50051";
+	const auto stub = MessageBroker::NewStub(grpc::CreateChannel(address, grpc::InsecureChannelCredentials()));
+
+	std::cout << "publish: messages=" << messages << " payload=" << payload << " broker=" << address << "\n";
+	for (const auto batchSize : { 1u, 10u, 100u })
+	{
+		SendRequest batch;
+		for (auto i = 0u; i < batchSize; ++i)
+		{
+			auto* message = batch.add_messages();
+			message->set_topic("bench");
+			message->set_content(std::string(payload, 'x'));
+		}
+		const auto batches = std::max<size_t>(messages / batchSize, 1);
+		const auto sent = static_cast<double>(batches * batchSize);
+
+		grpc::Status status;
+		const auto unarySeconds = MeasureSeconds([&] {
+			for (size_t i = 0; i < batches && status.ok(); ++i)
+			{
+				grpc::ClientContext context;
+				SendResponse response;
+				status = stub->Send(&context, batch, &response);
+			}
+		});
+
+		uint64_t acknowledged = 0;
+		const auto streamingSeconds = MeasureSeconds([&] {
+			grpc::ClientContext context;
+			const auto stream = stub->Publish(&context);
+			for (size_t i = 0; i < batches && stream->Write(batch); ++i)
+			{
+			}
+			stream->WritesDone();
+			PublishAck ack;
+			while (stream->Read(&ack))
+			{
+				acknowledged = ack.acknowledged();
+			}
+			if (status.ok())
+			{
+				status = stream->Finish();
+			}
+		});
+
+		if (!status.ok())
+		{
+			std::cout << "  batch=" << batchSize << ": error " << status.error_message() << "\n";
+			return;
+		}
+		std::cout << "  batch=" << batchSize << ": unary Send " << sent / unarySeconds << " messages/s, streaming Publish "
+			<< sent / streamingSeconds << " messages/s (" << acknowledged << " acknowledged)\n";
+	}
+}
+
+/* load [--name=value...]
+   A load generator against a running message-broker: publishers stream batches ("Publish") and subscribers get all the topics ("Receive"),
+   every publisher and subscriber on its own connection. Thus every message is delivered to every subscriber.
+   Publishers stamp the publish time into the payload and subscribers measure the end-to-end latency (they all run here, on the same clock).
+   Options: publishers (1), subscribers (10), topics (1), payload (64 bytes, at least the stamp), rate (0 = as fast as possible, messages/s over all publishers),
+   batch (1 message per SendRequest), seconds (10), address (localhost:50051), format (text or json: one object per run, to track regressions).
+*/
+struct LoadOptions
+{
+	size_t publishers = 1;
+	size_t subscribers = 10;
+	size_t topics = 1;
+	size_t payload = 64;
+	size_t rate = 0;
+	size_t batch = 1;
+	size_t seconds = 10;
+	std::string address = "localhost:50051";
+	std::string format = "text";
+};
+
+static LoadOptions ParseLoadOptions(const Arguments& args)
+{
+	static const std::map<std::string, size_t LoadOptions::*, std::less<>> sizes = {
+		{"publishers", &LoadOptions::publishers},
+		{"subscribers", &LoadOptions::subscribers},
+		{"topics", &LoadOptions::topics},
+		{"payload", &LoadOptions::payload},
+		{"rate", &LoadOptions::rate},
+		{"batch", &LoadOptions::batch},
+		{"seconds", &LoadOptions::seconds},
+	};
+	LoadOptions options;
+	for (const std::string_view arg : args)
+	{
+		const auto separator = arg.find('=');
+		if (!arg.starts_with("--") || separator == std::string_view::npos)
+		{
+			throw std::invalid_argument("Invalid option '" + std::string(arg) + "' (expected --name=value)");
+		}
+		const auto name = arg.substr(2, separator - 2);
+		const auto value = arg.substr(separator + 1);
+		if (const auto size = sizes.find(name); size != end(sizes))
+		{
+			options.*size->second = ParseSize(name, value);
+		}
+		else if (name == "address")
+		{
+			options.address = value;
+		}
+		else if (name == "format" && (value == "text" || value == "json"))
+		{
+			options.format = value;
+		}
+		else
+		{
+			throw std::invalid_argument("Invalid option '" + std::string(arg) + "'");
+		}
+	}
+	options.publishers = std::max<size_t>(options.publishers, 1);
+	options.topics = std::max<size_t>(options.topics, 1);
+	options.batch = std::max<size_t>(options.batch, 1);
+	return options;
+}
+
+// contents are strings (thus valid UTF-8): the publish time is written in digits, at the beginning of the payload
+static constexpr size_t StampSize = 20;
+
+static void StampPayload(std::string& payload, Clock::time_point now)
+{
+	std::format_to(payload.begin(), "{:020}", now.time_since_epoch().count());
+}
+
+static std::optional<Clock::time_point> ReadStamp(const std::string& payload)
+{
+	Clock::rep ticks = 0;
+	if (payload.size() < StampSize || std::from_chars(payload.data(), payload.data() + StampSize, ticks).ec != std::errc{})
+	{
+		return std::nullopt;
+	}
+	return Clock::time_point(Clock::duration(ticks));
+}
+
+// as separate clients would do, instead of sharing one connection
+static std::shared_ptr<grpc::Channel> MakeOwnChannel(const std::string& address)
+{
+	grpc::ChannelArguments arguments;
+	arguments.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+	return grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), arguments);
+}
+
+static std::string LoadTopic(size_t index)
+{
+	return std::format("load.{}", index);
+}
+
+// publishing starts once the broker sees all the subscribers on all the topics (see Stats), false if this does not happen in a few seconds
+static bool WaitForSubscribers(MessageBroker::Stub& stub, const LoadOptions& options)
+{
+	const auto deadline = Clock::now() + std::chrono::seconds(5);
+	while (Clock::now() < deadline)
+	{
+		grpc::ClientContext context;
+		StatsResponse stats;
+		if (stub.Stats(&context, StatsRequest{}, &stats).ok())
+		{
+			const auto ready = std::ranges::count_if(stats.topics(), [&](const TopicStats& topic) {
+				return topic.topic().starts_with("load.") && topic.subscribers() >= options.subscribers;
+			});
+			if (static_cast<size_t>(ready) >= options.topics)
+			{
+				return true;
+			}
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	return false;
+}
+
+static void Load(const Arguments& args)
+{
+	const auto options = ParseLoadOptions(args);
+	const auto payload = std::max<size_t>(options.payload, StampSize);
+	std::mutex errorMutex;
+	std::string error; // the first one
+	const auto fail = [&](const std::string& what, const grpc::Status& status) {
+		std::lock_guard lock{ errorMutex };
+		if (error.empty())
+		{
+			error = what + ": " + status.error_message();
+		}
+	};
+
+	// every subscriber counts and measures on its own
+	struct Subscriber
+	{
+		grpc::ClientContext context;
+		std::atomic<uint64_t> received = 0;
+		HistogramCounters latency;
+	};
+	std::vector<std::unique_ptr<Subscriber>> subscribers;
+	std::vector<std::jthread> subscriberThreads;
+	for (size_t i = 0; i < options.subscribers; ++i)
+	{
+		auto& subscriber = *subscribers.emplace_back(std::make_unique<Subscriber>());
+		subscriberThreads.emplace_back([&] {
+			ReceiveRequest request;
+			for (size_t topic = 0; topic < options.topics; ++topic)
+			{
+				request.add_topics(LoadTopic(topic));
+			}
+			const auto stub = MessageBroker::NewStub(MakeOwnChannel(options.address));
+			const auto reader = stub->Receive(&subscriber.context, request);
+			ReceiveResponse response;
+			const auto record = [&](const Message& message, Clock::time_point now) {
+				if (const auto stamp = ReadStamp(message.content()))
+				{
+					subscriber.latency.Record(now - *stamp);
+				}
+				subscriber.received.fetch_add(1, std::memory_order_relaxed);
+			};
+			while (reader->Read(&response))
+			{
+				const auto now = Clock::now();
+				if (response.has_message())
+				{
+					record(response.message(), now);
+				}
+				for (const auto& message : response.messages())
+				{
+					record(message, now);
+				}
+			}
+			// cancelled at the end of the run
+			if (const auto status = reader->Finish(); !status.ok() && status.error_code() != grpc::StatusCode::CANCELLED)
+			{
+				fail("Receive", status);
+			}
+		});
+	}
+
+	const auto stub = MessageBroker::NewStub(MakeOwnChannel(options.address));
+	if (!WaitForSubscribers(*stub, options))
+	{
+		fail("Stats", grpc::Status{ grpc::StatusCode::DEADLINE_EXCEEDED, "the subscribers are not there after 5 seconds" });
+	}
+
+	std::atomic<uint64_t> published = 0; // acknowledged by the broker
+	const auto start = Clock::now();
+	const auto end = start + std::chrono::seconds(options.seconds);
+	{
+		std::vector<std::jthread> publishers;
+		for (size_t p = 0; p < options.publishers; ++p)
+		{
+			publishers.emplace_back([&, p] {
+				const auto publisherStub = MessageBroker::NewStub(MakeOwnChannel(options.address));
+				grpc::ClientContext context;
+				const auto stream = publisherStub->Publish(&context);
+				// acks are read meanwhile, otherwise the broker might block on writing them
+				uint64_t acknowledged = 0;
+				std::jthread acks{ [&] {
+					PublishAck ack;
+					while (stream->Read(&ack))
+					{
+						acknowledged = ack.acknowledged();
+					}
+				} };
+
+				SendRequest batch;
+				for (size_t i = 0; i < options.batch; ++i)
+				{
+					batch.add_messages()->set_content(std::string(payload, 'x'));
+				}
+				// the rate is split among publishers, every batch has its time slot
+				const auto interval = options.rate ? std::chrono::duration<double>(static_cast<double>(options.batch * options.publishers) / static_cast<double>(options.rate)) : std::chrono::duration<double>{};
+				auto next = Clock::now();
+				for (size_t sent = p; Clock::now() < end; )
+				{
+					if (options.rate)
+					{
+						std::this_thread::sleep_until(next);
+						next += std::chrono::duration_cast<Clock::duration>(interval);
+					}
+					const auto now = Clock::now();
+					for (auto& message : *batch.mutable_messages())
+					{
+						message.set_topic(LoadTopic(sent++ % options.topics));
+						StampPayload(*message.mutable_content(), now);
+					}
+					if (!stream->Write(batch))
+					{
+						break;
+					}
+				}
+				stream->WritesDone();
+				acks.join();
+				if (const auto status = stream->Finish(); !status.ok())
+				{
+					fail("Publish", status);
+				}
+				published += acknowledged;
+			});
+		}
+	}
+	const auto publishSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+	// subscribers get what is still in flight, until they stop making progress
+	const auto expected = published.load() * options.subscribers;
+	const auto receivedSoFar = [&] {
+		uint64_t received = 0;
+		for (const auto& subscriber : subscribers)
+		{
+			received += subscriber->received.load(std::memory_order_relaxed);
+		}
+		return received;
+	};
+	for (auto received = receivedSoFar(), previous = uint64_t{ 0 }; received < expected && received != previous; )
+	{
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+		previous = std::exchange(received, receivedSoFar());
+	}
+	const auto deliverySeconds = std::chrono::duration<double>(Clock::now() - start).count();
+	for (const auto& subscriber : subscribers)
+	{
+		subscriber->context.TryCancel();
+	}
+	subscriberThreads.clear();
+
+	HistogramSnapshot latency;
+	for (const auto& subscriber : subscribers)
+	{
+		latency.Add(subscriber->latency);
+	}
+	const auto delivered = receivedSoFar();
+	const auto toMicroseconds = [](uint64_t nanoseconds) {
+		return static_cast<double>(nanoseconds) / 1000.0;
+	};
+	const auto publishRate = static_cast<double>(published.load()) / publishSeconds;
+	const auto deliveryRate = static_cast<double>(delivered) / deliverySeconds;
+	if (options.format == "json")
+	{
+		std::ranges::replace(error, '"', '\'');
+		std::cout << std::format(R"({{"publishers":{},"subscribers":{},"topics":{},"payload":{},"rate":{},"batch":{},"seconds":{},)"
+			R"("published":{},"publish_rate":{:.1f},"expected":{},"delivered":{},"delivery_rate":{:.1f},)"
+			R"("p50_us":{:.1f},"p99_us":{:.1f},"p999_us":{:.1f},"max_us":{:.1f},"error":"{}"}})",
+			options.publishers, options.subscribers, options.topics, payload, options.rate, options.batch, options.seconds,
+			published.load(), publishRate, expected, delivered, deliveryRate,
+			toMicroseconds(latency.ValueAt(0.5)), toMicroseconds(latency.ValueAt(0.99)), toMicroseconds(latency.ValueAt(0.999)), toMicroseconds(latency.Max()),
+			error) << "\n";
+		return;
+	}
+	std::cout << "load: publishers=" << options.publishers << " subscribers=" << options.subscribers << " topics=" << options.topics << " payload=" << payload
+		<< " rate=" << options.rate << " batch=" << options.batch << " seconds=" << options.seconds << " broker=" << options.address << "\n";
+	if (!error.empty())
+	{
+		std::cout << "  error " << error << "\n";
+	}
+	std::cout << "  published " << published.load() << " messages (" << publishRate << " messages/s), delivered " << delivered << " of " << expected
+		<< " (" << deliveryRate << " messages/s)\n";
+	std::cout << "  latency: p50 " << toMicroseconds(latency.ValueAt(0.5)) << "us, p99 " << toMicroseconds(latency.ValueAt(0.99)) << "us, p999 "
+		<< toMicroseconds(latency.ValueAt(0.999)) << "us, max " << toMicroseconds(latency.Max()) << "us\n";
+}
+
+/* federation [messages] [address A] [address B]
+   Checks two federated brokers running on this host, e.g.:
+     message-broker --address=localhost:50051 --federate=localhost:50052
+     message-broker --address=localhost:50052 --federate=localhost:50051
+   A subscriber on each broker, then messages published to A and as many to B: every subscriber must get every message exactly once.
+   Fewer means that interest did not cross the links, more means that messages looped. Prints how long the subscribers took to get all the messages.
+*/
+static void Federation(const Arguments& args)
+{
+	const auto messages = ArgumentOr(args, 0, 500); // all of them fit in the outbound queues (see message-broker --max-queue)
+	const std::vector<std::string> addresses = { args.size() > 1 ? args[1] : "localhost:50051", args.size() > 2 ? args[2] : "localhost:50052" };
+	static const std::string topic = "federation.check";
+
+	struct Subscriber
+	{
+		grpc::ClientContext context;
+		std::mutex mutex;
+		std::map<std::string, size_t> received; // by content
+		size_t total = 0;
+		Clock::time_point last;
+	};
+	std::vector<std::unique_ptr<MessageBroker::Stub>> stubs;
+	std::vector<std::unique_ptr<Subscriber>> subscribers;
+	std::vector<std::jthread> threads;
+	for (const auto& address : addresses)
+	{
+		stubs.push_back(MessageBroker::NewStub(MakeOwnChannel(address)));
+		auto& subscriber = *subscribers.emplace_back(std::make_unique<Subscriber>());
+		threads.emplace_back([&subscriber, &stub = *stubs.back()] {
+			ReceiveRequest request;
+			request.add_topics(topic);
+			const auto reader = stub.Receive(&subscriber.context, request);
+			ReceiveResponse response;
+			while (reader->Read(&response))
+			{
+				std::lock_guard lock{ subscriber.mutex };
+				++subscriber.received[response.message().content()];
+				++subscriber.total;
+				subscriber.last = Clock::now();
+			}
+		});
+	}
+
+	// the link of the other broker subscribes too, once it has seen the interest
+	const auto deadline = Clock::now() + std::chrono::seconds(10);
+	const auto linked = [&](MessageBroker::Stub& stub) {
+		grpc::ClientContext context;
+		StatsResponse stats;
+		return stub.Stats(&context, StatsRequest{}, &stats).ok() && std::ranges::any_of(stats.topics(), [](const TopicStats& stats) {
+			return stats.topic() == topic && stats.subscribers() >= 2;
+		});
+	};
+	while (!std::ranges::all_of(stubs, [&](const auto& stub) { return linked(*stub); }))
+	{
+		if (Clock::now() > deadline)
+		{
+			throw std::runtime_error("the brokers are not linked (see message-broker --federate)");
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	const auto start = Clock::now();
+	for (size_t broker = 0; broker < stubs.size(); ++broker)
+	{
+		SendRequest request;
+		for (size_t i = 0; i < messages; ++i)
+		{
+			auto* message = request.add_messages();
+			message->set_topic(topic);
+			message->set_content(std::format("{}-{}", broker, i));
+		}
+		grpc::ClientContext context;
+		SendResponse response;
+		if (const auto status = stubs[broker]->Send(&context, request, &response); !status.ok())
+		{
+			throw std::runtime_error("can't publish to " + addresses[broker] + ": " + status.error_message());
+		}
+	}
+
+	// late duplicates are waited for a little, after all the messages have arrived
+	const auto expected = messages * stubs.size();
+	const auto complete = [&] {
+		return std::ranges::all_of(subscribers, [&](const auto& subscriber) {
+			std::lock_guard lock{ subscriber->mutex };
+			return subscriber->total >= expected;
+		});
+	};
+	while (!complete() && Clock::now() < deadline + std::chrono::seconds(10))
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(500));
+	for (auto& subscriber : subscribers)
+	{
+		subscriber->context.TryCancel();
+	}
+	threads.clear();
+
+	std::cout << "federation: messages=" << messages << " per broker, brokers " << addresses[0] << " and " << addresses[1] << "\n";
+	bool ok = true;
+	for (size_t broker = 0; broker < subscribers.size(); ++broker)
+	{
+		const auto& subscriber = *subscribers[broker];
+		const auto duplicates = std::ranges::count_if(subscriber.received, [](const auto& content) { return content.second > 1; });
+		const auto missing = expected - subscriber.received.size();
+		ok = ok && !duplicates && !missing;
+		std::cout << "  subscriber on " << addresses[broker] << ": " << subscriber.total << " received, " << missing << " missing, " << duplicates << " duplicated";
+		if (subscriber.total)
+		{
+			std::cout << ", all in " << std::chrono::duration<double, std::milli>(subscriber.last - start).count() << "ms";
+		}
+		std::cout << "\n";
+	}
+	std::cout << (ok ? "  OK" : "  FAILED") << "\n";
+}
+
+/* churn [operations] [clients] [topics] [address]
+   Measures subscribing and unsubscribing on a running broker: every client opens "Receive" on a topic, waits for its retained value
+   and goes away, [operations] times in total. Prints the operations per second and the latency from "Receive" to the retained value.
+   Compare, for instance, message-broker --light-subscriptions=true (slots) and --light-subscriptions=false (an agent and a cooperation per subscriber).
+*/
+static void Churn(const Arguments& args)
+{
+	const auto operations = ArgumentOr(args, 0, 100000);
+	const auto clients = std::max<size_t>(ArgumentOr(args, 1, 16), 1);
+	const auto topics = std::max<size_t>(ArgumentOr(args, 2, 100), 1);
+	const auto address = args.size() > 3 ? args[3] : "localhost:50051";
+
+	// every topic has a retained value, thus every subscriber gets something as soon as it is subscribed
+	auto stub = MessageBroker::NewStub(MakeOwnChannel(address));
+	SendRequest retained;
+	for (size_t topic = 0; topic < topics; ++topic)
+	{
+		auto* message = retained.add_messages();
+		message->set_topic(std::format("churn.{}", topic));
+		message->set_content("retained");
+		message->set_retain(true);
+	}
+	grpc::ClientContext sendContext;
+	SendResponse sendResponse;
+	if (const auto status = stub->Send(&sendContext, retained, &sendResponse); !status.ok())
+	{
+		throw std::runtime_error("can't publish the retained values: " + status.error_message());
+	}
+
+	struct Client
+	{
+		std::unique_ptr<MessageBroker::Stub> stub;
+		HistogramCounters latency;
+		size_t failed = 0;
+	};
+	std::vector<std::unique_ptr<Client>> churners;
+	std::atomic<size_t> next = 0;
+	const auto seconds = MeasureSeconds([&] {
+		std::vector<std::jthread> threads;
+		for (size_t i = 0; i < clients; ++i)
+		{
+			auto& client = *churners.emplace_back(std::make_unique<Client>(MessageBroker::NewStub(MakeOwnChannel(address))));
+			threads.emplace_back([&, &client = client] {
+				for (auto operation = next++; operation < operations; operation = next++)
+				{
+					grpc::ClientContext context;
+					ReceiveRequest request;
+					request.add_topics(std::format("churn.{}", operation % topics));
+					const auto start = Clock::now();
+					const auto reader = client.stub->Receive(&context, request);
+					ReceiveResponse response;
+					if (reader->Read(&response))
+					{
+						client.latency.Record(Clock::now() - start);
+					}
+					else
+					{
+						++client.failed;
+					}
+					context.TryCancel();
+					reader->Finish();
+				}
+			});
+		}
+	});
+
+	HistogramSnapshot latency;
+	size_t failed = 0;
+	for (const auto& client : churners)
+	{
+		latency.Add(client->latency);
+		failed += client->failed;
+	}
+	const auto toMicroseconds = [](uint64_t nanoseconds) {
+		return static_cast<double>(nanoseconds) / 1000.0;
+	};
+	std::cout << "churn: operations=" << operations << " clients=" << clients << " topics=" << topics << " broker=" << address << "\n";
+	std::cout << "  " << static_cast<double>(operations) / seconds << " subscribe/unsubscribe per second, " << failed << " failed\n";
+	std::cout << "  subscribe latency: p50 " << toMicroseconds(latency.ValueAt(0.5)) << "us, p99 " << toMicroseconds(latency.ValueAt(0.99)) << "us, p999 "
+		<< toMicroseconds(latency.ValueAt(0.999)) << "us, max " << toMicroseconds(latency.Max()) << "us\n";
+}
+
+/* client [messages] [payload] [address]
+   The C++ client library against a running broker: a BrokerProducer sends [messages] with a few batch sizes and batches in flight,
+   while a BrokerConsumer on the same topic counts what is delivered. Compare with "publish", which sends one request at a time.
+*/
+static void ClientThroughput(const Arguments& args)
+{
+	const auto messages = ArgumentOr(args, 0, 100000);
+	const auto payload = ArgumentOr(args, 1, 64);
+	const auto address = args.size() > 2 ? args[2] : "localhost:50051";
+	const auto stub = MessageBroker::NewStub(MakeOwnChannel(address));
+	const std::string content(payload, 'x');
+
+	// producing starts once the broker sees the consumer (see Stats)
+	const auto waitForConsumer = [&] {
+		const auto deadline = Clock::now() + std::chrono::seconds(5);
+		while (Clock::now() < deadline)
+		{
+			grpc::ClientContext context;
+			StatsResponse stats;
+			if (stub->Stats(&context, StatsRequest{}, &stats).ok() && std::ranges::any_of(stats.topics(), [](const TopicStats& topic) {
+				return topic.topic() == "bench.client" && topic.subscribers();
+			}))
+			{
+				return true;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		return false;
+	};
+
+	std::cout << "client: messages=" << messages << " payload=" << payload << " broker=" << address << "\n";
+	for (const auto& [maxBatch, maxInFlight] : { std::pair<size_t, size_t>{ 1, 1 }, { 100, 1 }, { 100, 4 }, { 1000, 8 } })
+	{
+		std::atomic<uint64_t> received = 0;
+		ReceiveRequest request;
+		request.add_topics("bench.client");
+		BrokerConsumer consumer(MakeOwnChannel(address), request, [&](const Message&) {
+			received.fetch_add(1, std::memory_order_relaxed);
+		});
+		if (!waitForConsumer())
+		{
+			std::cout << "  the consumer did not subscribe in time\n";
+			return;
+		}
+
+		ProducerSettings settings;
+		settings.maxBatch = maxBatch;
+		settings.maxInFlight = maxInFlight;
+		BrokerProducer producer(MakeOwnChannel(address), settings);
+		const auto seconds = MeasureSeconds([&] {
+			for (size_t i = 0; i < messages; ++i)
+			{
+				producer.Send("bench.client", content);
+			}
+			producer.Flush();
+		});
+		const auto deadline = Clock::now() + std::chrono::seconds(5);
+		while (received.load(std::memory_order_relaxed) < messages && Clock::now() < deadline)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+
+		const auto stats = producer.Stats();
+		std::cout << "  batch=" << maxBatch << " in flight=" << maxInFlight << ": " << static_cast<double>(stats.sent) / seconds << " messages/s, "
+			<< stats.failed << " failed" << (stats.lastError.empty() ? "" : " (" + stats.lastError + ")") << ", " << received.load() << " delivered\n";
+	}
+}
+
+/* embedded [messages] [subscribers] [payload] [address]
+   The broker core in process (see EmbeddedBroker): a publisher moves [messages] in while [subscribers] in-process subscribers count them.
+   Then the same broker is served by gRPC on [address] and the same messages go through loopback, sent by a BrokerProducer to as many BrokerConsumers.
+   Both are measured until every subscriber has got every message.
+*/
+static void Embedded(const Arguments& args)
+{
+	const auto messages = ArgumentOr(args, 0, 100000);
+	const auto subscribers = std::max<size_t>(ArgumentOr(args, 1, 4), 1);
+	const auto payload = ArgumentOr(args, 2, 64);
+	const auto address = args.size() > 3 ? args[3] : "localhost:50052";
+	const std::string content(payload, 'x');
+	std::atomic<uint64_t> received = 0;
+	const auto waitForDelivery = [&] {
+		const auto deadline = Clock::now() + std::chrono::seconds(30);
+		while (received.load(std::memory_order_relaxed) < messages * subscribers && Clock::now() < deadline)
+		{
+			std::this_thread::yield();
+		}
+	};
+	const auto count = [&](const Message&) {
+		received.fetch_add(1, std::memory_order_relaxed);
+	};
+
+	std::cout << "embedded: messages=" << messages << " subscribers=" << subscribers << " payload=" << payload << "\n";
+	EmbeddedBroker broker{ BrokerOptions{} };
+	double inProcess = 0;
+	{
+		std::vector<EmbeddedSubscription> subscriptions;
+		for (size_t i = 0; i < subscribers; ++i)
+		{
+			subscriptions.push_back(broker.Subscribe({ "bench.embedded" }, count));
+		}
+		inProcess = MeasureSeconds([&] {
+			for (size_t i = 0; i < messages; ++i)
+			{
+				Message message;
+				message.set_topic("bench.embedded");
+				message.set_content(content);
+				if (const auto status = broker.Publish(std::move(message)); !status.ok())
+				{
+					throw std::runtime_error(status.error_message());
+				}
+			}
+			waitForDelivery();
+		});
+		std::cout << "  in process: " << static_cast<double>(messages) / inProcess << " messages/s, " << received.load() << " delivered\n";
+	}
+
+	grpc::ServerBuilder builder;
+	builder.AddListeningPort(address, grpc::InsecureServerCredentials());
+	builder.RegisterService(&broker.Service());
+	const auto server = builder.BuildAndStart();
+	if (!server)
+	{
+		std::cout << "  can't serve on " << address << "\n";
+		return;
+	}
+	received = 0;
+	{
+		const auto stub = MessageBroker::NewStub(MakeOwnChannel(address));
+		std::vector<std::unique_ptr<BrokerConsumer>> consumers;
+		ReceiveRequest request;
+		request.add_topics("bench.embedded.grpc");
+		for (size_t i = 0; i < subscribers; ++i)
+		{
+			consumers.push_back(std::make_unique<BrokerConsumer>(MakeOwnChannel(address), request, count));
+		}
+		// producing starts once the broker sees every consumer (see Stats)
+		const auto deadline = Clock::now() + std::chrono::seconds(5);
+		auto subscribed = false;
+		while (!subscribed && Clock::now() < deadline)
+		{
+			grpc::ClientContext context;
+			StatsResponse stats;
+			subscribed = stub->Stats(&context, StatsRequest{}, &stats).ok() && std::ranges::any_of(stats.topics(), [&](const TopicStats& topic) {
+				return topic.topic() == "bench.embedded.grpc" && topic.subscribers() >= subscribers;
+			});
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		if (!subscribed)
+		{
+			std::cout << "  the consumers did not subscribe in time\n";
+		}
+		else
+		{
+			BrokerProducer producer(MakeOwnChannel(address));
+			const auto loopback = MeasureSeconds([&] {
+				for (size_t i = 0; i < messages; ++i)
+				{
+					producer.Send("bench.embedded.grpc", content);
+				}
+				producer.Flush();
+				waitForDelivery();
+			});
+			std::cout << "  gRPC loopback: " << static_cast<double>(messages) / loopback << " messages/s, " << received.load() << " delivered\n";
+			std::cout << "  in process is " << loopback / inProcess << "x faster\n";
+		}
+	}
+	// as message-broker does: agents first, then the server
+	broker.Stop();
+	server->Shutdown();
+	server->Wait();
+}
+
+int main(int argc, char* argv[])
+{
+	const std::map<std::string, std::function<void(const Arguments&)>> scenarios = {
+		{"churn", Churn},
+		{"client", ClientThroughput},
+		{"dispatch", Dispatch},
+		{"embedded", Embedded},
+		{"fanout", FanOut},
+		{"federation", Federation},
+		{"idle-subscribers", IdleSubscribers},
+		{"load", Load},
+		{"publish", PublishThroughput},
+		{"topic-log", TopicLogThroughput},
+	};
+
+	if (argc < 2 || !scenarios.contains(argv[1]))
+	{
+		std::cout << "Usage: message-broker-bench <scenario> [arguments...]\nScenarios:";
+		for (const auto& [name, _] : scenarios)
+		{
+			std::cout << " " << name;
+		}
+		std::cout << "\n";
+		return 1;
+	}
+	try
+	{
+		scenarios.at(argv[1])(Arguments(argv + 2, argv + argc));
+	}
+	catch (const std::exception& ex)
+	{
+		std::cout << argv[1] << ": " << ex.what() << "
+";
+		return 1;
+	}
+}
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <charconv>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "federation-link.h"
+#include "topic-log.h"
+
+// how "Receive" is served
+enum class ReceiveMode
+{
+	sync,     // gRPC synchronous API: one gRPC thread is parked for the whole life of every subscription
+	callback, // gRPC callback API: a reactor per subscription, idle subscribers hold no threads
+};
+
+// how agents are bound to SObjectizer threads
+enum class DispatchMode
+{
+	pool,    // a thread pool: agents float across threads
+	sharded, // a thread per shard (optionally pinned to a core): every subscriber stays on its shard, publishers reach only the shards with subscribers of a topic
+};
+
+// the settings of the broker, they can be changed from the command line (e.g. message-broker --receive-mode=sync)
+struct BrokerOptions
+{
+	ReceiveMode receiveMode = ReceiveMode::callback;
+	DispatchMode dispatchMode = DispatchMode::pool;
+	// threads of the pool or number of shards, 0 means the hardware concurrency
+	size_t dispatchThreads = 0;
+	// sharded dispatch only: shard N runs on core N (modulo the number of cores)
+	bool pinThreads = false;
+	// plain "Receive" subscriptions are served by slots instead of agents (see SubscriberSlots)
+	bool lightSubscriptions = true;
+	// the capacity of every subscriber's outbound queue (subscribers can ask for less, see ReceiveRequest.max_queue)
+	size_t maxOutboundQueue = 1024;
+	// topics are logged to disk only if a directory is given (e.g. --log-dir=C:/broker-log)
+	TopicLogSettings log;
+	// "Publish" acknowledges every N messages or after this window (whichever comes first)
+	size_t publishAckEvery = 100;
+	std::chrono::milliseconds publishAckWindow{ 10 };
+	// acknowledged delivery: responses are written again if not acknowledged within this time (subscribers can ask for another one)
+	std::chrono::milliseconds ackTimeout{ 5000 };
+	// acknowledged delivery: how long a session waits for its subscriber to reconnect
+	std::chrono::milliseconds ackSessionTtl{ 60000 };
+	// the memory (in bytes) for the retained values of all topics (see Message.retain), 0 turns retained values off
+	size_t retainedBudget = 64 * 1024 * 1024;
+	// the size (in bytes) of the dictionary learned by every topic for compressed delivery (see ReceiveRequest.compression), 0 turns dictionaries off
+	size_t compressionDictionary = 16 * 1024;
+	// where the broker listens
+	std::string address = "localhost:50051";
+	// the id of this broker among the federated ones (see Message.origin), the address if not given
+	std::string brokerId;
+	// federation: the addresses of the brokers whose topics are bridged into this one (e.g. --federate=host1:50051,host2:50051), none by default
+	std::vector<std::string> federate;
+	// federation: how the remote brokers batch the messages of a link
+	FederationSettings federation;
+	// the partitioned topics and how many partitions they have (e.g. --partitions=orders:8,trades:4), none by default
+	std::map<std::string, size_t, std::less<>> partitions;
+	// the threads fanning out the messages of partitions (see PartitionLane), 0 means the hardware concurrency
+	size_t partitionLanes = 0;
+};
+
+inline ReceiveMode ParseReceiveMode(std::string_view value)
+{
+	if (value == "sync")
+		return ReceiveMode::sync;
+	if (value == "callback")
+		return ReceiveMode::callback;
+	throw std::invalid_argument("Invalid receive mode '" + std::string(value) + "' (expected sync or callback)");
+}
+
+inline DispatchMode ParseDispatchMode(std::string_view value)
+{
+	if (value == "pool")
+		return DispatchMode::pool;
+	if (value == "sharded")
+		return DispatchMode::sharded;
+	throw std::invalid_argument("Invalid dispatch mode '" + std::string(value) + "' (expected pool or sharded)");
+}
+
+inline bool ParseBool(std::string_view name, std::string_view value)
+{
+	if (value == "true")
+		return true;
+	if (value == "false")
+		return false;
+	throw std::invalid_argument("Invalid value '" + std::string(value) + "' for option '" + std::string(name) + "' (expected true or false)");
+}
+
+// the whole value must be a number: no sign (std::stoull takes -1 as the biggest size), no trailing characters
+inline size_t ParseSize(std::string_view name, std::string_view value)
+{
+	size_t size = 0;
+	const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), size);
+	if (error != std::errc{} || end != value.data() + value.size())
+	{
+		throw std::invalid_argument("Invalid value '" + std::string(value) + "' for option '" + std::string(name) + "' (expected a number)");
+	}
+	return size;
+}
+
+// comma separated values, empty ones are skipped
+inline std::vector<std::string> ParseList(std::string_view value)
+{
+	std::vector<std::string> values;
+	while (!value.empty())
+	{
+		const auto comma = value.find(',');
+		if (const auto item = value.substr(0, comma); !item.empty())
+		{
+			values.emplace_back(item);
+		}
+		value = comma == std::string_view::npos ? std::string_view{} : value.substr(comma + 1);
+	}
+	return values;
+}
+
+// "topic:count" pairs, comma separated
+inline std::map<std::string, size_t, std::less<>> ParsePartitions(std::string_view value)
+{
+	std::map<std::string, size_t, std::less<>> partitions;
+	for (const auto& item : ParseList(value))
+	{
+		const auto colon = item.rfind(':');
+		if (colon == std::string::npos || colon == 0)
+		{
+			throw std::invalid_argument("Invalid partitions '" + item + "' (expected topic:count)");
+		}
+		const auto count = ParseSize("partitions", std::string_view{ item }.substr(colon + 1));
+		if (!count)
+		{
+			throw std::invalid_argument("Invalid partitions '" + item + "' (a topic has one partition at least)");
+		}
+		partitions[item.substr(0, colon)] = count;
+	}
+	return partitions;
+}
+
+inline FsyncPolicy ParseFsyncPolicy(std::string_view value)
+{
+	if (value == "none")
+		return FsyncPolicy::none;
+	if (value == "interval")
+		return FsyncPolicy::interval;
+	if (value == "batch")
+		return FsyncPolicy::batch;
+	throw std::invalid_argument("Invalid fsync policy '" + std::string(value) + "' (expected none, interval or batch)");
+}
+
+// every option has the form "--name=value"
+inline BrokerOptions ParseBrokerOptions(int argc, char* argv[])
+{
+	BrokerOptions options;
+	for (auto i = 1; i < argc; ++i)
+	{
+		const std::string_view arg = argv[i];
+		const auto separator = arg.find('=');
+		if (!arg.starts_with("--") || separator == std::string_view::npos)
+		{
+			throw std::invalid_argument("Invalid option '" + std::string(arg) + "' (expected --name=value)");
+		}
+		const auto name = arg.substr(2, separator - 2);
+		const auto value = arg.substr(separator + 1);
+		if (name == "receive-mode")
+		{
+			options.receiveMode = ParseReceiveMode(value);
+		}
+		else if (name == "dispatch")
+		{
+			options.dispatchMode = ParseDispatchMode(value);
+		}
+		else if (name == "dispatch-threads")
+		{
+			options.dispatchThreads = ParseSize(name, value);
+		}
+		else if (name == "pin-threads")
+		{
+			options.pinThreads = ParseBool(name, value);
+		}
+		else if (name == "light-subscriptions")
+		{
+			options.lightSubscriptions = ParseBool(name, value);
+		}
+		else if (name == "max-queue")
+		{
+			options.maxOutboundQueue = ParseSize(name, value);
+		}
+		else if (name == "publish-ack-every")
+		{
+			options.publishAckEvery = ParseSize(name, value);
+		}
+		else if (name == "publish-ack-window")
+		{
+			options.publishAckWindow = std::chrono::milliseconds(ParseSize(name, value));
+		}
+		else if (name == "ack-timeout")
+		{
+			options.ackTimeout = std::chrono::milliseconds(ParseSize(name, value));
+		}
+		else if (name == "ack-session-ttl")
+		{
+			options.ackSessionTtl = std::chrono::milliseconds(ParseSize(name, value));
+		}
+		else if (name == "retained-budget")
+		{
+			options.retainedBudget = ParseSize(name, value);
+		}
+		else if (name == "compression-dictionary")
+		{
+			options.compressionDictionary = ParseSize(name, value);
+		}
+		else if (name == "address")
+		{
+			options.address = value;
+		}
+		else if (name == "broker-id")
+		{
+			options.brokerId = value;
+		}
+		else if (name == "federate")
+		{
+			options.federate = ParseList(value);
+		}
+		else if (name == "federation-batch")
+		{
+			options.federation.maxBatch = ParseSize(name, value);
+		}
+		else if (name == "federation-linger")
+		{
+			options.federation.linger = std::chrono::microseconds(ParseSize(name, value));
+		}
+		else if (name == "partitions")
+		{
+			options.partitions = ParsePartitions(value);
+		}
+		else if (name == "partition-lanes")
+		{
+			options.partitionLanes = ParseSize(name, value);
+		}
+		else if (name == "log-dir")
+		{
+			options.log.directory = value;
+		}
+		else if (name == "log-segment-size")
+		{
+			options.log.segmentSize = ParseSize(name, value);
+		}
+		else if (name == "log-retention")
+		{
+			options.log.retainedSegments = ParseSize(name, value);
+		}
+		else if (name == "log-fsync")
+		{
+			options.log.fsync = ParseFsyncPolicy(value);
+		}
+		else if (name == "log-fsync-interval")
+		{
+			options.log.fsyncInterval = std::chrono::milliseconds(ParseSize(name, value));
+		}
+		else
+		{
+			throw std::invalid_argument("Unknown option '" + std::string(name) + "'");
+		}
+	}
+	if (options.brokerId.empty())
+	{
+		options.brokerId = options.address;
+	}
+	return options;
+}
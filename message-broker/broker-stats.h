@@ -0,0 +1,323 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include "topic-registry.h"
+
+using StatsClock = std::chrono::steady_clock;
+
+// a counter with a single writer (the thread owning it) and any readers: no read-modify-write instructions, no contention
+class StatsCounter
+{
+public:
+	void Add(uint64_t value)
+	{
+		m_value.store(m_value.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] uint64_t Load() const
+	{
+		return m_value.load(std::memory_order_relaxed);
+	}
+private:
+	std::atomic<uint64_t> m_value = 0;
+};
+
+/* An HDR-style histogram of durations in nanoseconds: every power of 2 is split into 16 linear buckets, thus a value is
+   counted with a precision of about 6%, from 1ns up to the whole uint64_t range, in less than 1000 buckets.
+   Recording is a couple of instructions on a single writer counter (see StatsCounter), reading is done on a HistogramSnapshot.
+*/
+class HistogramCounters
+{
+public:
+	static constexpr size_t SubBuckets = 16;
+	static constexpr size_t Buckets = SubBuckets + (64 - 4) * SubBuckets;
+
+	void Record(std::chrono::nanoseconds duration)
+	{
+		const auto value = static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+		m_counts[BucketOf(value)].Add(1);
+		if (value > m_max.load(std::memory_order_relaxed))
+		{
+			m_max.store(value, std::memory_order_relaxed);
+		}
+	}
+
+	static size_t BucketOf(uint64_t value)
+	{
+		if (value < SubBuckets)
+		{
+			return static_cast<size_t>(value);
+		}
+		// the 5 most significant bits are 1xxxx: the position of the first one picks the power of 2, the other 4 the linear bucket
+		const auto exponent = static_cast<size_t>(std::bit_width(value)) - 1;
+		const auto subBucket = static_cast<size_t>(value >> (exponent - 4)) - SubBuckets;
+		return SubBuckets + (exponent - 4) * SubBuckets + subBucket;
+	}
+
+	// the highest value counted by the bucket
+	static uint64_t UpperBoundOf(size_t bucket)
+	{
+		if (bucket < SubBuckets)
+		{
+			return bucket;
+		}
+		const auto exponent = (bucket - SubBuckets) / SubBuckets + 4;
+		const auto subBucket = (bucket - SubBuckets) % SubBuckets;
+		// the last bucket wraps around to UINT64_MAX, as it should
+		return ((SubBuckets + subBucket + 1) << (exponent - 4)) - 1;
+	}
+
+	[[nodiscard]] uint64_t Count(size_t bucket) const
+	{
+		return m_counts[bucket].Load();
+	}
+
+	[[nodiscard]] uint64_t Max() const
+	{
+		return m_max.load(std::memory_order_relaxed);
+	}
+private:
+	std::array<StatsCounter, Buckets> m_counts;
+	std::atomic<uint64_t> m_max = 0;
+};
+
+// the sum of several histograms (e.g. one per thread), taken when stats are read
+class HistogramSnapshot
+{
+public:
+	void Add(const HistogramCounters& histogram)
+	{
+		for (size_t bucket = 0; bucket < HistogramCounters::Buckets; ++bucket)
+		{
+			const auto count = histogram.Count(bucket);
+			m_counts[bucket] += count;
+			m_count += count;
+		}
+		m_max = std::max<uint64_t>(m_max, histogram.Max());
+	}
+
+	// the value "quantile" (e.g. 0.99) of the recorded values are less than or equal to, 0 if nothing has been recorded
+	[[nodiscard]] uint64_t ValueAt(double quantile) const
+	{
+		if (!m_count)
+		{
+			return 0;
+		}
+		const auto rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(m_count))), 1);
+		uint64_t seen = 0;
+		for (size_t bucket = 0; bucket < HistogramCounters::Buckets; ++bucket)
+		{
+			seen += m_counts[bucket];
+			if (seen >= rank)
+			{
+				// never beyond the maximum, the bucket might be wider than what it has seen
+				return std::min<uint64_t>(HistogramCounters::UpperBoundOf(bucket), m_max);
+			}
+		}
+		return m_max;
+	}
+
+	// "visit(upperBound, count)" for every non-empty bucket, from the lowest
+	template<typename Visit>
+	void ForEachBucket(Visit visit) const
+	{
+		for (size_t bucket = 0; bucket < HistogramCounters::Buckets; ++bucket)
+		{
+			if (m_counts[bucket])
+			{
+				visit(HistogramCounters::UpperBoundOf(bucket), m_counts[bucket]);
+			}
+		}
+	}
+
+	[[nodiscard]] uint64_t Count() const
+	{
+		return m_count;
+	}
+
+	[[nodiscard]] uint64_t Max() const
+	{
+		return m_max;
+	}
+private:
+	std::array<uint64_t, HistogramCounters::Buckets> m_counts{};
+	uint64_t m_count = 0;
+	uint64_t m_max = 0;
+};
+
+/* Messages and bytes published per topic, by a single writer. Topic ids are dense (see TopicRegistry), thus they index a segmented array:
+   a segment is allocated the first time one of its topics is counted and it never moves, so readers can walk it while it is written.
+*/
+class TopicCounters
+{
+public:
+	TopicCounters() = default;
+	TopicCounters(const TopicCounters&) = delete;
+	TopicCounters& operator=(const TopicCounters&) = delete;
+
+	~TopicCounters()
+	{
+		for (auto& segment : m_segments)
+		{
+			delete segment.load(std::memory_order_relaxed);
+		}
+	}
+
+	void Add(TopicId id, uint64_t bytes)
+	{
+		const auto index = id - 1;
+		auto& slot = m_segments[index / SegmentSize];
+		auto* segment = slot.load(std::memory_order_relaxed);
+		if (!segment)
+		{
+			segment = new Segment{};
+			slot.store(segment, std::memory_order_release);
+		}
+		auto& counters = (*segment)[index % SegmentSize];
+		counters.messages.Add(1);
+		counters.bytes.Add(bytes);
+	}
+
+	// "visit(id, messages, bytes)" for every topic counted so far
+	template<typename Visit>
+	void ForEach(Visit visit) const
+	{
+		for (size_t i = 0; i < MaxSegments; ++i)
+		{
+			const auto* segment = m_segments[i].load(std::memory_order_acquire);
+			if (!segment)
+			{
+				continue;
+			}
+			for (size_t j = 0; j < SegmentSize; ++j)
+			{
+				if (const auto messages = (*segment)[j].messages.Load())
+				{
+					visit(static_cast<TopicId>(i * SegmentSize + j + 1), messages, (*segment)[j].bytes.Load());
+				}
+			}
+		}
+	}
+private:
+	static constexpr size_t SegmentSize = 4096;
+	static constexpr size_t MaxSegments = 1024; // as many topics as TopicRegistry can hold
+
+	struct Counters
+	{
+		StatsCounter messages;
+		StatsCounter bytes;
+	};
+
+	using Segment = std::array<Counters, SegmentSize>;
+
+	std::array<std::atomic<Segment*>, MaxSegments> m_segments{};
+};
+
+/* A "Shard" per thread: a thread gets its own the first time it asks for it (see Local) and it is the only one writing to it,
+   while any thread can read them all (see ForEach). Shards live as long as this object, even if their threads have gone.
+   Local costs a thread_local lookup: only the first call on a thread (or switching between several PerThread of the same type) takes a lock.
+*/
+template<typename Shard>
+class PerThread
+{
+public:
+	PerThread() = default;
+	PerThread(const PerThread&) = delete;
+	PerThread& operator=(const PerThread&) = delete;
+
+	Shard& Local()
+	{
+		thread_local Cached cached;
+		if (cached.owner == m_id)
+		{
+			return *cached.shard;
+		}
+		std::lock_guard lock{ m_mutex };
+		auto& shard = m_shards[std::this_thread::get_id()];
+		if (!shard)
+		{
+			shard = std::make_unique<Shard>();
+		}
+		cached = { m_id, shard.get() };
+		return *shard;
+	}
+
+	// "visit(threadId, shard)"
+	template<typename Visit>
+	void ForEach(Visit visit) const
+	{
+		std::lock_guard lock{ m_mutex };
+		for (const auto& [thread, shard] : m_shards)
+		{
+			visit(thread, *shard);
+		}
+	}
+private:
+	struct Cached
+	{
+		uint64_t owner = 0;
+		Shard* shard = nullptr;
+	};
+
+	// ids are never reused, thus a cached shard can't belong to a PerThread that has gone
+	static inline std::atomic<uint64_t> NextId = 1;
+
+	const uint64_t m_id = NextId.fetch_add(1, std::memory_order_relaxed);
+	mutable std::mutex m_mutex;
+	std::unordered_map<std::thread::id, std::unique_ptr<Shard>> m_shards;
+};
+
+// what a thread of the broker counts: publishers count the topics, dispatcher threads their handling time and the delivery latency
+struct alignas(64) ThreadStats
+{
+	TopicCounters topics;
+	HistogramCounters latency;
+	StatsCounter events;
+	StatsCounter busyNanoseconds;
+	std::atomic<StatsClock::rep> firstEvent = 0; // since the epoch of the clock, 0 until the first event
+};
+
+/* Measures the handling of an event on the current thread: its busy time and, for a published message, the latency
+   from publishing to the end of the handling (that is when the message has been handed to the subscriber's stream).
+*/
+class HandlingTimer
+{
+public:
+	explicit HandlingTimer(ThreadStats& stats, std::optional<StatsClock::time_point> publishedAt = std::nullopt)
+		: m_stats(stats), m_start(StatsClock::now()), m_publishedAt(publishedAt)
+	{
+		if (!m_stats.firstEvent.load(std::memory_order_relaxed))
+		{
+			m_stats.firstEvent.store(m_start.time_since_epoch().count(), std::memory_order_relaxed);
+		}
+	}
+
+	HandlingTimer(const HandlingTimer&) = delete;
+	HandlingTimer& operator=(const HandlingTimer&) = delete;
+
+	~HandlingTimer()
+	{
+		const auto end = StatsClock::now();
+		m_stats.busyNanoseconds.Add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_start).count()));
+		m_stats.events.Add(1);
+		if (m_publishedAt)
+		{
+			m_stats.latency.Record(end - *m_publishedAt);
+		}
+	}
+private:
+	ThreadStats& m_stats;
+	StatsClock::time_point m_start;
+	std::optional<StatsClock::time_point> m_publishedAt;
+};
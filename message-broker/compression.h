@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <zlib.h>
+
+/* Raw deflate (RFC 1951), optionally with a preset dictionary: small messages have little to compress on their own,
+   but they look like the previous messages of their topic, thus a dictionary made of those gets them compressed too (see TopicDictionary).
+   Initializing a deflate state allocates about 256KB, thus every thread keeps one and resets it between messages.
+   Nothing if zlib fails (the caller just keeps the data as it is).
+*/
+inline std::optional<std::string> Deflate(std::string_view data, std::string_view dictionary = {})
+{
+	struct Deflater
+	{
+		Deflater()
+		{
+			ok = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+		}
+
+		~Deflater()
+		{
+			if (ok)
+			{
+				deflateEnd(&stream);
+			}
+		}
+
+		z_stream stream{};
+		bool ok = false;
+	};
+	thread_local Deflater deflater;
+	if (!deflater.ok || deflateReset(&deflater.stream) != Z_OK)
+	{
+		return std::nullopt;
+	}
+	auto& stream = deflater.stream;
+	if (!dictionary.empty() && deflateSetDictionary(&stream, reinterpret_cast<const Bytef*>(dictionary.data()), static_cast<uInt>(dictionary.size())) != Z_OK)
+	{
+		return std::nullopt;
+	}
+	std::string deflated(deflateBound(&stream, static_cast<uLong>(data.size())), '\0');
+	stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+	stream.avail_in = static_cast<uInt>(data.size());
+	stream.next_out = reinterpret_cast<Bytef*>(deflated.data());
+	stream.avail_out = static_cast<uInt>(deflated.size());
+	if (deflate(&stream, Z_FINISH) != Z_STREAM_END)
+	{
+		return std::nullopt;
+	}
+	deflated.resize(stream.total_out);
+	return deflated;
+}
+
+// the other way around, with the same dictionary. Throws on corrupted data
+inline std::string Inflate(std::string_view data, std::string_view dictionary = {})
+{
+	z_stream stream{};
+	if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+	{
+		throw std::runtime_error("Can't initialize inflate");
+	}
+	// raw inflate takes the dictionary upfront
+	if (!dictionary.empty() && inflateSetDictionary(&stream, reinterpret_cast<const Bytef*>(dictionary.data()), static_cast<uInt>(dictionary.size())) != Z_OK)
+	{
+		inflateEnd(&stream);
+		throw std::runtime_error("Can't set the inflate dictionary");
+	}
+	std::string inflated(data.size() * 4 + 64, '\0');
+	stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+	stream.avail_in = static_cast<uInt>(data.size());
+	auto result = Z_OK;
+	while (result == Z_OK)
+	{
+		if (stream.total_out == inflated.size())
+		{
+			inflated.resize(inflated.size() * 2);
+		}
+		stream.next_out = reinterpret_cast<Bytef*>(inflated.data() + stream.total_out);
+		stream.avail_out = static_cast<uInt>(inflated.size() - stream.total_out);
+		result = inflate(&stream, Z_FINISH);
+		if (result == Z_BUF_ERROR && stream.avail_out == 0)
+		{
+			result = Z_OK; // just out of room
+		}
+	}
+	inflated.resize(stream.total_out);
+	inflateEnd(&stream);
+	if (result != Z_STREAM_END)
+	{
+		throw std::runtime_error("Can't inflate: corrupted data");
+	}
+	return inflated;
+}
+
+/* The dictionary of a topic, learned from its first messages (the ones compressed for subscribers): once it has "capacity" bytes
+   or it has seen "maxSamples" messages, it is frozen and it never changes. Thus subscribers fetch it once, by its id.
+   Until then, messages are compressed without a dictionary. Learning takes a lock, using the frozen dictionary does not.
+*/
+class TopicDictionary
+{
+public:
+	static constexpr size_t MaxSamples = 256;
+
+	explicit TopicDictionary(size_t capacity)
+		: m_capacity(capacity)
+	{
+	}
+
+	// does nothing once the dictionary is frozen (or if dictionaries are off, that is when the capacity is 0)
+	void Learn(std::string_view content)
+	{
+		if (!m_capacity || Get())
+		{
+			return;
+		}
+		std::lock_guard lock{ m_mutex };
+		if (m_frozen.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+		m_data.append(content.substr(0, m_capacity - m_data.size()));
+		if (m_data.size() >= m_capacity || ++m_samples >= MaxSamples)
+		{
+			// the id is a checksum: dictionaries learned by another run of the broker get other ids
+			m_id = static_cast<uint32_t>(crc32(0, reinterpret_cast<const Bytef*>(m_data.data()), static_cast<uInt>(m_data.size()))) | 1;
+			m_frozen.store(true, std::memory_order_release);
+		}
+	}
+
+	// null until the dictionary is frozen
+	[[nodiscard]] const std::string* Get() const
+	{
+		return m_frozen.load(std::memory_order_acquire) ? &m_data : nullptr;
+	}
+
+	// never 0, meaningful only once the dictionary is frozen
+	[[nodiscard]] uint32_t Id() const
+	{
+		return m_id;
+	}
+private:
+	size_t m_capacity;
+	std::mutex m_mutex;
+	std::atomic<bool> m_frozen = false;
+	std::string m_data;
+	size_t m_samples = 0;
+	uint32_t m_id = 0;
+};
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// how a consumer group splits the messages of a topic between its members (messages with a key always go to the same member, see ConsumerGroup)
+enum class GroupBalancing
+{
+	round_robin,
+	least_outstanding, // the member with the fewest messages not yet written to its client
+};
+
+// 0 means "no key"
+inline uint64_t KeyHashOf(std::string_view key)
+{
+	return key.empty() ? 0 : std::hash<std::string_view>{}(key) | 1;
+}
+
+/* The members of a consumer group subscribed to a topic: every message goes to one of them only.
+   Messages with a key go to the member chosen by rendezvous hashing on the key, so a key sticks to the same member as long as it is in the group
+   and only the keys of a member joining or leaving move. The others are balanced according to GroupBalancing.
+   When the group has no members, messages are kept (up to "maxBacklog", then the oldest are dropped) and handed to the next member joining.
+   "Member" must provide "size_t Outstanding() const" (used only by least_outstanding).
+*/
+template<typename Member, typename Item>
+class ConsumerGroup
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	ConsumerGroup(GroupBalancing balancing, size_t maxBacklog)
+		: m_balancing(balancing), m_maxBacklog(maxBacklog)
+	{
+	}
+
+	// the backlog (if any) is delivered right away
+	template<typename Deliver>
+	void Join(uint64_t memberId, Member member, Deliver deliver)
+	{
+		std::lock_guard lock{ m_mutex };
+		m_members.emplace_back(memberId, std::move(member));
+		while (!m_backlog.empty())
+		{
+			const auto& [keyHash, item] = m_backlog.front();
+			deliver(Pick(keyHash), item);
+			m_backlog.pop_front();
+		}
+	}
+
+	// once this returns, the member does not get anything else
+	void Leave(uint64_t memberId, Clock::time_point now = Clock::now())
+	{
+		std::lock_guard lock{ m_mutex };
+		if (std::erase_if(m_members, [=](const auto& member) { return member.first == memberId; }) && m_members.empty())
+		{
+			m_emptySince = now;
+		}
+	}
+
+	// true if the group has had no members for "ttl" at least
+	[[nodiscard]] bool EmptyFor(std::chrono::milliseconds ttl, Clock::time_point now) const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_members.empty() && now - m_emptySince >= ttl;
+	}
+
+	template<typename Deliver>
+	void Dispatch(uint64_t keyHash, const Item& item, Deliver deliver)
+	{
+		std::lock_guard lock{ m_mutex };
+		if (m_members.empty())
+		{
+			if (m_backlog.size() == m_maxBacklog)
+			{
+				m_backlog.pop_front();
+			}
+			m_backlog.emplace_back(keyHash, item);
+			return;
+		}
+		deliver(Pick(keyHash), item);
+	}
+
+	[[nodiscard]] size_t Members() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_members.size();
+	}
+
+	[[nodiscard]] size_t Backlog() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_backlog.size();
+	}
+private:
+	// splitmix64 finalizer
+	static uint64_t Mix(uint64_t value)
+	{
+		value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+		return value ^ (value >> 31);
+	}
+
+	const Member& Pick(uint64_t keyHash)
+	{
+		auto best = begin(m_members);
+		if (keyHash)
+		{
+			for (auto it = next(best); it != end(m_members); ++it)
+			{
+				if (Mix(keyHash ^ it->first) > Mix(keyHash ^ best->first))
+				{
+					best = it;
+				}
+			}
+		}
+		else if (m_balancing == GroupBalancing::least_outstanding)
+		{
+			auto fewest = best->second.Outstanding();
+			for (auto it = next(best); it != end(m_members) && fewest; ++it)
+			{
+				if (const auto outstanding = it->second.Outstanding(); outstanding < fewest)
+				{
+					best = it;
+					fewest = outstanding;
+				}
+			}
+		}
+		else
+		{
+			best += static_cast<std::ptrdiff_t>(m_next++ % m_members.size());
+		}
+		return best->second;
+	}
+
+	GroupBalancing m_balancing;
+	size_t m_maxBacklog;
+	mutable std::mutex m_mutex;
+	std::vector<std::pair<uint64_t, Member>> m_members;
+	std::deque<std::pair<uint64_t, Item>> m_backlog;
+	size_t m_next = 0;
+	Clock::time_point m_emptySince = Clock::now(); // groups are created empty
+};
+
+/* The consumer groups subscribed to a topic, by name. Groups are created by their first member.
+   A group without members keeps its backlog for the next member for "ttl", then it expires: it is removed once no former member holds it anymore
+   (that is, after the members that left have handed their pending messages back) and when a new group is created (no timers needed).
+   Also, a topic has "maxGroups" groups at most, thus group names chosen by clients can't take an unbounded amount of memory.
+*/
+template<typename Member, typename Item>
+class ConsumerGroups
+{
+public:
+	using Group = ConsumerGroup<Member, Item>;
+	using Clock = typename Group::Clock;
+
+	static constexpr std::chrono::milliseconds DefaultTtl = std::chrono::minutes(1);
+	static constexpr size_t DefaultMaxGroups = 1024;
+
+	explicit ConsumerGroups(std::chrono::milliseconds ttl = DefaultTtl, size_t maxGroups = DefaultMaxGroups)
+		: m_ttl(ttl), m_maxGroups(maxGroups)
+	{
+	}
+
+	// the balancing is decided by the member creating the group. Throws std::length_error if the topic has too many groups
+	std::shared_ptr<Group> Get(const std::string& name, GroupBalancing balancing, size_t maxBacklog, Clock::time_point now = Clock::now())
+	{
+		std::unique_lock lock{ m_mutex };
+		if (const auto it = m_groups.find(name); it != end(m_groups))
+		{
+			return it->second;
+		}
+		// publishers hold the shared lock while dispatching, thus only former members might hold a group besides this map
+		std::erase_if(m_groups, [&](const auto& group) {
+			return group.second.use_count() == 1 && group.second->EmptyFor(m_ttl, now);
+		});
+		if (m_groups.size() >= m_maxGroups)
+		{
+			m_count.store(m_groups.size(), std::memory_order_relaxed);
+			throw std::length_error("Too many consumer groups");
+		}
+		auto& group = m_groups[name];
+		group = std::make_shared<Group>(balancing, maxBacklog);
+		m_count.store(m_groups.size(), std::memory_order_relaxed);
+		return group;
+	}
+
+	// every group gets the item once
+	template<typename Deliver>
+	void Dispatch(uint64_t keyHash, const Item& item, Deliver deliver) const
+	{
+		// no groups at all is the common case, it costs nothing
+		if (!m_count.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+		std::shared_lock lock{ m_mutex };
+		for (const auto& [_, group] : m_groups)
+		{
+			group->Dispatch(keyHash, item, deliver);
+		}
+	}
+
+	[[nodiscard]] size_t Size() const
+	{
+		return m_count.load(std::memory_order_relaxed);
+	}
+private:
+	std::chrono::milliseconds m_ttl;
+	size_t m_maxGroups;
+	mutable std::shared_mutex m_mutex;
+	std::map<std::string, std::shared_ptr<Group>> m_groups;
+	std::atomic<size_t> m_count = 0;
+};
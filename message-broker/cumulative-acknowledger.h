@@ -0,0 +1,210 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/* A single thread for the windows of all the CumulativeAcknowledgers of the broker, instead of a thread per "Publish" stream.
+   Every owner has one deadline at most: "expire" runs on the thread of the timer once the deadline has come, unless it is cancelled before.
+*/
+class AckWindowTimer
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	AckWindowTimer()
+		: m_thread([this] { Run(); })
+	{
+	}
+
+	AckWindowTimer(const AckWindowTimer&) = delete;
+	AckWindowTimer& operator=(const AckWindowTimer&) = delete;
+
+	~AckWindowTimer()
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+			m_stopped = true;
+		}
+		m_wakeUp.notify_one();
+		m_thread.join();
+	}
+
+	// replaces the deadline of "owner", if any
+	void Schedule(const void* owner, Clock::time_point deadline, std::function<void()> expire)
+	{
+		{
+			std::lock_guard lock{ m_mutex };
+			Remove(owner);
+			m_owners[owner] = m_deadlines.emplace(deadline, Deadline{ owner, std::move(expire) });
+		}
+		m_wakeUp.notify_one();
+	}
+
+	// once this returns, "expire" of the owner is not running and it won't run (it must not be called by "expire" itself)
+	void Cancel(const void* owner)
+	{
+		std::unique_lock lock{ m_mutex };
+		Remove(owner);
+		m_done.wait(lock, [&] { return m_running != owner; });
+	}
+private:
+	struct Deadline
+	{
+		const void* owner;
+		std::function<void()> expire;
+	};
+	using Deadlines = std::multimap<Clock::time_point, Deadline>;
+
+	// under m_mutex
+	void Remove(const void* owner)
+	{
+		if (const auto it = m_owners.find(owner); it != end(m_owners))
+		{
+			m_deadlines.erase(it->second);
+			m_owners.erase(it);
+		}
+	}
+
+	void Run()
+	{
+		std::unique_lock lock{ m_mutex };
+		while (!m_stopped)
+		{
+			if (m_deadlines.empty())
+			{
+				m_wakeUp.wait(lock);
+				continue;
+			}
+			const auto next = begin(m_deadlines);
+			if (Clock::now() < next->first)
+			{
+				m_wakeUp.wait_until(lock, next->first);
+				continue;
+			}
+			auto [owner, expire] = std::move(next->second);
+			m_owners.erase(owner);
+			m_deadlines.erase(next);
+			m_running = owner;
+			lock.unlock();
+			expire();
+			lock.lock();
+			m_running = nullptr;
+			m_done.notify_all();
+		}
+	}
+
+	std::mutex m_mutex;
+	std::condition_variable m_wakeUp;
+	std::condition_variable m_done;
+	Deadlines m_deadlines;
+	std::map<const void*, Deadlines::iterator> m_owners;
+	const void* m_running = nullptr;
+	bool m_stopped = false;
+	std::thread m_thread; // last, it starts in the constructor
+};
+
+/* Acknowledges the messages accepted on a "Publish" stream, cumulatively: an ack tells how many messages have been accepted so far.
+   An ack is written every "every" messages or, when fewer are pending, once "window" is over. Thus, a producer never waits for
+   a single message to be acknowledged and it can keep as many messages in flight as it likes.
+   Every N messages, the ack is handed to "write" by the thread calling Accepted (that is, the reading thread, between two reads).
+   When the window is over, it is handed by the thread of AckWindowTimer, thus an idle stream holds no threads.
+   "write" is called under the lock of the acknowledger and the timer is shared by all the streams, thus it must not block (see PublishReactor).
+*/
+class CumulativeAcknowledger
+{
+public:
+	using Clock = AckWindowTimer::Clock;
+
+	// "write" gets the number of messages accepted so far (it starts writing the ack, it does not wait), it returns false if the stream is broken
+	CumulativeAcknowledger(uint64_t every, std::chrono::milliseconds window, std::function<bool(uint64_t)> write, AckWindowTimer& timer)
+		: m_every(every ? every : 1), m_window(window), m_write(std::move(write)), m_timer(timer)
+	{
+	}
+
+	CumulativeAcknowledger(const CumulativeAcknowledger&) = delete;
+	CumulativeAcknowledger& operator=(const CumulativeAcknowledger&) = delete;
+
+	~CumulativeAcknowledger()
+	{
+		Finish();
+	}
+
+	void Accepted(uint64_t messages)
+	{
+		std::lock_guard lock{ m_mutex };
+		if (m_finished || m_broken)
+		{
+			return;
+		}
+		const auto idle = m_accepted == m_acknowledged;
+		m_accepted += messages;
+		if (m_accepted - m_acknowledged >= m_every)
+		{
+			WritePending();
+		}
+		else if (idle)
+		{
+			// the window starts with the first message not acknowledged
+			m_timer.Schedule(this, Clock::now() + m_window, [this] { WindowOver(); });
+		}
+	}
+
+	// acknowledges what is still pending and stops writing (idempotent)
+	void Finish()
+	{
+		// not under the lock: the window might be over right now, and it takes the lock
+		m_timer.Cancel(this);
+		std::lock_guard lock{ m_mutex };
+		if (std::exchange(m_finished, true) || m_broken)
+		{
+			return;
+		}
+		WritePending();
+	}
+
+	[[nodiscard]] uint64_t Acknowledged() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_acknowledged;
+	}
+private:
+	void WindowOver()
+	{
+		std::lock_guard lock{ m_mutex };
+		if (!m_finished && !m_broken)
+		{
+			WritePending();
+		}
+	}
+
+	// under m_mutex
+	void WritePending()
+	{
+		if (m_accepted == m_acknowledged)
+		{
+			return;
+		}
+		if (!m_write(m_accepted))
+		{
+			m_broken = true;
+			return;
+		}
+		m_acknowledged = m_accepted;
+	}
+
+	uint64_t m_every;
+	std::chrono::milliseconds m_window;
+	std::function<bool(uint64_t)> m_write;
+	AckWindowTimer& m_timer;
+	mutable std::mutex m_mutex;
+	uint64_t m_accepted = 0;
+	uint64_t m_acknowledged = 0;
+	bool m_finished = false;
+	bool m_broken = false;
+};
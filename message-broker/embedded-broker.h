@@ -0,0 +1,101 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <so_5/all.hpp>
+#include "../generated/broker.grpc.pb.h"
+#include "broker-options.h"
+
+// what in-process subscribers get: the very message an in-process publisher has moved in, shared by all of them
+struct LocalMessage final : public so_5::message_t
+{
+	explicit LocalMessage(Message m)
+		: message(std::move(m))
+	{
+	}
+
+	Message message;
+};
+
+// in-process subscribers get every message on a thread of the broker, one at a time
+using LocalHandler = std::function<void(const Message&)>;
+
+// shared by an in-process subscription and its subscriber: the coop is deregistered asynchronously, meanwhile the handler is not called anymore
+struct LocalHandlerGuard
+{
+	std::mutex mutex;
+	bool active = true;
+};
+
+class ServiceImpl;
+
+/* An in-process subscription (see EmbeddedBroker::Subscribe): it lasts as long as this handle does, which must not outlive its broker.
+   Once the handle has gone, the handler is not called anymore (a call in progress is waited for, thus the handler must not destroy its own handle)
+*/
+class EmbeddedSubscription
+{
+public:
+	EmbeddedSubscription(so_5::environment_t& environment, so_5::coop_handle_t coop, std::shared_ptr<LocalHandlerGuard> guard)
+		: m_environment(&environment), m_coop(std::move(coop)), m_guard(std::move(guard))
+	{
+	}
+
+	EmbeddedSubscription(EmbeddedSubscription&& other) noexcept
+		: m_environment(std::exchange(other.m_environment, nullptr)), m_coop(std::move(other.m_coop)), m_guard(std::move(other.m_guard))
+	{
+	}
+
+	EmbeddedSubscription& operator=(EmbeddedSubscription&&) = delete;
+
+	~EmbeddedSubscription()
+	{
+		if (m_environment)
+		{
+			{
+				std::lock_guard lock{ m_guard->mutex };
+				m_guard->active = false;
+			}
+			m_environment->deregister_coop(m_coop, so_5::dereg_reason::normal);
+		}
+	}
+private:
+	so_5::environment_t* m_environment;
+	so_5::coop_handle_t m_coop;
+	std::shared_ptr<LocalHandlerGuard> m_guard;
+};
+
+/* The broker core (topic registry, fan-out, SObjectizer environment) as a library, for producers and consumers living in the same process.
+   In-process publishers move their messages in and in-process subscribers get them as they are: no HTTP/2, no protobuf encoding, no copies.
+   Messages are encoded only when something out of process might need them (gRPC subscribers, logs, retained values, patterns or consumer groups),
+   while in-process subscribers get the messages sent through gRPC as well.
+   The gRPC service is just an adapter over the same core (see Service), that's how message-broker itself runs.
+*/
+class EmbeddedBroker
+{
+public:
+	explicit EmbeddedBroker(const BrokerOptions& options);
+	EmbeddedBroker(const EmbeddedBroker&) = delete;
+	EmbeddedBroker& operator=(const EmbeddedBroker&) = delete;
+	~EmbeddedBroker();
+
+	// to be registered to a grpc::ServerBuilder, if the broker is also served out of process
+	MessageBroker::Service& Service();
+	so_5::environment_t& Environment();
+
+	// as "Send" of one message (the topic by name or by id), from any thread. RESOURCE_EXHAUSTED if the topic is new and there's no room for it
+	grpc::Status Publish(Message message);
+	// "handler" gets every message of the topics until the subscription goes away (a partitioned topic stands for all its partitions).
+	// Throws std::invalid_argument on patterns, which are for gRPC subscribers only, and std::length_error if there's no room for new topics
+	[[nodiscard]] EmbeddedSubscription Subscribe(const std::vector<std::string>& topics, LocalHandler handler);
+
+	// pending events are handled first, then agents and subscribers are gone (the service must not be called anymore)
+	void Stop();
+private:
+	so_5::wrapped_env_t m_env;
+	ServiceImpl* m_service = nullptr; // owned by its cooperation
+	bool m_stopped = false;
+};
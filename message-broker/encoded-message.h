@@ -0,0 +1,170 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include "../generated/broker.pb.h"
+#include "compression.h"
+#include "message-filter.h"
+
+/* A published message, already encoded as the ReceiveResponse every subscriber will get.
+   The broker serializes each message once (in "Send") and then shares the very same frame with all the subscribers of its topic:
+   grpc::ByteBuffer is a list of ref-counted slices, thus copying it (and writing it to many streams) just bumps a reference count.
+   Also, SObjectizer delivers the same message instance to every subscriber of an mbox, so the frame is never duplicated along the way.
+*/
+struct EncodedMessage
+{
+	grpc::ByteBuffer frame;
+	uint64_t topicId = 0;
+	uint64_t offset = 0; // the position in the topic log, if the topic is logged (see TopicLog)
+	uint64_t keyHash = 0; // the hash of Message.key, 0 if there is no key (see ConsumerGroup)
+	std::chrono::steady_clock::time_point publishedAt; // when it has been sent to subscribers, to measure the delivery latency (the epoch if unknown)
+	bool bridged = false; // republished from another broker, never forwarded to federation peers (see FederationLink)
+	FilterResults filters; // the filters of the topic, evaluated once by the publisher for all the subscribers (see TopicFilters)
+	// the frame with a compressed content, made by the first subscriber asking for it and shared with the others (see Compressed)
+	mutable std::once_flag compressOnce;
+	mutable grpc::ByteBuffer compressed;
+
+	// "compress(frame)" runs once, no matter how many subscribers (on how many threads) ask for the compressed frame
+	template<typename Compress>
+	const grpc::ByteBuffer& Compressed(Compress compress) const
+	{
+		std::call_once(compressOnce, [&] {
+			compressed = compress(frame);
+		});
+		return compressed;
+	}
+};
+
+// the topic is resolved by the broker, thus subscribers get both the name and the id, no matter which one the publisher used
+// the offset is set only if the topic is logged
+// the message is completed in place and the response just wraps it: the content is not copied, the frame is its only copy
+inline grpc::ByteBuffer EncodeReceiveResponse(Message& message, std::string_view topic, uint64_t topicId, std::optional<uint64_t> offset = std::nullopt)
+{
+	if (message.topic() != topic)
+	{
+		message.set_topic(topic.data(), topic.size());
+	}
+	message.set_topic_id(topicId);
+	if (offset)
+	{
+		message.set_offset(*offset);
+	}
+	else
+	{
+		message.clear_offset();
+	}
+	// "unsafe" since the response does not own the message: it is released before the response goes away
+	ReceiveResponse response;
+	response.unsafe_arena_set_allocated_message(&message);
+	grpc::ByteBuffer frame;
+	bool ownBuffer = false;
+	const auto status = grpc::SerializationTraits<ReceiveResponse>::Serialize(response, &frame, &ownBuffer);
+	response.unsafe_arena_release_message();
+	if (!status.ok())
+	{
+		throw std::runtime_error("Can't encode a ReceiveResponse: " + status.error_message());
+	}
+	return frame;
+}
+
+// replayed and retained frames have no filter results (see EncodedMessage::filters), they are decoded to be filtered
+inline bool FrameMatches(const grpc::ByteBuffer& frame, const MessageFilter& filter)
+{
+	auto buffer = frame; // deserializing consumes the buffer
+	ReceiveResponse response;
+	return grpc::SerializationTraits<ReceiveResponse>::Deserialize(&buffer, &response).ok() && filter.Matches(response.message());
+}
+
+/* Compressed delivery (see ReceiveRequest.compression): the same frame, with Message.deflated instead of Message.content.
+   The dictionary of the topic is used as soon as it is ready, meanwhile the content helps to make it (see TopicDictionary).
+   The frame is returned as it is if compressing does not make it smaller (e.g. tiny or random contents).
+*/
+inline grpc::ByteBuffer DeflateFrame(const grpc::ByteBuffer& frame, TopicDictionary& dictionary)
+{
+	auto buffer = frame; // deserializing consumes the buffer
+	ReceiveResponse response;
+	if (!grpc::SerializationTraits<ReceiveResponse>::Deserialize(&buffer, &response).ok() || !response.has_message())
+	{
+		return frame;
+	}
+	auto& message = *response.mutable_message();
+	const auto* words = dictionary.Get();
+	dictionary.Learn(message.content());
+	auto deflated = Deflate(message.content(), words ? std::string_view{ *words } : std::string_view{});
+	if (!deflated || deflated->size() >= message.content().size())
+	{
+		return frame;
+	}
+	message.clear_content();
+	message.set_deflated(std::move(*deflated));
+	message.set_dictionary(words ? dictionary.Id() : 0);
+	grpc::ByteBuffer compressed;
+	bool ownBuffer = false;
+	if (!grpc::SerializationTraits<ReceiveResponse>::Serialize(response, &compressed, &ownBuffer).ok())
+	{
+		return frame;
+	}
+	return compressed;
+}
+
+/* Batched delivery packs several messages into the "messages" field of a single ReceiveResponse.
+   On the wire, a ReceiveResponse with only "message" (field 1) set is exactly one entry of "messages" (field 2), except for the field tag.
+   Thus, a batch is just the concatenation of the frames of its messages, each one with the first byte (the tag) patched:
+   no encoding and no copies of the payloads, the new frame references the very same slices.
+*/
+inline grpc::ByteBuffer EncodeBatch(std::span<const grpc::ByteBuffer> frames)
+{
+	static constexpr char batchEntryTag = (ReceiveResponse::kMessagesFieldNumber << 3) | 2; // 2 = length-delimited
+	static const grpc::Slice batchEntryTagSlice{ &batchEntryTag, 1, grpc::Slice::STATIC_SLICE };
+
+	std::vector<grpc::Slice> batch;
+	std::vector<grpc::Slice> frameSlices;
+	for (const auto& frame : frames)
+	{
+		frameSlices.clear();
+		frame.Dump(&frameSlices);
+		batch.push_back(batchEntryTagSlice);
+		bool skipTag = true;
+		for (const auto& slice : frameSlices)
+		{
+			if (skipTag && slice.size())
+			{
+				batch.push_back(slice.sub(1, slice.size()));
+				skipTag = false;
+			}
+			else
+			{
+				batch.push_back(slice);
+			}
+		}
+	}
+	return grpc::ByteBuffer(batch.data(), batch.size());
+}
+
+/* Acknowledged delivery: a frame numbered for a certain subscriber (see ReceiveResponse.sequence).
+   The fields of a protobuf message can be appended to its encoding, thus the sequence number is just one more slice after the shared frame,
+   which is neither encoded again nor copied.
+*/
+inline grpc::ByteBuffer WithSequence(const grpc::ByteBuffer& frame, uint64_t sequence)
+{
+	uint8_t field[1 + 10]; // the tag and a varint of 64 bits at most
+	size_t size = 0;
+	field[size++] = ReceiveResponse::kSequenceFieldNumber << 3; // 0 = varint
+	do
+	{
+		field[size++] = static_cast<uint8_t>((sequence & 0x7F) | (sequence > 0x7F ? 0x80 : 0));
+		sequence >>= 7;
+	} while (sequence);
+
+	std::vector<grpc::Slice> slices;
+	frame.Dump(&slices);
+	slices.emplace_back(field, size);
+	return grpc::ByteBuffer(slices.data(), slices.size());
+}
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <spdlog/spdlog.h>
+#include <grpcpp/grpcpp.h>
+#include "../generated/broker.grpc.pb.h"
+#include "topic-interest.h"
+
+// how a link gets messages from its remote broker (see BrokerOptions::federate)
+struct FederationSettings
+{
+	size_t maxBatch = 256;
+	std::chrono::microseconds linger{ 1000 };
+};
+
+/* A federation link bridges the topics of a remote broker into this one: it is a "Subscribe" stream to the remote broker,
+   on the topics (and patterns) this broker's subscribers are interested in (see InterestTable), and every message it gets is republished here.
+   - Interest propagation: the link subscribes a remote topic when the first local subscriber comes and unsubscribes it when the last one goes.
+   - Loop prevention: the link asks as a peer (see ReceiveRequest.federation_peer), thus it gets only the messages published to the remote broker,
+     never the ones the remote broker got from other brokers. Also, messages whose origin is this very broker are dropped, just in case.
+     Thus, messages cross one link at most: every broker is meant to link to every other broker it wants messages from.
+   - Batched forwarding: the remote broker batches messages for the link (see ReceiveRequest.max_batch), they are republished one batch at a time.
+   The stream is read on a thread of the link, interest changes are written by another one while the stream is up.
+   If the remote broker is down or it goes away, the link connects again (with a backoff) and subscribes all the current interests.
+*/
+class FederationLink
+{
+public:
+	// what the link republishes: messages have their "topic" and "origin", nothing else is set by the remote broker
+	using Republish = std::function<void(SendRequest&)>;
+
+	FederationLink(std::string address, std::string brokerId, FederationSettings settings, std::shared_ptr<InterestTable> interest, Republish republish)
+		: m_address(std::move(address)), m_brokerId(std::move(brokerId)), m_settings(settings), m_interest(std::move(interest)), m_republish(std::move(republish)),
+		  m_stub(MessageBroker::NewStub(grpc::CreateChannel(m_address, grpc::InsecureChannelCredentials())))
+	{
+		m_listener = m_interest->Listen([this](const std::string& topic, bool interested) {
+			std::lock_guard lock{ m_mutex };
+			if (interested)
+			{
+				m_topics.insert(topic);
+			}
+			else
+			{
+				m_topics.erase(topic);
+			}
+			m_wakeUp.notify_all();
+		});
+		m_reader = std::thread([this] { Run(); });
+	}
+
+	FederationLink(const FederationLink&) = delete;
+	FederationLink& operator=(const FederationLink&) = delete;
+
+	~FederationLink()
+	{
+		m_interest->StopListening(m_listener);
+		{
+			std::lock_guard lock{ m_mutex };
+			m_stopping = true;
+			if (m_context)
+			{
+				m_context->TryCancel();
+			}
+			m_wakeUp.notify_all();
+		}
+		m_reader.join();
+	}
+private:
+	using Stream = grpc::ClientReaderWriter<SubscribeRequest, ReceiveResponse>;
+
+	static constexpr std::chrono::milliseconds MinBackoff{ 100 };
+	static constexpr std::chrono::milliseconds MaxBackoff{ 5000 };
+
+	void Run()
+	{
+		auto backoff = MinBackoff;
+		while (true)
+		{
+			grpc::ClientContext context;
+			{
+				std::lock_guard lock{ m_mutex };
+				if (m_stopping)
+				{
+					return;
+				}
+				m_context = &context;
+			}
+			const auto stream = m_stub->Subscribe(&context);
+			if (Connect(*stream))
+			{
+				std::thread writer([&] { WriteChanges(*stream); });
+				if (ReadMessages(*stream))
+				{
+					backoff = MinBackoff;
+				}
+				{
+					std::lock_guard lock{ m_mutex };
+					m_connected = false;
+					m_wakeUp.notify_all();
+				}
+				context.TryCancel(); // the writer might be blocked on a write
+				writer.join();
+			}
+			const auto status = stream->Finish();
+			std::unique_lock lock{ m_mutex };
+			m_context = nullptr;
+			if (m_stopping)
+			{
+				return;
+			}
+			spdlog::warn("Federation link to '{}' is down ({}), connecting again in {}ms", m_address, status.error_message(), backoff.count());
+			m_wakeUp.wait_for(lock, backoff, [this] { return m_stopping; });
+			backoff = std::min<std::chrono::milliseconds>(backoff * 2, MaxBackoff);
+		}
+	}
+
+	// the first request tells how messages are delivered and it subscribes all the current interests
+	bool Connect(Stream& stream)
+	{
+		SubscribeRequest request;
+		auto& delivery = *request.mutable_delivery();
+		delivery.set_max_batch(static_cast<uint32_t>(m_settings.maxBatch));
+		delivery.set_linger_us(static_cast<uint32_t>(m_settings.linger.count()));
+		delivery.set_federation_peer(m_brokerId);
+		{
+			std::lock_guard lock{ m_mutex };
+			for (const auto& topic : m_topics)
+			{
+				request.add_subscribe(topic);
+			}
+			m_subscribed = m_topics;
+			m_connected = true;
+		}
+		if (!stream.Write(request))
+		{
+			std::lock_guard lock{ m_mutex };
+			m_connected = false;
+			return false;
+		}
+		spdlog::info("Federation link to '{}' is up, {} topics subscribed", m_address, request.subscribe().size());
+		return true;
+	}
+
+	// what is written is the difference between what is subscribed and the current interests: a topic that comes and goes in the meantime is not written at all
+	void WriteChanges(Stream& stream)
+	{
+		std::unique_lock lock{ m_mutex };
+		while (true)
+		{
+			m_wakeUp.wait(lock, [this] {
+				return !m_connected || m_subscribed != m_topics;
+			});
+			if (!m_connected)
+			{
+				return;
+			}
+			SubscribeRequest request;
+			std::ranges::set_difference(m_topics, m_subscribed, google::protobuf::RepeatedFieldBackInserter(request.mutable_subscribe()));
+			std::ranges::set_difference(m_subscribed, m_topics, google::protobuf::RepeatedFieldBackInserter(request.mutable_unsubscribe()));
+			m_subscribed = m_topics;
+			lock.unlock();
+			const auto written = stream.Write(request);
+			lock.lock();
+			if (!written)
+			{
+				return;
+			}
+		}
+	}
+
+	// true if something has been read (that is, the link has been up for a while)
+	bool ReadMessages(Stream& stream)
+	{
+		ReceiveResponse response;
+		SendRequest request;
+		bool read = false;
+		while (stream.Read(&response))
+		{
+			read = true;
+			request.clear_messages();
+			if (response.has_message())
+			{
+				Add(request, *response.mutable_message());
+			}
+			for (auto& message : *response.mutable_messages())
+			{
+				Add(request, message);
+			}
+			if (!request.messages().empty())
+			{
+				m_republish(request);
+			}
+		}
+		return read;
+	}
+
+	// ids and offsets belong to the remote broker, the topic is republished by name
+	void Add(SendRequest& request, Message& message)
+	{
+		if (message.origin() == m_brokerId)
+		{
+			return;
+		}
+		message.clear_topic_id();
+		message.clear_offset();
+		request.add_messages()->Swap(&message);
+	}
+
+	std::string m_address;
+	std::string m_brokerId;
+	FederationSettings m_settings;
+	std::shared_ptr<InterestTable> m_interest;
+	Republish m_republish;
+	std::unique_ptr<MessageBroker::Stub> m_stub;
+	uint64_t m_listener = 0;
+	std::mutex m_mutex;
+	std::condition_variable m_wakeUp;
+	std::set<std::string> m_topics; // the current interests
+	std::set<std::string> m_subscribed; // what has been written to the remote broker
+	bool m_connected = false;
+	bool m_stopping = false;
+	grpc::ClientContext* m_context = nullptr; // to cancel the stream when stopping
+	std::thread m_reader;
+};
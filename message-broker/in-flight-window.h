@@ -0,0 +1,202 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+/* Acknowledged (at-least-once) delivery: the items delivered to a subscriber and not acknowledged yet.
+   Every delivery gets the next sequence number and acks are cumulative (acknowledging N acknowledges everything up to N).
+   At most "capacity" deliveries are in flight, the next ones wait (up to "maxWaiting") for acks to make room: thus the subscriber
+   pays a round trip per window, not per item. Deliveries not acknowledged in time are sent again, with the same sequence number.
+   "send(sequence, item)" is how items are delivered. This class is not synchronized, the agent of the subscriber owns it.
+*/
+template<typename Item>
+class InFlightWindow
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	InFlightWindow(size_t capacity, size_t maxWaiting)
+		: m_capacity(std::max<size_t>(capacity, 1)), m_maxWaiting(maxWaiting)
+	{
+	}
+
+	// false if the window is full and too many items are waiting already (the item is not taken)
+	template<typename Send>
+	bool Push(Item item, Clock::time_point now, Send send)
+	{
+		if (m_inFlight.size() < m_capacity && m_waiting.empty())
+		{
+			Deliver(std::move(item), now, send);
+			return true;
+		}
+		if (m_waiting.size() >= m_maxWaiting)
+		{
+			return false;
+		}
+		m_waiting.push_back(std::move(item));
+		return true;
+	}
+
+	// returns how many deliveries have been acknowledged, waiting items take their room right away
+	template<typename Send>
+	size_t Acknowledge(uint64_t sequence, Clock::time_point now, Send send)
+	{
+		size_t acknowledged = 0;
+		while (!m_inFlight.empty() && m_inFlight.front().sequence <= sequence)
+		{
+			m_inFlight.pop_front();
+			++acknowledged;
+		}
+		while (m_inFlight.size() < m_capacity && !m_waiting.empty())
+		{
+			Deliver(std::move(m_waiting.front()), now, send);
+			m_waiting.pop_front();
+		}
+		return acknowledged;
+	}
+
+	// deliveries in flight for "timeout" (or longer) are sent again, returns how many
+	template<typename Send>
+	size_t RedeliverExpired(Clock::time_point now, std::chrono::milliseconds timeout, Send send)
+	{
+		size_t redelivered = 0;
+		for (auto& delivery : m_inFlight)
+		{
+			if (now - delivery.sentAt >= timeout)
+			{
+				delivery.sentAt = now;
+				send(delivery.sequence, delivery.item);
+				++redelivered;
+			}
+		}
+		return redelivered;
+	}
+
+	// every delivery in flight is sent again (e.g. to a subscriber resuming its session)
+	template<typename Send>
+	void RedeliverAll(Clock::time_point now, Send send)
+	{
+		for (auto& delivery : m_inFlight)
+		{
+			delivery.sentAt = now;
+			send(delivery.sequence, delivery.item);
+		}
+	}
+
+	[[nodiscard]] size_t InFlight() const
+	{
+		return m_inFlight.size();
+	}
+
+	[[nodiscard]] size_t Waiting() const
+	{
+		return m_waiting.size();
+	}
+
+	// the sequence number of the latest delivery (0 if none)
+	[[nodiscard]] uint64_t LastSequence() const
+	{
+		return m_nextSequence - 1;
+	}
+private:
+	struct Delivery
+	{
+		uint64_t sequence;
+		Item item;
+		Clock::time_point sentAt;
+	};
+
+	template<typename Send>
+	void Deliver(Item item, Clock::time_point now, Send& send)
+	{
+		const auto& delivery = m_inFlight.emplace_back(Delivery{ m_nextSequence++, std::move(item), now });
+		send(delivery.sequence, delivery.item);
+	}
+
+	size_t m_capacity;
+	size_t m_maxWaiting;
+	std::deque<Delivery> m_inFlight;
+	std::deque<Item> m_waiting;
+	uint64_t m_nextSequence = 1;
+};
+
+/* The windows of acknowledged subscriptions, by session name: a window outlives its subscriber for "ttl",
+   thus a subscriber reconnecting with the same session gets again what it has not acknowledged.
+   A session is used by one subscriber at a time. Sessions without a name are never resumed.
+*/
+template<typename Item>
+class AckSessions
+{
+public:
+	using Window = InFlightWindow<Item>;
+	using Clock = typename Window::Clock;
+
+	explicit AckSessions(std::chrono::milliseconds ttl)
+		: m_ttl(ttl)
+	{
+	}
+
+	// the window of the session (a resumed session keeps its settings), nullptr if another subscriber is using it
+	std::shared_ptr<Window> Attach(const std::string& name, size_t capacity, size_t maxWaiting, Clock::time_point now)
+	{
+		if (name.empty())
+		{
+			return std::make_shared<Window>(capacity, maxWaiting);
+		}
+		std::lock_guard lock{ m_mutex };
+		// expired sessions are dropped lazily, no timers needed
+		std::erase_if(m_sessions, [&](const auto& session) {
+			return !session.second.attached && now - session.second.detachedAt >= m_ttl;
+		});
+		auto& session = m_sessions[name];
+		if (session.attached)
+		{
+			return nullptr;
+		}
+		if (!session.window)
+		{
+			session.window = std::make_shared<Window>(capacity, maxWaiting);
+		}
+		session.attached = true;
+		return session.window;
+	}
+
+	// the subscriber has gone, the session waits for the next one (for "ttl")
+	void Detach(const std::string& name, Clock::time_point now)
+	{
+		if (name.empty())
+		{
+			return;
+		}
+		std::lock_guard lock{ m_mutex };
+		if (const auto it = m_sessions.find(name); it != end(m_sessions))
+		{
+			it->second.attached = false;
+			it->second.detachedAt = now;
+		}
+	}
+
+	[[nodiscard]] size_t Size() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_sessions.size();
+	}
+private:
+	struct Session
+	{
+		std::shared_ptr<Window> window;
+		bool attached = false;
+		typename Clock::time_point detachedAt;
+	};
+
+	std::chrono::milliseconds m_ttl;
+	mutable std::mutex m_mutex;
+	std::map<std::string, Session> m_sessions;
+};
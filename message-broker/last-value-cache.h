@@ -0,0 +1,202 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/* The last value of every topic (or of every key of a topic), delivered to new subscribers before the live messages.
+   Bounded by a global memory budget: the least recently used values are evicted first (publishing and delivering a value both count as a use).
+   Entries live in a contiguous vector (freed slots are reused) and they are linked by index, both in LRU order and by topic:
+   there are no allocations per entry once the vector has grown, and getting the values of a topic touches only its own entries.
+   A single mutex guards everything: values change only when publishers ask for it and they are read only when subscribing.
+*/
+template<typename Value>
+class LastValueCache
+{
+public:
+	explicit LastValueCache(size_t budget)
+		: m_budget(budget)
+	{
+	}
+
+	// "bytes" is the size of the value, a value that does not fit in the budget is not kept (and it replaces nothing)
+	void Put(uint64_t topic, uint64_t key, Value value, size_t bytes)
+	{
+		const auto cost = bytes + sizeof(Entry);
+		std::lock_guard lock{ m_mutex };
+		const auto it = m_index.find({ topic, key });
+		if (cost > m_budget)
+		{
+			if (it != end(m_index))
+			{
+				Remove(it->second);
+			}
+			return;
+		}
+		if (it != end(m_index))
+		{
+			auto& entry = m_entries[it->second];
+			m_bytes = m_bytes - entry.cost + cost;
+			entry.value = std::move(value);
+			entry.cost = cost;
+			Unlink(it->second, &Entry::lruPrev, &Entry::lruNext, m_lru);
+			Link(it->second, &Entry::lruPrev, &Entry::lruNext, m_lru);
+		}
+		else
+		{
+			const auto index = Allocate();
+			auto& entry = m_entries[index];
+			entry.value = std::move(value);
+			entry.topic = topic;
+			entry.key = key;
+			entry.cost = cost;
+			m_bytes += cost;
+			Link(index, &Entry::lruPrev, &Entry::lruNext, m_lru);
+			Link(index, &Entry::topicPrev, &Entry::topicNext, m_topics[topic]);
+			m_index.emplace(std::pair{ topic, key }, index);
+		}
+		while (m_bytes > m_budget)
+		{
+			Remove(m_lru.last);
+		}
+	}
+
+	void Erase(uint64_t topic, uint64_t key)
+	{
+		std::lock_guard lock{ m_mutex };
+		if (const auto it = m_index.find({ topic, key }); it != end(m_index))
+		{
+			Remove(it->second);
+		}
+	}
+
+	// the values of "topic", in the order they were first put
+	std::vector<Value> Get(uint64_t topic)
+	{
+		std::vector<Value> values;
+		std::lock_guard lock{ m_mutex };
+		const auto it = m_topics.find(topic);
+		if (it == end(m_topics))
+		{
+			return values;
+		}
+		// from the oldest, since Link adds to the front
+		for (auto index = it->second.last; index != None; index = m_entries[index].topicPrev)
+		{
+			values.push_back(m_entries[index].value);
+			Unlink(index, &Entry::lruPrev, &Entry::lruNext, m_lru);
+			Link(index, &Entry::lruPrev, &Entry::lruNext, m_lru);
+		}
+		return values;
+	}
+
+	// the values and their bookkeeping
+	[[nodiscard]] size_t Bytes() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_bytes;
+	}
+
+	[[nodiscard]] size_t Size() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_index.size();
+	}
+private:
+	static constexpr uint32_t None = UINT32_MAX;
+
+	struct Entry
+	{
+		Value value;
+		uint64_t topic = 0;
+		uint64_t key = 0;
+		size_t cost = 0;
+		uint32_t lruPrev = None, lruNext = None;
+		uint32_t topicPrev = None, topicNext = None;
+	};
+
+	// the ends of a list of entries (the first is the newest)
+	struct List
+	{
+		uint32_t first = None;
+		uint32_t last = None;
+	};
+
+	struct KeyHash
+	{
+		size_t operator()(const std::pair<uint64_t, uint64_t>& key) const
+		{
+			return std::hash<uint64_t>{}(key.first * 0x9E3779B97F4A7C15ULL ^ key.second);
+		}
+	};
+
+	uint32_t Allocate()
+	{
+		if (m_free.empty())
+		{
+			m_entries.emplace_back();
+			return static_cast<uint32_t>(m_entries.size() - 1);
+		}
+		const auto index = m_free.back();
+		m_free.pop_back();
+		return index;
+	}
+
+	void Remove(uint32_t index)
+	{
+		auto& entry = m_entries[index];
+		Unlink(index, &Entry::lruPrev, &Entry::lruNext, m_lru);
+		auto& topic = m_topics[entry.topic];
+		Unlink(index, &Entry::topicPrev, &Entry::topicNext, topic);
+		if (topic.first == None)
+		{
+			m_topics.erase(entry.topic);
+		}
+		m_index.erase({ entry.topic, entry.key });
+		m_bytes -= entry.cost;
+		entry = Entry{}; // the value is released now, not when the slot is reused
+		m_free.push_back(index);
+	}
+
+	// adds the entry to the front of the list
+	void Link(uint32_t index, uint32_t Entry::* prev, uint32_t Entry::* next, List& list)
+	{
+		m_entries[index].*prev = None;
+		m_entries[index].*next = list.first;
+		if (list.first != None)
+		{
+			m_entries[list.first].*prev = index;
+		}
+		list.first = index;
+		if (list.last == None)
+		{
+			list.last = index;
+		}
+	}
+
+	void Unlink(uint32_t index, uint32_t Entry::* prev, uint32_t Entry::* next, List& list)
+	{
+		auto& entry = m_entries[index];
+		if (entry.*prev != None)
+			m_entries[entry.*prev].*next = entry.*next;
+		else
+			list.first = entry.*next;
+		if (entry.*next != None)
+			m_entries[entry.*next].*prev = entry.*prev;
+		else
+			list.last = entry.*prev;
+		entry.*prev = entry.*next = None;
+	}
+
+	size_t m_budget;
+	size_t m_bytes = 0;
+	mutable std::mutex m_mutex;
+	std::vector<Entry> m_entries;
+	std::vector<uint32_t> m_free;
+	std::unordered_map<std::pair<uint64_t, uint64_t>, uint32_t, KeyHash> m_index;
+	std::unordered_map<uint64_t, List> m_topics;
+	List m_lru; // the first is the most recently used
+};
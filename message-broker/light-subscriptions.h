@@ -0,0 +1,231 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+// a slot of SubscriberSlots: the generation tells a subscriber from the next one getting the same slot
+struct SlotRef
+{
+	uint32_t index = 0;
+	uint32_t generation = 0;
+
+	friend bool operator==(const SlotRef&, const SlotRef&) = default;
+};
+
+/* Lightweight subscriptions: subscribers that just forward some topics to their stream are not agents, they are slots.
+   Slots are pre-allocated in chunks that never move, freed slots are reused: subscribing and unsubscribing allocate nothing
+   (but the subscriber itself) and they do not involve SObjectizer at all (no coop registration, no binder, no deregistration).
+   Every slot has its own lock: publishers write to a subscriber under that lock (see Visit), thus a released slot is never written again,
+   even by publishers still holding the subscriber in their fan-out (see LightFanout), since the generation does not match anymore.
+*/
+template<typename Subscriber>
+class SubscriberSlots
+{
+public:
+	static constexpr size_t ChunkSize = 1024;
+	static constexpr size_t MaxChunks = 1024;
+
+	// up to "maxChunks" chunks (at most MaxChunks)
+	explicit SubscriberSlots(size_t preallocated = ChunkSize, size_t maxChunks = MaxChunks)
+		: m_maxChunks(std::min<size_t>(maxChunks, MaxChunks))
+	{
+		std::lock_guard lock{ m_mutex };
+		while (m_size < preallocated && m_chunks < m_maxChunks)
+		{
+			Grow();
+		}
+	}
+
+	SubscriberSlots(const SubscriberSlots&) = delete;
+	SubscriberSlots& operator=(const SubscriberSlots&) = delete;
+
+	~SubscriberSlots()
+	{
+		for (auto& chunk : m_slots)
+		{
+			delete[] chunk.load(std::memory_order_relaxed);
+		}
+	}
+
+	// nothing when all the slots are taken (then the subscriber is refused, not the broker)
+	std::optional<SlotRef> Acquire(Subscriber subscriber)
+	{
+		uint32_t index = 0;
+		{
+			std::lock_guard lock{ m_mutex };
+			if (m_free.empty())
+			{
+				if (m_chunks == m_maxChunks)
+				{
+					return std::nullopt;
+				}
+				Grow();
+			}
+			index = m_free.back();
+			m_free.pop_back();
+			++m_used;
+		}
+		auto& slot = SlotAt(index);
+		std::lock_guard lock{ slot.mutex };
+		slot.subscriber.emplace(std::move(subscriber));
+		return SlotRef{ index, slot.generation };
+	}
+
+	// "visit(subscriber)" under the lock of the slot, false if the slot has been released in the meantime
+	template<typename Visitor>
+	bool Visit(SlotRef ref, Visitor visit)
+	{
+		auto& slot = SlotAt(ref.index);
+		std::lock_guard lock{ slot.mutex };
+		if (slot.generation != ref.generation || !slot.subscriber)
+		{
+			return false;
+		}
+		visit(*slot.subscriber);
+		return true;
+	}
+
+	// the subscriber, only to the first caller (the slot might be released by several threads at once, e.g. on errors and on disconnection)
+	std::optional<Subscriber> Release(SlotRef ref)
+	{
+		auto& slot = SlotAt(ref.index);
+		std::optional<Subscriber> subscriber;
+		{
+			std::lock_guard lock{ slot.mutex };
+			if (slot.generation != ref.generation || !slot.subscriber)
+			{
+				return std::nullopt;
+			}
+			++slot.generation;
+			subscriber.emplace(std::move(*slot.subscriber));
+			slot.subscriber.reset();
+		}
+		std::lock_guard lock{ m_mutex };
+		m_free.push_back(ref.index);
+		--m_used;
+		return subscriber;
+	}
+
+	// "visit(ref, subscriber)" for every subscriber, under the lock of its slot
+	template<typename Visitor>
+	void ForEach(Visitor visit)
+	{
+		const auto size = m_size.load(std::memory_order_acquire);
+		for (uint32_t index = 0; index < size; ++index)
+		{
+			auto& slot = SlotAt(index);
+			std::lock_guard lock{ slot.mutex };
+			if (slot.subscriber)
+			{
+				visit(SlotRef{ index, slot.generation }, *slot.subscriber);
+			}
+		}
+	}
+
+	[[nodiscard]] size_t Size() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_used;
+	}
+
+	[[nodiscard]] size_t Capacity() const
+	{
+		return m_size.load(std::memory_order_acquire);
+	}
+private:
+	struct Slot
+	{
+		std::mutex mutex;
+		uint32_t generation = 0;
+		std::optional<Subscriber> subscriber;
+	};
+
+	Slot& SlotAt(uint32_t index)
+	{
+		return m_slots[index / ChunkSize].load(std::memory_order_acquire)[index % ChunkSize];
+	}
+
+	// under m_mutex. Slots are handed out from the lowest index
+	void Grow()
+	{
+		m_slots[m_chunks++].store(new Slot[ChunkSize], std::memory_order_release);
+		const auto first = static_cast<uint32_t>(m_size.load(std::memory_order_relaxed));
+		for (auto index = static_cast<uint32_t>(first + ChunkSize); index > first; --index)
+		{
+			m_free.push_back(index - 1);
+		}
+		m_size.store(first + ChunkSize, std::memory_order_release);
+	}
+
+	const size_t m_maxChunks;
+	mutable std::mutex m_mutex; // for m_free and growing
+	std::array<std::atomic<Slot*>, MaxChunks> m_slots{};
+	size_t m_chunks = 0;
+	std::atomic<size_t> m_size = 0; // the slots allocated so far
+	size_t m_used = 0;
+	std::vector<uint32_t> m_free;
+};
+
+/* The lightweight subscribers of a topic, as a flat array: publishers load a snapshot of it atomically and iterate it, they never take the lock.
+   Subscribing and unsubscribing replace it with an updated copy (the copy is as big as the subscribers of the topic, a few KB at most),
+   the lock only serializes them with each other. Publishers skip the topic when it has no lightweight subscribers at all.
+*/
+class LightFanout
+{
+public:
+	using Subscribers = std::vector<SlotRef>;
+
+	void Add(SlotRef ref)
+	{
+		std::lock_guard lock{ m_mutex };
+		const auto current = m_subscribers.load(std::memory_order_relaxed);
+		auto subscribers = std::make_shared<Subscribers>();
+		subscribers->reserve(current->size() + 1);
+		subscribers->assign(current->begin(), current->end());
+		subscribers->push_back(ref);
+		Replace(std::move(subscribers));
+	}
+
+	void Remove(SlotRef ref)
+	{
+		std::lock_guard lock{ m_mutex };
+		const auto current = m_subscribers.load(std::memory_order_relaxed);
+		if (std::ranges::find(*current, ref) == current->end())
+		{
+			return;
+		}
+		auto subscribers = std::make_shared<Subscribers>();
+		subscribers->reserve(current->size() - 1);
+		std::ranges::remove_copy(*current, std::back_inserter(*subscribers), ref);
+		Replace(std::move(subscribers));
+	}
+
+	// null if there are no subscribers
+	[[nodiscard]] std::shared_ptr<const Subscribers> Get() const
+	{
+		if (!m_size.load(std::memory_order_acquire))
+		{
+			return nullptr;
+		}
+		return m_subscribers.load(std::memory_order_acquire);
+	}
+private:
+	// under m_mutex
+	void Replace(std::shared_ptr<const Subscribers> subscribers)
+	{
+		const auto size = subscribers->size();
+		m_subscribers.store(std::move(subscribers), std::memory_order_release);
+		m_size.store(size, std::memory_order_release);
+	}
+
+	std::mutex m_mutex; // writers only
+	std::atomic<std::shared_ptr<const Subscribers>> m_subscribers = std::make_shared<const Subscribers>();
+	std::atomic<size_t> m_size = 0;
+};
@@ -0,0 +1,69 @@
+#define _WINSOCKAPI_
+#include <csignal>
+#include <future>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include "broker-options.h"
+#include "embedded-broker.h"
+#include <grpc++/server_builder.h>
+#include <grpcpp/ext/proto_server_reflection_plugin.h>
+
+using namespace grpc;
+
+// termination is handled by subscribing to SIGINT and SIGTERM (e.g. CTRL+C)
+// and by using a promise/future for event synchronization (even though, atomic_flag or condition_variable are possible options too).
+std::promise<void> stop;
+
+static void TerminateThisProgram(int sig)
+{
+	if (sig == SIGTERM || sig == SIGINT)
+	{
+		spdlog::debug("got termination signal");
+		stop.set_value();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		spdlog::set_level(spdlog::level::debug);
+		set_default_logger(spdlog::stdout_color_mt("Message-Broker"));
+		const auto options = ParseBrokerOptions(argc, argv);
+
+		std::signal(SIGINT, TerminateThisProgram);
+		std::signal(SIGTERM, TerminateThisProgram);
+
+		// the broker core, with the SObjectizer environment that keeps every SObjectizer resource alive: here it is served by gRPC only
+		EmbeddedBroker broker{ options };
+
+		// for our demo, we use the gRPC reflection plugin
+		reflection::InitProtoReflectionServerBuilderPlugin();
+		// on the same page, we enable the default health check service
+		EnableDefaultHealthCheckService(true);
+		const auto& server_address = options.address;
+		ServerBuilder builder;
+		builder.AddListeningPort(server_address, InsecureServerCredentials());
+		builder.RegisterService(&broker.Service());
+		auto server = builder.BuildAndStart();
+		server->GetHealthCheckService()->SetServingStatus("MessageBroker", true);
+		spdlog::info("Server is listening on {}", server_address);
+
+		// let's wait for termination (CTRL+C or just SIGTERM/SIGINT)
+		stop.get_future().wait();
+		spdlog::debug("Program terminated");
+		// first we turn off SObjectizer (in order to complete any pending requests)
+		broker.Stop();
+		spdlog::debug("Agents terminated");
+		// finally we shutdown the server and wait for this to complete
+		server->Shutdown();
+		server->Wait();
+		spdlog::debug("Server wait is over");
+	}
+	catch (const std::exception& ex)
+	{
+		spdlog::critical("Unrecoverable error: {}", ex.what());
+		return 1;
+	}
+	spdlog::info("Exiting successfully");
+}
\ No newline at end of file
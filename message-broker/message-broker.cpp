@@ -1,17 +1,38 @@
 #define _WINSOCKAPI_
-#include <csignal>
 #include <so_5/all.hpp>
 #include <Windows.h>
 #include <utility>
 #include <atomic>
+#include <map>
 #include <ranges>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
 #include <spdlog/spdlog.h>
-#include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/udp_sink.h>
 #include "../generated/broker.grpc.pb.h"
 #include "../generated/broker.pb.h"
-#include <grpc++/server_builder.h>
-#include <grpcpp/ext/proto_server_reflection_plugin.h>
+#include "broker-options.h"
+#include "broker-stats.h"
+#include "compression.h"
+#include "consumer-group.h"
+#include "cumulative-acknowledger.h"
+#include "embedded-broker.h"
+#include "encoded-message.h"
+#include "federation-link.h"
+#include "in-flight-window.h"
+#include "last-value-cache.h"
+#include "light-subscriptions.h"
+#include "message-filter.h"
+#include "publish-reactor.h"
+#include "request-arenas.h"
+#include "shard-balancer.h"
+#include "subscriber-stream.h"
+#include "topic-log.h"
+#include "topic-interest.h"
+#include "topic-partitions.h"
+#include "topic-registry.h"
+#include "topic-trie.h"
 
 using grpc::Channel;
 using grpc::ClientContext;
@@ -44,192 +65,2170 @@ struct std::formatter<google::protobuf::RepeatedPtrField<T>>
 	}
 };
 
+// a ReceiveAgent in a consumer group, as seen by the group
+struct GroupMember
+{
+	so_5::mbox_t mbox;
+	SubscriberStream* stream; // valid as long as the agent is in the group
+	std::shared_ptr<std::atomic<size_t>> inFlight; // messages sent to the agent and not handled yet
+
+	[[nodiscard]] size_t Outstanding() const
+	{
+		return inFlight->load(std::memory_order_relaxed) + stream->QueueStats().depth;
+	}
+};
+
+using TopicGroups = ConsumerGroups<GroupMember, so_5::message_holder_t<EncodedMessage>>;
+// the groups of an agent, one per topic
+using GroupsByTopic = std::vector<std::pair<TopicId, std::shared_ptr<TopicGroups::Group>>>;
+
+static void SendToGroupMember(const GroupMember& member, const so_5::message_holder_t<EncodedMessage>& message)
+{
+	member.inFlight->fetch_add(1, std::memory_order_relaxed);
+	so_5::send(member.mbox, message);
+}
+
+// sharded dispatch: a topic has an mbox per shard and publishers send only to the shards with subscribers of the topic (see ShardRelay)
+struct TopicShards
+{
+	std::vector<so_5::mbox_t> mboxes;
+	std::vector<std::atomic<size_t>> subscribers; // per shard
+};
+
+// every topic is a so_5::mbox_t and, optionally, a log on disk
+struct TopicChannel
+{
+	so_5::mbox_t mbox;
+	std::shared_ptr<TopicLog> log; // null if topics are not logged
+	std::shared_ptr<TopicGroups> groups;
+	std::shared_ptr<TopicShards> shards; // null unless dispatch is sharded
+	std::shared_ptr<std::atomic<size_t>> subscribers = std::make_shared<std::atomic<size_t>>(0); // by name (see Stats)
+	std::shared_ptr<TopicDictionary> dictionary; // for compressed delivery
+	std::shared_ptr<LightFanout> light = std::make_shared<LightFanout>(); // the subscribers served by slots (see SubscriberSlots)
+	std::shared_ptr<TopicFilters> filters = std::make_shared<TopicFilters>(); // of the subscribers, evaluated by publishers
+	std::shared_ptr<TopicPartitions> partitions; // null unless the topic is partitioned (then it has no messages of its own)
+	std::optional<size_t> lane; // partitions only: the lane fanning out their messages (see PartitionLane)
+	std::shared_ptr<std::atomic<size_t>> localSubscribers = std::make_shared<std::atomic<size_t>>(0); // in-process (see LocalSubscriber)
+};
+
+// the agents subscribed to a topic by name: once per shard with subscribers (see ShardRelay) or once to the mbox of the topic
+static void SendToAgents(const TopicChannel& channel, const so_5::message_holder_t<EncodedMessage>& message, const std::vector<so_5::mbox_t>& relays)
+{
+	if (!channel.shards)
+	{
+		so_5::send(channel.mbox, message);
+		return;
+	}
+	// once per shard with subscribers, instead of once per subscriber
+	for (size_t shard = 0; shard < relays.size(); ++shard)
+	{
+		if (channel.shards->subscribers[shard].load(std::memory_order_relaxed))
+		{
+			so_5::send(relays[shard], message);
+		}
+	}
+}
+
+using Topics = TopicRegistry<TopicChannel>;
+// subscribers to topic patterns (e.g. prices.eu.*) get messages to their direct mbox
+using WildcardSubscriptions = TopicTrie<so_5::mbox_t>;
+// the retained frames of every topic (see Message.retain), by key hash
+using RetainedValues = LastValueCache<ByteBuffer>;
+
+// a topic a ReceiveAgent subscribes to
+struct Subscription
+{
+	so_5::mbox_t channel;
+	TopicId topicId = 0;
+	std::string_view name; // topics are never removed, thus their names never go away
+	std::shared_ptr<TopicLog> log; // null if the topic is not logged (shared since agents might outlive the service on shutdown)
+	std::optional<uint64_t> nextOffset; // set only when replaying from the log, then it tracks the next offset to deliver
+	bool replaying = false;
+	std::shared_ptr<TopicShards> shards; // sharded dispatch only: the agent listens to the mbox of its own shard instead of "channel"
+	std::shared_ptr<RetainedValues> retained; // null if the retained values of the topic are not delivered (e.g. when replaying)
+	std::shared_ptr<std::atomic<size_t>> subscribers; // of the topic
+	std::shared_ptr<const MessageFilter> filter; // null if the topic is not filtered (see ReceiveRequest.filters)
+	std::shared_ptr<TopicFilters> filters; // where the filter has its slot, while the agent listens to the topic
+	size_t filterSlot = 0;
+};
+
+// what "Stats" reads: the counters of every thread (see PerThread) and the subscribers alive, for their outbound queues
+struct BrokerStats
+{
+	struct Subscriber
+	{
+		SubscriberStream* stream; // valid as long as the subscriber is registered
+		size_t topics = 0;
+		size_t patterns = 0;
+		size_t groups = 0;
+	};
+
+	// agents and lightweight subscribers get their ids from the same counter, thus ids are unique among all the subscribers
+	uint64_t NewSubscriberId()
+	{
+		return nextSubscriberId.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	PerThread<ThreadStats> threads;
+	std::mutex subscribersMutex;
+	std::map<uint64_t, Subscriber> subscribers; // agents only, lightweight subscribers are in their slots
+	std::atomic<uint64_t> nextSubscriberId = 1;
+};
+
+// batched and compressed delivery settings, as requested by the subscriber (see ReceiveRequest)
+struct DeliverySettings
+{
+	size_t maxBatch = 1; // 1 = batching is off
+	std::chrono::microseconds linger{};
+	std::function<ByteBuffer(const ByteBuffer&, TopicId)> compress; // empty = compression is off
+	bool peer = false; // a federation peer gets only the messages published to this broker (see ReceiveRequest.federation_peer)
+	bool conflateByKey = false; // conflation by topic and key (see ConflationKeyOf), by topic otherwise
+	std::chrono::nanoseconds writeInterval{}; // conflated delivery capped at ReceiveRequest.max_rate, zero = no cap
+};
+
+// what outbound queues conflate on (see ReceiveRequest.conflation): the topic, or the topic and the key of the message. Never 0, which means "never conflate"
+static uint64_t ConflationKeyOf(TopicId topicId, uint64_t keyHash, bool byKey)
+{
+	if (!byKey || !keyHash)
+	{
+		return topicId;
+	}
+	const auto key = (topicId * 0x9E3779B97F4A7C15ull) ^ keyHash;
+	return key ? key : 1;
+}
+
+// a subscriber served by a slot instead of an agent (see SubscriberSlots): it gets the messages of its topics as they are, from the publishers
+struct LightSubscriber
+{
+	struct Topic
+	{
+		TopicId id = 0;
+		std::shared_ptr<LightFanout> fanout;
+		std::shared_ptr<std::atomic<size_t>> subscribers;
+	};
+
+	SubscriberStream* stream; // valid until the slot is released, then the stream is closed
+	uint64_t id = 0; // see SubscriberStats.id
+	std::vector<Topic> topics;
+	SubscriberInterests interests;
+	bool peer = false; // see DeliverySettings::peer
+	bool conflateByKey = false; // see DeliverySettings::conflateByKey
+};
+
+using LightSlots = SubscriberSlots<LightSubscriber>;
+
+// acknowledged delivery keeps the key (for conflation) and the frame of every response
+using DeliveryWindow = InFlightWindow<std::pair<uint64_t, ByteBuffer>>;
+using DeliverySessions = AckSessions<std::pair<uint64_t, ByteBuffer>>;
+
+// acknowledged delivery settings, as requested by the subscriber (see SubscribeRequest.acks)
+struct AckedDelivery
+{
+	std::shared_ptr<DeliveryWindow> window; // null = acknowledged delivery is off
+	std::chrono::milliseconds timeout{};
+	std::string session;
+	std::shared_ptr<DeliverySessions> sessions; // the agent detaches from the session when it has done
+};
+
 /* An agent for dispatching data to a certain client which has called "Receive" on some topics
   clearly, other options are possible, this is a just an example.
+  It gets the messages of its topics from their mboxes (the ones of its patterns and of its consumer groups from mboxes of its own)
+  and it writes them to its SubscriberStream. It handles one event at a time on a thread of its dispatcher, thus its state needs no locks:
+  other threads reach it only by sending it messages (e.g. change_subscriptions, acknowledge).
 */
 class ReceiveAgent : public so_5::agent_t
 {
-	struct connection_check_timeout : so_5::signal_t {};
+	struct client_disconnected : so_5::signal_t {};
+	struct flush_batch { uint64_t batchId; };
+	struct replay_chunk { TopicId topicId; };
+	struct groups_left : so_5::signal_t {};
+	struct redelivery_check : so_5::signal_t {};
+	struct write_paced : so_5::signal_t {};
+
+	static constexpr size_t ReplayChunkSize = 256;
+	// how long a replay waits for a full outbound queue to make room
+	static constexpr std::chrono::milliseconds ReplayBackoff{ 5 };
 public:
-	ReceiveAgent(context_t c, std::promise<Status>& completed, ServerContext* context, ServerWriter<ReceiveResponse>* writer, std::vector<so_5::mbox_t> channels)
-		: agent_t(std::move(c)), m_completed(completed), m_context(context), m_writer(writer), m_channels(std::move(channels))
+	// sent to the agent's direct mbox, unsubscriptions are applied first
+	struct change_subscriptions
 	{
+		std::vector<Subscription> subscribe;
+		std::vector<std::string> subscribePatterns;
+		std::vector<TopicId> unsubscribe;
+		std::vector<std::string> unsubscribePatterns;
+	};
+
+	// sent to the agent's direct mbox, cumulative (see SubscribeRequest.ack)
+	struct acknowledge { uint64_t sequence; };
+
+	// "shard" is meaningful only with sharded dispatch
+	ReceiveAgent(context_t c, SubscriberStream& stream, std::vector<Subscription> subscriptions, std::vector<std::string> patterns, std::shared_ptr<WildcardSubscriptions> wildcards, GroupsByTopic groups, DeliverySettings delivery, AckedDelivery acks, SubscriberInterests interests, std::shared_ptr<BrokerStats> stats, size_t shard)
+		: agent_t(std::move(c)), m_stream(stream), m_patterns(std::move(patterns)), m_wildcards(std::move(wildcards)), m_groups(std::move(groups)), m_delivery(std::move(delivery)), m_acks(std::move(acks)), m_interests(std::move(interests)), m_stats(std::move(stats)), m_shard(shard)
+	{
+		for (auto& subscription : subscriptions)
+		{
+			// a topic listed twice is subscribed once
+			m_subscriptions.try_emplace(subscription.topicId, std::move(subscription));
+		}
+		if (m_delivery.writeInterval.count())
+		{
+			m_paced.emplace(m_stream.QueueStats().capacity, OverflowPolicy::drop_oldest, true);
+		}
 	}
 
 private:
 	void so_define_agent() override
 	{
 		// let's subscribe to every topic (aka: 1 topic = 1 so_5::mbox_t)
-		for (const auto& channel : m_channels)
+		for (auto& [_, subscription] : m_subscriptions)
+		{
+			Listen(subscription);
+		}
+
+		// messages on topics matching our patterns: the trie sends them once, no matter how many patterns match (see TopicTrie)
+		so_subscribe_self().event([this](so_5::mhood_t<EncodedMessage> data) {
+			if (!IsForThisSubscriber(*data))
+			{
+				return;
+			}
+			const auto timer = Measure(*data);
+			// the topic is subscribed by name too, its mbox delivers it
+			if (m_subscriptions.contains(data->topicId))
+			{
+				return;
+			}
+			spdlog::debug("A client worker got a message of {} bytes on a wildcard subscription - thread {}", data->frame.Length(), GetCurrentThreadId());
+			Dispatch(KeyOf(*data), FrameOf(*data));
+		});
+
+		so_subscribe_self().event([this](so_5::mhood_t<change_subscriptions> change) {
+			ChangeSubscriptions(*change);
+		});
+
+		if (m_acks.window)
+		{
+			so_subscribe_self().event([this](so_5::mhood_t<acknowledge> ack) {
+				m_acks.window->Acknowledge(ack->sequence, DeliveryWindow::Clock::now(), WriteNumbered());
+				ArmRedelivery();
+			});
+
+			so_subscribe_self().event([this](so_5::mhood_t<redelivery_check>) {
+				m_redeliveryArmed = false;
+				// frames still queued have not reached the subscriber yet, thus they can't have been acknowledged: no point in writing them again
+				if (!m_stream.QueueStats().depth)
+				{
+					if (const auto redelivered = m_acks.window->RedeliverExpired(DeliveryWindow::Clock::now(), m_acks.timeout, WriteNumbered()))
+					{
+						spdlog::debug("A client worker redelivered {} responses not acknowledged in time", redelivered);
+					}
+				}
+				ArmRedelivery();
+			});
+		}
+
+		if (!m_groups.empty())
 		{
-			so_subscribe(channel).event([chanName = channel->query_name(), this](so_5::mhood_t<std::string> data) {
-				spdlog::debug("A client worker got a message '{}' on channel '{}' - thread {}", *data, chanName, GetCurrentThreadId());
-				ReceiveResponse response;
-				response.mutable_message()->set_topic(chanName);
-				response.mutable_message()->set_content(*data);
-				const auto writeSuccessful = m_writer->Write(response);
-				spdlog::debug("A client worker sent message to subscriber. Success={}", writeSuccessful);
-				// if we get a write error, the client has possibly gone.
-				// Clearly, other options are possible (retry, just ignore this error, etc).
-				if (!writeSuccessful)
+			m_groupMbox = so_environment().create_mbox();
+			so_subscribe(m_groupMbox).event([this](so_5::mhood_t<EncodedMessage> data) {
+				const auto timer = Measure(*data);
+				m_inFlight->fetch_sub(1, std::memory_order_relaxed);
+				if (m_leavingGroups)
+				{
+					Redeliver(data.make_holder());
+					return;
+				}
+				spdlog::debug("A client worker got a message of {} bytes from its consumer group - thread {}", data->frame.Length(), GetCurrentThreadId());
+				if (!Dispatch(data->topicId, FrameOf(*data)))
+				{
+					// the stream has not taken it (we are leaving the groups now)
+					Redeliver(data.make_holder());
+				}
+			});
+
+			// every message sent by the groups has been handled (see LeaveGroups)
+			so_subscribe_self().event([this](so_5::mhood_t<groups_left>) {
+				const auto pending = m_stream.TakePending();
+				for (const auto& [topicId, frame] : pending)
 				{
-					DeactivateThisAgent();
+					// the key is lost, these messages are balanced as any other
+					Redeliver(so_5::message_holder_t<EncodedMessage>::make(frame, topicId));
 				}
+				spdlog::debug("A client worker left its consumer groups, {} pending messages handed back", pending.size());
+				Detach();
 			});
 		}
 
-		// let's subscribe to connection_check_timeout in order to check if the client is still there
-		so_subscribe_self().event([this](so_5::mhood_t<connection_check_timeout>) {
-			if (m_context->IsCancelled())
+		so_subscribe_self().event([this](so_5::mhood_t<replay_chunk> replay) {
+			Replay(replay->topicId);
+		});
+
+		if (m_paced)
+		{
+			so_subscribe_self().event([this](so_5::mhood_t<write_paced>) {
+				m_pacedArmed = false;
+				WritePaced();
+			});
+		}
+
+		so_subscribe_self().event([this](so_5::mhood_t<flush_batch> flush) {
+			// a batch might have been flushed already because it got full
+			if (flush->batchId == m_batchId && !m_batch.empty())
 			{
-				spdlog::debug("A client worker detected a client disconnection...will detach");
-				DeactivateThisAgent();
+				FlushBatch();
 			}
 		});
+
+		// the stream tells us when the client has gone (see so_evt_start), no need to poll
+		so_subscribe_self().event([this](so_5::mhood_t<client_disconnected>) {
+			spdlog::debug("A client worker got notified of a client disconnection...will detach");
+			DeactivateThisAgent();
+		});
 	}
 
-	// some boilerplate needed to deactivate this agent, unsubscribe from mboxes, and free associated resources
-	void DeactivateThisAgent()
+	// with sharded dispatch, the agent runs on a shard for its whole life and it listens to the mboxes of its shard (see ShardRelay)
+	void Listen(Subscription& subscription)
 	{
-		m_connectionTimer = {}; // stop the timer (just to avoid any triggers in the middle of agent deactivation)
-		so_deactivate_agent(); // unsubscribe + put in special "inactive" state
-		so_deregister_agent_coop_normally(); // since we have "1 agent = 1 coop", we can directly drop the agent's cooperation to free the associated resources
-		spdlog::debug("A client worker detected a client disconnection...detaching procedures done");
+		if (subscription.shards)
+		{
+			subscription.channel = subscription.shards->mboxes[m_shard];
+		}
+		so_subscribe(subscription.channel).event([chanName = subscription.channel->query_name(), topicId = subscription.topicId, this](so_5::mhood_t<EncodedMessage> data) {
+			if (!IsForThisSubscriber(*data))
+			{
+				return;
+			}
+			const auto timer = Measure(*data);
+			spdlog::debug("A client worker got a message of {} bytes on channel '{}' - thread {}", data->frame.Length(), chanName, GetCurrentThreadId());
+			// filtered out messages count as delivered for the replay (see IsLive)
+			if (IsLive(topicId, data->offset) && Passes(m_subscriptions.at(topicId), *data))
+			{
+				// the frame is shared with all the other subscribers: no copies, no encoding here
+				// the topic id (and the key, if requested) is used to conflate messages (see ConflationKeyOf)
+				Dispatch(KeyOf(*data), FrameOf(*data));
+			}
+		});
+		if (subscription.filter)
+		{
+			// an identical filter is shared with the other subscribers of the topic
+			subscription.filterSlot = subscription.filters->Acquire(subscription.filter);
+		}
+		// once subscribed, publishers can reach this shard
+		if (subscription.shards)
+		{
+			subscription.shards->subscribers[m_shard].fetch_add(1, std::memory_order_relaxed);
+		}
+		subscription.subscribers->fetch_add(1, std::memory_order_relaxed);
 	}
 
-	void so_evt_start() override
+	void StopListening(const Subscription& subscription)
 	{
-		spdlog::debug("Worker on thread {} started", GetCurrentThreadId());
-		m_connectionTimer = so_5::send_periodic<connection_check_timeout>(so_direct_mbox(), std::chrono::seconds(5), std::chrono::seconds(5));
+		if (subscription.filter)
+		{
+			subscription.filters->Release(subscription.filterSlot);
+		}
+		subscription.subscribers->fetch_sub(1, std::memory_order_relaxed);
+		if (subscription.shards)
+		{
+			subscription.shards->subscribers[m_shard].fetch_sub(1, std::memory_order_relaxed);
+		}
 	}
 
-	void so_evt_finish() override
+	// no need to tear down the agent: messages already queued for a dropped subscription are just discarded by SObjectizer
+	void ChangeSubscriptions(const change_subscriptions& change)
+	{
+		for (const auto topicId : change.unsubscribe)
+		{
+			if (const auto it = m_subscriptions.find(topicId); it != end(m_subscriptions))
+			{
+				so_drop_subscription<EncodedMessage>(it->second.channel);
+				StopListening(it->second);
+				m_interests.Remove(it->second.name);
+				m_subscriptions.erase(it);
+			}
+		}
+		for (const auto& pattern : change.unsubscribePatterns)
+		{
+			if (const auto it = std::ranges::find(m_patterns, pattern); it != end(m_patterns))
+			{
+				m_wildcards->Remove(pattern, so_direct_mbox()->id());
+				m_interests.Remove(pattern);
+				m_patterns.erase(it);
+			}
+		}
+		for (const auto& subscription : change.subscribe)
+		{
+			if (const auto [it, added] = m_subscriptions.try_emplace(subscription.topicId, subscription); added)
+			{
+				Listen(it->second);
+				m_interests.Add(it->second.name);
+				if (it->second.nextOffset)
+				{
+					StartReplay(it->first);
+				}
+				DeliverRetained(it->second);
+			}
+		}
+		for (const auto& pattern : change.subscribePatterns)
+		{
+			if (std::ranges::find(m_patterns, pattern) == end(m_patterns))
+			{
+				m_wildcards->Add(pattern, so_direct_mbox()->id(), so_direct_mbox());
+				m_interests.Add(pattern);
+				m_patterns.push_back(pattern);
+			}
+		}
+		RegisterForStats();
+		spdlog::debug("A client worker changed its subscriptions: {} topics and {} patterns now", m_subscriptions.size(), m_patterns.size());
+	}
+
+	// the publisher has evaluated the filter already, unless the subscription is newer than the message
+	static bool Passes(const Subscription& subscription, const EncodedMessage& message)
+	{
+		if (!subscription.filter)
+		{
+			return true;
+		}
+		if (const auto passed = message.filters.Passed(subscription.filterSlot, *subscription.filter))
+		{
+			return *passed;
+		}
+		return FrameMatches(message.frame, *subscription.filter);
+	}
+
+	// retained and replayed frames are decoded and filtered here
+	static bool Passes(const Subscription& subscription, const ByteBuffer& frame)
 	{
-		spdlog::debug("Worker on thread {} finished", GetCurrentThreadId());
-		m_completed.set_value(Status::OK);
+		return !subscription.filter || FrameMatches(frame, *subscription.filter);
 	}
 
-	std::promise<Status>& m_completed;
-	ServerContext* m_context;
-	ServerWriter<ReceiveResponse>* m_writer;
-	std::vector<so_5::mbox_t> m_channels;
-	so_5::timer_id_t m_connectionTimer;
-};
+	uint64_t KeyOf(const EncodedMessage& message) const
+	{
+		return ConflationKeyOf(message.topicId, message.keyHash, m_delivery.conflateByKey);
+	}
 
-/* An implementation of the MessageBroker service based on SObjectizer
-*  Every "Receive" (aka: every client) is handled by a dedicated agent which subscribes to all the topics of interest of that particular request.
-*/
-class ServiceImpl : public MessageBroker::Service, public so_5::agent_t
-{
-public:
-	ServiceImpl(context_t c)
-		: agent_t(std::move(c))
+	// federation peers do not get what this broker has got from other brokers, thus messages cross one link at most (see FederationLink)
+	bool IsForThisSubscriber(const EncodedMessage& message) const
 	{
-		constexpr auto threadPoolSize = 5;
-		spdlog::debug("Starting service with thread pool size={}", threadPoolSize);
-		// using a thread pool binder means that every agent's handler will be executed by a thread of the pool
-		m_binder = so_5::disp::thread_pool::make_dispatcher(so_environment(), threadPoolSize).binder();
-		// this "root" cooperation is useful if we want deregister every sub-cooperation at once (this feature is not implemented in this simple demo)
-		m_rootCoop = so_environment().register_coop(so_environment().make_coop(m_binder));
+		return !(m_delivery.peer && message.bridged);
 	}
 
-	// this is simply a so_5::send of all the messages
-	// SObjectizer manages the named "topics" (aka: mailboxes) for us
-	Status Send([[maybe_unused]]ServerContext* context, const SendRequest* request, [[maybe_unused]] SendResponse* response) override
-	{		
-		for (const auto& message : request->messages())
+	// the busy time of this thread and, if the message comes from a publisher, its delivery latency
+	HandlingTimer Measure(const EncodedMessage& message)
+	{
+		const auto publishedAt = message.publishedAt == StatsClock::time_point{} ? std::nullopt : std::optional{ message.publishedAt };
+		return HandlingTimer{ m_stats->threads.Local(), publishedAt };
+	}
+
+	// until so_evt_finish, "Stats" reads the outbound queue of the stream
+	void RegisterForStats()
+	{
+		std::lock_guard lock{ m_stats->subscribersMutex };
+		m_stats->subscribers[m_statsId] = { &m_stream, m_subscriptions.size(), m_patterns.size(), m_groups.size() };
+	}
+
+	// with compression, a published message is compressed once for all the subscribers asking for it (see EncodedMessage::Compressed)
+	const ByteBuffer& FrameOf(const EncodedMessage& message)
+	{
+		if (!m_delivery.compress)
 		{
-			send<std::string>(so_environment().create_mbox(message.topic()), message.content());
-			spdlog::debug("A client dropped a message '{}' to topic '{}'", message.content(), message.topic());
+			return message.frame;
 		}
-		return Status::OK;
+		return message.Compressed([&](const ByteBuffer& frame) {
+			return m_delivery.compress(frame, message.topicId);
+		});
 	}
 
-	// every "Receive" is handled by creating a new "ReceiveAgent" that will reside in its own "cooperation".
-	// The reason why every agent has its own coop_t is to ease deregistration.
-	Status Receive(ServerContext* context, const ReceiveRequest* request, ServerWriter<ReceiveResponse>* writer) override
+	// replayed and retained frames are compressed for every subscriber
+	ByteBuffer FrameOf(TopicId topicId, const ByteBuffer& frame)
 	{
-		spdlog::debug("A client subscribed to topics '{}'", request->topics());
-		// as @eao197 (maintainer of SObjectizer) told me in a private conversation,
-		// keeping a pointer to a registered agent is discouraged (and dangerous).
-		// This is a possible approach to wait until the agent has done.
-		std::promise<Status> completed;
-		introduce_child_coop(m_rootCoop, m_binder, [&](so_5::coop_t& coop) {
-			coop.make_agent<ReceiveAgent>(completed, context, writer, GetChannelsFrom(*request));
-		});
-		return completed.get_future().get();
+		return m_delivery.compress ? m_delivery.compress(frame, topicId) : frame;
 	}
-private:
-	std::vector<so_5::mbox_t> GetChannelsFrom(const ReceiveRequest& request)
+
+	// false if the subscriber has gone
+	bool Dispatch(uint64_t key, const ByteBuffer& frame)
 	{
-		std::vector<so_5::mbox_t> channels(request.topics().size());
-		std::transform(begin(request.topics()), end(request.topics()), begin(channels), [&](const auto& name) {
-			return so_environment().create_mbox(name);
-		});
-		return channels;
+		if (m_delivery.maxBatch > 1)
+		{
+			AddToBatch(frame);
+			return true;
+		}
+		if (m_paced)
+		{
+			m_paced->Push(key, frame);
+			return WritePaced();
+		}
+		return Deliver(key, frame);
 	}
 
-	so_5::coop_handle_t m_rootCoop;
-	so_5::disp_binder_shptr_t m_binder;
-};
+	// one frame every "writeInterval" at most: right away if its turn has come, otherwise when write_paced arrives.
+	// Meanwhile, newer frames replace the pending ones with the same key (see OutboundQueue)
+	bool WritePaced()
+	{
+		const auto now = std::chrono::steady_clock::now();
+		if (m_nextPacedWrite <= now)
+		{
+			if (const auto next = m_paced->PopWithKey())
+			{
+				m_nextPacedWrite = now + m_delivery.writeInterval;
+				if (!Deliver(next->first, next->second))
+				{
+					return false;
+				}
+			}
+		}
+		if (!m_paced->Empty() && !std::exchange(m_pacedArmed, true))
+		{
+			so_5::send_delayed<write_paced>(so_direct_mbox(), m_nextPacedWrite - now);
+		}
+		return true;
+	}
 
-// termination is handled by subscribing to SIGINT and SIGTERM (e.g. CTRL+C)
-// and by using a promise/future for event synchronization (even though, atomic_flag or condition_variable are possible options too).
-std::promise<void> stop;
+	// false if the message has been (or will be) delivered by a replay
+	bool IsLive(TopicId topicId, uint64_t offset)
+	{
+		auto& subscription = m_subscriptions.at(topicId);
+		if (!subscription.nextOffset)
+		{
+			return true;
+		}
+		if (offset < *subscription.nextOffset || subscription.replaying)
+		{
+			return false;
+		}
+		if (offset > *subscription.nextOffset)
+		{
+			// a gap (e.g. concurrent publishers got their messages sent out of order): the log has it all, since messages are logged before being sent
+			StartReplay(topicId);
+			return false;
+		}
+		++*subscription.nextOffset;
+		return true;
+	}
 
-static void TerminateThisProgram(int sig)
-{
-	if (sig == SIGTERM || sig == SIGINT)
+	// the retained values come before the live messages, since the agent is subscribed already. Thus a value retained in the meantime
+	// might be delivered twice (both retained and live), it is never missed
+	void DeliverRetained(const Subscription& subscription)
 	{
-		spdlog::debug("got termination signal");
-		stop.set_value();
+		if (!subscription.retained)
+		{
+			return;
+		}
+		// the keys of retained values are not known here: with conflation by key, they are never conflated
+		const auto key = m_delivery.conflateByKey ? 0 : subscription.topicId;
+		for (const auto& frame : subscription.retained->Get(subscription.topicId))
+		{
+			if (Passes(subscription, frame) && !Dispatch(key, FrameOf(subscription.topicId, frame)))
+			{
+				return;
+			}
+		}
+	}
+
+	// a subscription with a start offset replays the topic log first, chunk by chunk (never more than the room left in the outbound queue),
+	// then it switches to the live messages (see IsLive)
+	void StartReplay(TopicId topicId)
+	{
+		m_subscriptions.at(topicId).replaying = true;
+		so_5::send<replay_chunk>(so_direct_mbox(), topicId);
+	}
+
+	void Replay(TopicId topicId)
+	{
+		const auto it = m_subscriptions.find(topicId);
+		if (it == end(m_subscriptions) || !it->second.replaying)
+		{
+			// unsubscribed in the meantime
+			return;
+		}
+		auto& subscription = it->second;
+		const auto stats = m_stream.QueueStats();
+		const auto room = stats.capacity > stats.depth ? stats.capacity - stats.depth : 0;
+		if (!room)
+		{
+			so_5::send_delayed<replay_chunk>(so_direct_mbox(), ReplayBackoff, topicId);
+			return;
+		}
+
+		std::vector<ByteBuffer> frames;
+		const auto first = subscription.log->Read(*subscription.nextOffset, std::min<size_t>(room, ReplayChunkSize), frames);
+		if (frames.empty())
+		{
+			// caught up, from now on the live messages are delivered
+			subscription.replaying = false;
+			spdlog::debug("A client worker has replayed channel '{}' up to offset {}", subscription.channel->query_name(), *subscription.nextOffset);
+			return;
+		}
+		*subscription.nextOffset = first + frames.size();
+		for (const auto& frame : frames)
+		{
+			if (Passes(subscription, frame) && !Dispatch(subscription.topicId, FrameOf(subscription.topicId, frame)))
+			{
+				return;
+			}
+		}
+		// the next chunk is queued after the messages already waiting for this agent
+		so_5::send<replay_chunk>(so_direct_mbox(), topicId);
+	}
+
+	bool Deliver(uint64_t key, const ByteBuffer& frame)
+	{
+		if (m_acks.window)
+		{
+			return DeliverAcknowledged(key, frame);
+		}
+		return Write(key, frame);
+	}
+
+	bool Write(uint64_t key, const ByteBuffer& frame)
+	{
+		// this does not block: the frame is queued and written by someone else
+		const auto writeSuccessful = m_stream.Write(key, frame);
+		spdlog::debug("A client worker queued {} bytes to subscriber. Success={}", frame.Length(), writeSuccessful);
+		// if we get a write error, the client has possibly gone (or it can't keep up and its overflow policy is "disconnect").
+		// Clearly, other options are possible (retry, just ignore this error, etc).
+		if (!writeSuccessful)
+		{
+			DeactivateThisAgent();
+		}
+		return writeSuccessful;
+	}
+
+	// the frame is written once it fits in the window, then it stays there until it is acknowledged
+	bool DeliverAcknowledged(uint64_t key, const ByteBuffer& frame)
+	{
+		if (!m_acks.window->Push({ key, frame }, DeliveryWindow::Clock::now(), WriteNumbered()))
+		{
+			// the subscriber does not acknowledge fast enough: as any slow consumer, it is given up (its session keeps what has not been acknowledged)
+			spdlog::debug("A client worker gave up a subscriber with {} responses not acknowledged", m_acks.window->InFlight() + m_acks.window->Waiting());
+			DeactivateThisAgent();
+			return false;
+		}
+		ArmRedelivery();
+		return !m_streamGone;
 	}
-}
 
-int main()
-{
-	try
-	{
-		spdlog::set_level(spdlog::level::debug);
-		set_default_logger(spdlog::stdout_color_mt("Message-Broker"));
-
-		std::signal(SIGINT, TerminateThisProgram);
-		std::signal(SIGTERM, TerminateThisProgram);
-
-		// this represents a SObjectizer environment that keeps every SObjectizer resource alive
-		so_5::wrapped_env_t sobj;
-		// every agent in SObjectizer resides in a cooperation
-		auto coop = sobj.environment().make_coop(so_5::disp::active_obj::make_dispatcher(sobj.environment()).binder());
-		auto* agent = coop->make_agent<ServiceImpl>();
-		sobj.environment().register_coop(std::move(coop));
-
-		// for our demo, we use the gRPC reflection plugin
-		reflection::InitProtoReflectionServerBuilderPlugin();
-		// on the same page, we enable the default health check service
-		EnableDefaultHealthCheckService(true);
-		const std::string server_address = "localhost:50051";
-		ServerBuilder builder;
-		builder.AddListeningPort(server_address, InsecureServerCredentials());
-		builder.RegisterService(agent);
-		auto server = builder.BuildAndStart();
-		server->GetHealthCheckService()->SetServingStatus("MessageBroker", true);
-		spdlog::info("Server is listening on {}", server_address);
-
-		// let's wait for termination (CTRL+C or just SIGTERM/SIGINT)
-		stop.get_future().wait();
-		spdlog::debug("Program terminated");
-		// first we turn off SObjectizer (in order to complete any pending requests)
-		sobj.stop_then_join();
-		spdlog::debug("Agents terminated");
-		// finally we shutdown the server and wait for this to complete
-		server->Shutdown();
-		server->Wait();
-		spdlog::debug("Server wait is over");
-	}
-	catch (const std::exception& ex)
-	{
-		spdlog::critical("Unrecoverable error: {}", ex.what());
-		return 1;
-	}
-	spdlog::info("Exiting successfully");
-}
\ No newline at end of file
+	// how the window writes its responses (numbered for this subscriber), once the stream has gone they just stay in the window
+	auto WriteNumbered()
+	{
+		return [this](uint64_t sequence, const std::pair<uint64_t, ByteBuffer>& response) {
+			if (!m_streamGone)
+			{
+				m_streamGone = !Write(response.first, WithSequence(response.second, sequence));
+			}
+		};
+	}
+
+	// a single timer, only while something is in flight
+	void ArmRedelivery()
+	{
+		if (!m_redeliveryArmed && m_acks.window->InFlight())
+		{
+			m_redeliveryArmed = true;
+			so_5::send_delayed<redelivery_check>(so_direct_mbox(), m_acks.timeout);
+		}
+	}
+
+	// batches are written when they are full or when the linger time is over (see flush_batch)
+	void AddToBatch(const ByteBuffer& frame)
+	{
+		m_batch.push_back(frame);
+		if (m_batch.size() >= m_delivery.maxBatch)
+		{
+			FlushBatch();
+		}
+		else if (m_batch.size() == 1)
+		{
+			// the first message of a batch arms the flush. Without linger, flush_batch is queued after the messages already waiting for this agent,
+			// hence the batch gets all of them
+			if (m_delivery.linger.count())
+			{
+				so_5::send_delayed<flush_batch>(so_direct_mbox(), m_delivery.linger, m_batchId);
+			}
+			else
+			{
+				so_5::send<flush_batch>(so_direct_mbox(), m_batchId);
+			}
+		}
+	}
+
+	void FlushBatch()
+	{
+		++m_batchId;
+		const auto frame = EncodeBatch(m_batch);
+		m_batch.clear();
+		Deliver(0, frame); // batches mix topics, they are never conflated
+	}
+
+	void DeactivateThisAgent()
+	{
+		if (m_groups.empty())
+		{
+			Detach();
+		}
+		else
+		{
+			// members of consumer groups first hand back to the groups what they have not delivered
+			LeaveGroups();
+		}
+	}
+
+	// when the client goes away, the messages not delivered (queued to the agent or to the stream) are handed back to the groups (see groups_left)
+	void LeaveGroups()
+	{
+		if (std::exchange(m_leavingGroups, true))
+		{
+			return;
+		}
+		for (const auto& [_, group] : m_groups)
+		{
+			group->Leave(so_direct_mbox()->id());
+		}
+		// the groups won't send anything else: this signal is queued after whatever they have sent
+		so_5::send<groups_left>(so_direct_mbox());
+	}
+
+	void Redeliver(const so_5::message_holder_t<EncodedMessage>& message)
+	{
+		const auto group = std::ranges::find(m_groups, message->topicId, &GroupsByTopic::value_type::first);
+		if (group != end(m_groups))
+		{
+			group->second->Dispatch(message->keyHash, message, SendToGroupMember);
+		}
+	}
+
+	// some boilerplate needed to deactivate this agent, unsubscribe from mboxes, and free associated resources
+	void Detach()
+	{
+		so_deactivate_agent(); // unsubscribe + put in special "inactive" state
+		so_deregister_agent_coop_normally(); // since we have "1 agent = 1 coop", we can directly drop the agent's cooperation to free the associated resources
+		spdlog::debug("A client worker detected a client disconnection...detaching procedures done");
+	}
+
+	void so_evt_start() override
+	{
+		spdlog::debug("Worker on thread {} started", GetCurrentThreadId());
+		RegisterForStats();
+		// this might be called from a gRPC thread, sending a signal is the way to get back to the agent's context
+		m_stream.NotifyDisconnection([mbox = so_direct_mbox()] {
+			so_5::send<client_disconnected>(mbox);
+		});
+		// as for the other subscriptions, patterns are effective only once the agent is ready to handle messages
+		for (const auto& pattern : m_patterns)
+		{
+			m_wildcards->Add(pattern, so_direct_mbox()->id(), so_direct_mbox());
+		}
+		for (const auto& [_, group] : m_groups)
+		{
+			group->Join(so_direct_mbox()->id(), GroupMember{ m_groupMbox, &m_stream, m_inFlight }, SendToGroupMember);
+		}
+		// a resumed session: what has not been acknowledged comes first
+		if (m_acks.window && m_acks.window->InFlight())
+		{
+			spdlog::debug("A client worker resumed session '{}', {} responses not acknowledged", m_acks.session, m_acks.window->InFlight() + m_acks.window->Waiting());
+			m_acks.window->RedeliverAll(DeliveryWindow::Clock::now(), WriteNumbered());
+			ArmRedelivery();
+		}
+		// subscriptions are already in place, thus nothing is missed between the replay and the live messages
+		for (const auto& [topicId, subscription] : m_subscriptions)
+		{
+			if (subscription.nextOffset)
+			{
+				StartReplay(topicId);
+			}
+			DeliverRetained(subscription);
+		}
+	}
+
+	void so_evt_finish() override
+	{
+		for (const auto& [_, subscription] : m_subscriptions)
+		{
+			StopListening(subscription);
+		}
+		for (const auto& pattern : m_patterns)
+		{
+			m_wildcards->Remove(pattern, so_direct_mbox()->id());
+		}
+		// e.g. on shutdown: there is nobody to hand messages back to
+		if (!std::exchange(m_leavingGroups, true))
+		{
+			for (const auto& [_, group] : m_groups)
+			{
+				group->Leave(so_direct_mbox()->id());
+			}
+		}
+		m_interests.Clear();
+		// the next subscriber of the session gets what has not been acknowledged
+		if (m_acks.sessions)
+		{
+			m_acks.sessions->Detach(m_acks.session, DeliveryWindow::Clock::now());
+		}
+		{
+			std::lock_guard lock{ m_stats->subscribersMutex };
+			m_stats->subscribers.erase(m_statsId);
+		}
+		const auto stats = m_stream.QueueStats();
+		spdlog::debug("Worker on thread {} finished. Outbound queue: depth={} max depth={} dropped={} conflated={}", GetCurrentThreadId(), stats.depth, stats.maxDepth, stats.dropped, stats.conflated);
+		m_stream.Close(Status::OK);
+	}
+
+	SubscriberStream& m_stream;
+	std::unordered_map<TopicId, Subscription> m_subscriptions;
+	std::vector<std::string> m_patterns;
+	std::shared_ptr<WildcardSubscriptions> m_wildcards;
+	GroupsByTopic m_groups;
+	so_5::mbox_t m_groupMbox; // the messages of all the consumer groups of the agent (one per topic)
+	std::shared_ptr<std::atomic<size_t>> m_inFlight = std::make_shared<std::atomic<size_t>>(0);
+	bool m_leavingGroups = false;
+	DeliverySettings m_delivery;
+	std::vector<ByteBuffer> m_batch;
+	uint64_t m_batchId = 0;
+	std::optional<OutboundQueue> m_paced; // conflated delivery capped at a rate only
+	std::chrono::steady_clock::time_point m_nextPacedWrite;
+	bool m_pacedArmed = false;
+	AckedDelivery m_acks;
+	SubscriberInterests m_interests; // what federation links subscribe on other brokers for this subscriber
+	bool m_redeliveryArmed = false;
+	bool m_streamGone = false;
+	std::shared_ptr<BrokerStats> m_stats;
+	uint64_t m_statsId = m_stats->NewSubscriberId(); // see SubscriberStats.id
+	size_t m_shard;
+};
+
+/* Sharded dispatch (see DispatchMode::sharded): a relay per shard, running on the shard's thread.
+   Publishers send a message once to every shard with subscribers of its topic, then the relay hands it to the subscribers of its shard:
+   the message crosses threads once per shard (instead of once per subscriber) and subscribers get it from their own thread.
+   Optionally, the relay pins the shard's thread to a core as soon as it starts.
+*/
+class ShardRelay final : public so_5::agent_t
+{
+public:
+	ShardRelay(context_t c, std::shared_ptr<const Topics> topics, std::shared_ptr<BrokerStats> stats, size_t shard, std::optional<size_t> core)
+		: agent_t(std::move(c)), m_topics(std::move(topics)), m_stats(std::move(stats)), m_shard(shard), m_core(core)
+	{
+	}
+private:
+	void so_define_agent() override
+	{
+		so_subscribe_self().event([this](so_5::mhood_t<EncodedMessage> data) {
+			// the relay is part of the utilization of its shard, not of the delivery latency
+			const HandlingTimer timer{ m_stats->threads.Local() };
+			// the topic is there, the publisher has found it
+			so_5::send(m_topics->Find(data->topicId)->channel.shards->mboxes[m_shard], data.make_holder());
+		});
+	}
+
+	void so_evt_start() override
+	{
+		if (m_core)
+		{
+			SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR{ 1 } << (*m_core % (sizeof(DWORD_PTR) * 8)));
+			spdlog::debug("Shard {} pinned to core {} - thread {}", m_shard, *m_core, GetCurrentThreadId());
+		}
+	}
+
+	std::shared_ptr<const Topics> m_topics; // shared since relays might outlive the service on shutdown
+	std::shared_ptr<BrokerStats> m_stats;
+	size_t m_shard;
+	std::optional<size_t> m_core;
+};
+
+/* Partitioned topics (see TopicPartitions): every partition is an ordered lane, fanned out by a thread of its own.
+   Publishers hand a message to the lane of its partition, then the lane sends it to the agents subscribed to the partition, in the order it got them:
+   the fan-out of a hot topic runs on as many threads as its partitions instead of going through a single mbox, and the messages of a key stay in order.
+   Partitions outnumbering the lanes share them. Lightweight subscribers, patterns and consumer groups are still served by the publisher (see Broadcast).
+*/
+class PartitionLane final : public so_5::agent_t
+{
+public:
+	PartitionLane(context_t c, std::shared_ptr<const Topics> topics, std::shared_ptr<BrokerStats> stats, std::vector<so_5::mbox_t> relays)
+		: agent_t(std::move(c)), m_topics(std::move(topics)), m_stats(std::move(stats)), m_relays(std::move(relays))
+	{
+	}
+private:
+	void so_define_agent() override
+	{
+		so_subscribe_self().event([this](so_5::mhood_t<EncodedMessage> data) {
+			const HandlingTimer timer{ m_stats->threads.Local() };
+			// the topic is there, the publisher has found it
+			SendToAgents(m_topics->Find(data->topicId)->channel, data.make_holder(), m_relays);
+		});
+	}
+
+	std::shared_ptr<const Topics> m_topics; // shared since lanes might outlive the service on shutdown
+	std::shared_ptr<BrokerStats> m_stats;
+	std::vector<so_5::mbox_t> m_relays; // sharded dispatch only
+};
+
+// the mboxes of the topics of an in-process subscriber, with their count of in-process subscribers
+using LocalTopics = std::vector<std::pair<so_5::mbox_t, std::shared_ptr<std::atomic<size_t>>>>;
+
+/* An in-process subscriber (see EmbeddedBroker::Subscribe): it gets the messages of its topics as they are, nothing is encoded for it.
+   In-process publishers send to the mbox of the topic, "Send" and the others only while the topic has in-process subscribers (see TopicChannel::localSubscribers).
+*/
+class LocalSubscriber final : public so_5::agent_t
+{
+public:
+	LocalSubscriber(context_t c, LocalTopics topics, LocalHandler handler, std::shared_ptr<LocalHandlerGuard> guard, std::shared_ptr<BrokerStats> stats)
+		: agent_t(std::move(c)), m_topics(std::move(topics)), m_handler(std::move(handler)), m_guard(std::move(guard)), m_stats(std::move(stats))
+	{
+	}
+private:
+	void so_define_agent() override
+	{
+		for (const auto& [mbox, subscribers] : m_topics)
+		{
+			so_subscribe(mbox).event([this](so_5::mhood_t<LocalMessage> data) {
+				const HandlingTimer timer{ m_stats->threads.Local() };
+				std::lock_guard lock{ m_guard->mutex };
+				if (m_guard->active)
+				{
+					m_handler(data->message);
+				}
+			});
+			subscribers->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void so_evt_finish() override
+	{
+		for (const auto& [_, subscribers] : m_topics)
+		{
+			subscribers->fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	LocalTopics m_topics;
+	LocalHandler m_handler;
+	std::shared_ptr<LocalHandlerGuard> m_guard;
+	std::shared_ptr<BrokerStats> m_stats;
+};
+
+/* An implementation of the MessageBroker service based on SObjectizer
+*  Every "Receive" (aka: every client) is handled by a dedicated agent which subscribes to all the topics of interest of that particular request.
+*  gRPC methods are called concurrently on gRPC threads: they share the topics and the tables of the broker, which are thread-safe, and they reach the agents
+*  only by sending them messages. The service is also the core of EmbeddedBroker (see PublishLocal and LocalSubscriber).
+*/
+class ServiceImpl : public MessageBroker::Service, public so_5::agent_t
+{
+public:
+	ServiceImpl(context_t c, const BrokerOptions& options)
+		: agent_t(std::move(c)), m_partitions(options.partitions), m_maxOutboundQueue(options.maxOutboundQueue), m_logSettings(options.log), m_publishAckEvery(options.publishAckEvery), m_publishAckWindow(options.publishAckWindow), m_ackTimeout(options.ackTimeout), m_ackSessions(std::make_shared<DeliverySessions>(options.ackSessionTtl)), m_dictionarySize(options.compressionDictionary), m_brokerId(options.brokerId)
+	{
+		if (options.retainedBudget)
+		{
+			m_retained = std::make_shared<RetainedValues>(options.retainedBudget);
+		}
+		if (options.lightSubscriptions)
+		{
+			m_lightSlots = std::make_shared<LightSlots>();
+		}
+		const auto cores = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+		const auto threads = options.dispatchThreads ? options.dispatchThreads : cores;
+		// this "root" cooperation is useful if we want deregister every sub-cooperation at once (this feature is not implemented in this simple demo)
+		auto rootCoop = so_environment().make_coop();
+		if (options.dispatchMode == DispatchMode::sharded)
+		{
+			spdlog::debug("Starting service with {} shards{}", threads, options.pinThreads ? " pinned to cores" : "");
+			// every shard is a thread of its own, with its relay. Relays are in the root cooperation, thus they outlive every agent
+			for (size_t shard = 0; shard < threads; ++shard)
+			{
+				m_shards.push_back(so_5::disp::one_thread::make_dispatcher(so_environment(), std::format("shard-{}", shard)).binder());
+				const auto core = options.pinThreads ? std::optional<size_t>{ shard % cores } : std::nullopt;
+				m_relays.push_back(rootCoop->make_agent_with_binder<ShardRelay>(m_shards.back(), m_topics, m_stats, shard, core)->so_direct_mbox());
+			}
+			m_shardBalancer = std::make_shared<ShardBalancer>(threads);
+		}
+		else
+		{
+			spdlog::debug("Starting service with thread pool size={}", threads);
+			if (options.pinThreads)
+			{
+				spdlog::warn("Threads are pinned only with sharded dispatch");
+			}
+			// using a thread pool binder means that every agent's handler will be executed by a thread of the pool
+			m_binder = so_5::disp::thread_pool::make_dispatcher(so_environment(), threads).binder();
+		}
+		if (!m_partitions.empty())
+		{
+			const auto lanes = options.partitionLanes ? options.partitionLanes : cores;
+			spdlog::debug("Starting {} partitioned topics on {} lanes", m_partitions.size(), lanes);
+			// as relays, lanes are in the root cooperation
+			for (size_t lane = 0; lane < lanes; ++lane)
+			{
+				const auto binder = so_5::disp::one_thread::make_dispatcher(so_environment(), std::format("lane-{}", lane)).binder();
+				m_lanes.push_back(rootCoop->make_agent_with_binder<PartitionLane>(binder, m_topics, m_stats, m_relays)->so_direct_mbox());
+			}
+		}
+		m_rootCoop = so_environment().register_coop(std::move(rootCoop));
+		// "Receive" is served either by the callback API (the default) or by the synchronous API (see BrokerOptions::receiveMode)
+		if (options.receiveMode == ReceiveMode::callback)
+		{
+			// this is what the generated "ExperimentalWithRawCallbackMethod_Receive" does (responses are raw grpc::ByteBuffer)
+		#ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+			MarkMethodRawCallback(1,
+		#else
+			experimental().MarkMethodRawCallback(1,
+		#endif
+				new internal::CallbackServerStreamingHandler<ByteBuffer, ByteBuffer>([this](CallbackServerContext* context, const ByteBuffer* request) {
+					return CallbackReceive(context, request);
+				}));
+		}
+		else
+		{
+			// this is what the generated "WithSplitStreamingMethod_Receive" does, except that responses are raw grpc::ByteBuffer
+			MarkMethodStreamed(1, new internal::SplitServerStreamingHandler<ReceiveRequest, ByteBuffer>([this](ServerContext* context, ReceiveStream* stream) {
+				return StreamedReceive(context, stream);
+			}));
+		}
+		spdlog::debug("Receive is served by the {} API", options.receiveMode == ReceiveMode::callback ? "callback" : "synchronous");
+		// "Send" is served by the callback API since only that lets requests be allocated on arenas (see ArenaMessageAllocator)
+		// this is what the generated "WithCallbackMethod_Send" and "SetMessageAllocatorFor_Send" do
+		auto* sendHandler = new internal::CallbackUnaryHandler<SendRequest, SendResponse>([this](CallbackServerContext* context, const SendRequest* request, [[maybe_unused]] SendResponse* response) {
+			return CallbackSend(context, request);
+		});
+		sendHandler->SetMessageAllocator(&m_sendArenas);
+	#ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+		MarkMethodCallback(0, sendHandler);
+	#else
+		experimental().MarkMethodCallback(0, sendHandler);
+	#endif
+		// "Publish" is served by the callback API as well: acks are written without holding threads, thus the timer of the windows never blocks
+		// this is what the generated "WithCallbackMethod_Publish" does
+	#ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+		MarkMethodCallback(3,
+	#else
+		experimental().MarkMethodCallback(3,
+	#endif
+			new internal::CallbackBidiHandler<SendRequest, PublishAck>([this](CallbackServerContext* context) {
+				return CallbackPublish(context);
+			}));
+		// "Subscribe" reads commands while writing messages: the callback API does that without holding any threads, thus it is always used
+		// this is what the generated "WithRawCallbackMethod_Subscribe" does, except that requests are deserialized (responses are raw grpc::ByteBuffer)
+	#ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+		MarkMethodRawCallback(4,
+	#else
+		experimental().MarkMethodRawCallback(4,
+	#endif
+			new internal::CallbackBidiHandler<SubscribeRequest, ByteBuffer>([this](CallbackServerContext* context) {
+				return CallbackSubscribe(context);
+			}));
+		if (!m_logSettings.directory.empty())
+		{
+			spdlog::info("Topics are logged to '{}'", m_logSettings.directory.string());
+		}
+		if (!options.federate.empty())
+		{
+			// a link per remote broker republishes here the messages of the topics local subscribers are interested in
+			m_interest = std::make_shared<InterestTable>();
+			for (const auto& address : options.federate)
+			{
+				spdlog::info("Broker '{}' bridges the topics of '{}'", m_brokerId, address);
+				m_links.push_back(std::make_unique<FederationLink>(address, m_brokerId, options.federation, m_interest, [this, address](SendRequest& request) {
+					if (const auto status = SendAll(request, true); !status.ok())
+					{
+						spdlog::warn("Can't republish messages bridged from '{}': {}", address, status.error_message());
+					}
+				}));
+			}
+		}
+	}
+
+	// lightweight subscribers are released here when they go away, never by the stream notifying it (see StartLight)
+	void so_define_agent() override
+	{
+		so_subscribe_self().event([this](so_5::mhood_t<light_disconnected> disconnected) {
+			ReleaseLight(disconnected->ref);
+		});
+	}
+
+	// links republish until they are stopped, thus they are stopped before the agents go away
+	// lightweight subscribers are closed here, as agents close their streams when they finish
+	void so_evt_finish() override
+	{
+		m_links.clear();
+		if (m_lightSlots)
+		{
+			std::vector<SlotRef> refs;
+			m_lightSlots->ForEach([&](SlotRef ref, const LightSubscriber&) {
+				refs.push_back(ref);
+			});
+			for (const auto ref : refs)
+			{
+				ReleaseLight(ref);
+			}
+		}
+	}
+
+	// this is simply a so_5::send of all the messages
+	// SObjectizer manages the named "topics" (aka: mailboxes) for us, the registry saves us from looking them up by name every time
+	// every message is encoded here once and for all, no matter how many subscribers will get it
+	// the request lives on an arena of m_sendArenas, thus it is ours: its messages are completed in place while encoding them (see EncodeReceiveResponse)
+	ServerUnaryReactor* CallbackSend(CallbackServerContext* context, const SendRequest* request)
+	{
+		auto* reactor = context->DefaultReactor();
+		reactor->Finish(SendAll(const_cast<SendRequest&>(*request)));
+		return reactor;
+	}
+
+	// the streaming version of "Send": producers keep the stream open and get cumulative acks (see PublishReactor)
+	ServerBidiReactor<SendRequest, PublishAck>* CallbackPublish([[maybe_unused]] CallbackServerContext* context)
+	{
+		return new PublishReactor([this](SendRequest& request) { return SendAll(request); }, m_publishAckEvery, m_publishAckWindow, m_publishAckTimer);
+	}
+
+	// returns the ids of the topics, 0 for those never sent to nor subscribed (a lookup does not register topics)
+	Status Resolve([[maybe_unused]] ServerContext* context, const ResolveRequest* request, ResolveResponse* response) override
+	{
+		for (const auto& name : request->topics())
+		{
+			const auto* topic = m_topics->Find(name);
+			response->add_topic_ids(topic ? topic->id : 0);
+		}
+		return Status::OK;
+	}
+
+	// the dictionaries learned so far (see TopicDictionary): subscribers asking for compression need them to inflate the messages having "dictionary" set
+	Status Dictionaries([[maybe_unused]] ServerContext* context, const DictionariesRequest* request, DictionariesResponse* response) override
+	{
+		for (const auto id : request->topic_ids())
+		{
+			const auto* topic = m_topics->Find(id);
+			if (!topic)
+			{
+				continue;
+			}
+			if (const auto* data = topic->channel.dictionary->Get())
+			{
+				auto& dictionary = *response->add_dictionaries();
+				dictionary.set_topic_id(id);
+				dictionary.set_id(topic->channel.dictionary->Id());
+				dictionary.set_data(*data);
+			}
+		}
+		return Status::OK;
+	}
+
+	// everything is aggregated here, on read: publishers and agents just bump the counters of their own thread (see PerThread)
+	Status Stats([[maybe_unused]] ServerContext* context, [[maybe_unused]] const StatsRequest* request, StatsResponse* response) override
+	{
+		const auto now = StatsClock::now();
+		std::vector<TopicTotals> totals(m_topics->Size());
+		HistogramSnapshot latency;
+		m_stats->threads.ForEach([&](std::thread::id thread, const ThreadStats& stats) {
+			stats.topics.ForEach([&](TopicId id, uint64_t messages, uint64_t bytes) {
+				if (id > totals.size())
+				{
+					// registered in the meantime
+					totals.resize(id);
+				}
+				totals[id - 1].messages += messages;
+				totals[id - 1].bytes += bytes;
+			});
+			latency.Add(stats.latency);
+			// publishers handle no events, only dispatcher threads do
+			if (const auto events = stats.events.Load())
+			{
+				const auto busy = std::chrono::duration<double>(std::chrono::nanoseconds(stats.busyNanoseconds.Load()));
+				const auto running = std::chrono::duration<double>(now - StatsClock::time_point(StatsClock::duration(stats.firstEvent.load(std::memory_order_relaxed))));
+				std::ostringstream threadId;
+				threadId << thread; // as in the logs
+				auto& dispatcher = *response->add_dispatcher_threads();
+				dispatcher.set_thread_id(threadId.str());
+				dispatcher.set_events(events);
+				dispatcher.set_busy_seconds(busy.count());
+				dispatcher.set_utilization(running.count() > 0 ? std::min<double>(busy / running, 1.0) : 0.0);
+			}
+		});
+
+		{
+			std::lock_guard lock{ m_statsMutex };
+			const auto elapsed = std::chrono::duration<double>(now - m_previousStatsAt).count();
+			m_previousTotals.resize(totals.size());
+			for (size_t i = 0; i < totals.size(); ++i)
+			{
+				const auto* topic = m_topics->Find(static_cast<TopicId>(i + 1));
+				auto& stats = *response->add_topics();
+				stats.set_topic(topic->name);
+				stats.set_topic_id(topic->id);
+				stats.set_messages(totals[i].messages);
+				stats.set_bytes(totals[i].bytes);
+				if (elapsed > 0)
+				{
+					stats.set_messages_per_second(static_cast<double>(totals[i].messages - m_previousTotals[i].messages) / elapsed);
+					stats.set_bytes_per_second(static_cast<double>(totals[i].bytes - m_previousTotals[i].bytes) / elapsed);
+				}
+				stats.set_subscribers(topic->channel.subscribers->load(std::memory_order_relaxed));
+			}
+			m_previousTotals = std::move(totals);
+			m_previousStatsAt = now;
+		}
+
+		{
+			std::lock_guard lock{ m_stats->subscribersMutex };
+			for (const auto& [id, subscriber] : m_stats->subscribers)
+			{
+				const auto queue = subscriber.stream->QueueStats();
+				auto& stats = *response->add_subscribers();
+				stats.set_id(id);
+				stats.set_topics(subscriber.topics);
+				stats.set_patterns(subscriber.patterns);
+				stats.set_groups(subscriber.groups);
+				stats.set_queue_depth(queue.depth);
+				stats.set_queue_capacity(queue.capacity);
+				stats.set_max_queue_depth(queue.maxDepth);
+				stats.set_dropped(queue.dropped);
+				stats.set_conflated(queue.conflated);
+			}
+		}
+		if (m_lightSlots)
+		{
+			m_lightSlots->ForEach([&](SlotRef, const LightSubscriber& subscriber) {
+				const auto queue = subscriber.stream->QueueStats();
+				auto& stats = *response->add_subscribers();
+				stats.set_id(subscriber.id);
+				stats.set_lightweight(true);
+				stats.set_topics(subscriber.topics.size());
+				stats.set_queue_depth(queue.depth);
+				stats.set_queue_capacity(queue.capacity);
+				stats.set_max_queue_depth(queue.maxDepth);
+				stats.set_dropped(queue.dropped);
+				stats.set_conflated(queue.conflated);
+			});
+		}
+
+		auto& histogram = *response->mutable_publish_to_write();
+		histogram.set_count(latency.Count());
+		histogram.set_p50_ns(latency.ValueAt(0.5));
+		histogram.set_p90_ns(latency.ValueAt(0.9));
+		histogram.set_p99_ns(latency.ValueAt(0.99));
+		histogram.set_p999_ns(latency.ValueAt(0.999));
+		histogram.set_max_ns(latency.Max());
+		latency.ForEachBucket([&](uint64_t upTo, uint64_t count) {
+			auto& bucket = *histogram.add_buckets();
+			bucket.set_up_to_ns(upTo);
+			bucket.set_count(count);
+		});
+		return Status::OK;
+	}
+
+	// synchronous "Receive": this gRPC thread is parked until the agent has done.
+	Status StreamedReceive(ServerContext* context, ReceiveStream* writer)
+	{
+		ReceiveRequest request;
+		if (!writer->Read(&request))
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Missing ReceiveRequest" };
+		}
+		if (auto status = Validate(request); !status.ok())
+		{
+			return status;
+		}
+		// as @eao197 (maintainer of SObjectizer) told me in a private conversation,
+		// keeping a pointer to a registered agent is discouraged (and dangerous).
+		// This is a possible approach to wait until the agent has done.
+		SyncSubscriberStream stream{ context, writer, MakeOutboundQueueFor(request) };
+		if (auto status = StartSubscriber(stream, request); !status.ok())
+		{
+			return status;
+		}
+		// this thread writes to the subscriber, until the agent (or the slot) has done
+		return stream.Serve();
+	}
+
+	// callback "Receive": no threads are held, the reactor lives until the agent closes it (and gRPC has done with it).
+	ServerWriteReactor<ByteBuffer>* CallbackReceive([[maybe_unused]] CallbackServerContext* context, const ByteBuffer* rawRequest)
+	{
+		ByteBuffer requestBuffer = *rawRequest; // deserialization consumes the buffer
+		ReceiveRequest request;
+		if (auto status = SerializationTraits<ReceiveRequest>::Deserialize(&requestBuffer, &request); !status.ok() || !(status = Validate(request)).ok())
+		{
+			auto* reactor = new ReceiveReactor(OutboundQueue{ 1, OverflowPolicy::disconnect });
+			reactor->Close(status);
+			return reactor;
+		}
+		auto* reactor = new ReceiveReactor(MakeOutboundQueueFor(request));
+		if (auto status = StartSubscriber(*reactor, request); !status.ok())
+		{
+			reactor->Close(status);
+		}
+		return reactor;
+	}
+
+	// "Subscribe": the first command starts the agent, the others are forwarded to it. Thus, changing topics does not cost a new stream and a new agent,
+	// and no messages are lost in the meantime
+	ServerBidiReactor<SubscribeRequest, ByteBuffer>* CallbackSubscribe([[maybe_unused]] CallbackServerContext* context)
+	{
+		return new SubscribeReactor([this, agent = so_5::mbox_t{}](SubscribeReactor& stream, const SubscribeRequest& command) mutable {
+			if (agent)
+			{
+				// most commands are just acks
+				if (!command.subscribe().empty() || !command.unsubscribe().empty())
+				{
+					so_5::send<ReceiveAgent::change_subscriptions>(agent, GetSubscriptionChangeFrom(command));
+				}
+				if (command.ack())
+				{
+					so_5::send<ReceiveAgent::acknowledge>(agent, command.ack());
+				}
+				return Status::OK;
+			}
+			if (auto status = Validate(command); !status.ok())
+			{
+				return status;
+			}
+			auto queue = MakeOutboundQueueFor(command.delivery());
+			auto acks = MakeAckedDeliveryFor(command.acks(), queue.Stats().capacity);
+			if (!acks)
+			{
+				return Status{ StatusCode::ALREADY_EXISTS, std::format("Session '{}' is in use by another subscriber", command.acks().session()) };
+			}
+			stream.ResetQueue(std::move(queue));
+			agent = StartAgent(stream, command, std::move(*acks));
+			return Status::OK;
+		});
+	}
+
+	// in-process "Send" of one message (see EmbeddedBroker::Publish): when nothing out of process needs it, the message goes as it is
+	// to the in-process subscribers, otherwise it is sent as "Send" does (in-process subscribers get it anyway)
+	Status PublishLocal(Message message)
+	{
+		const Topics::Topic* topic = nullptr;
+		if (auto status = TryRegistering([&] { return ResolveTopic(message, topic); }); !status.ok())
+		{
+			return status;
+		}
+		if (NeedsEncoding(*topic, message))
+		{
+			// to the partition decided here, not to another one
+			message.set_topic(topic->name);
+			message.clear_topic_id();
+			SendRequest request;
+			request.add_messages()->Swap(&message);
+			return SendAll(request);
+		}
+		// completed as subscribers by gRPC would get it (see EncodeReceiveResponse)
+		message.set_topic(topic->name);
+		message.set_topic_id(topic->id);
+		message.clear_offset();
+		message.set_origin(m_brokerId);
+		m_stats->threads.Local().topics.Add(topic->id, message.ByteSizeLong());
+		so_5::send<LocalMessage>(topic->channel.mbox, std::move(message));
+		return Status::OK;
+	}
+
+	// in-process "Receive" of topics by name (see EmbeddedBroker::Subscribe), in a cooperation of its own as "Receive" agents
+	so_5::coop_handle_t SubscribeLocal(const std::vector<std::string>& names, LocalHandler handler, std::shared_ptr<LocalHandlerGuard> guard)
+	{
+		LocalTopics topics;
+		for (const auto& name : names)
+		{
+			if (IsTopicPattern(name))
+			{
+				throw std::invalid_argument("Can't subscribe in process to '" + name + "': patterns are for gRPC subscribers only");
+			}
+			ForEachPartition(m_topics->Intern(name), [&](const Topics::Topic& topic) {
+				if (std::ranges::find(topics, topic.channel.mbox, &LocalTopics::value_type::first) == topics.end())
+				{
+					topics.emplace_back(topic.channel.mbox, topic.channel.localSubscribers);
+				}
+			});
+		}
+		spdlog::debug("An in-process subscriber subscribed to {} topics", topics.size());
+		so_5::coop_handle_t handle;
+		IntroduceAgentCoop([&](so_5::coop_t& coop, [[maybe_unused]] size_t shard) {
+			coop.make_agent<LocalSubscriber>(std::move(topics), std::move(handler), std::move(guard), m_stats);
+			handle = coop.handle();
+		});
+		return handle;
+	}
+private:
+	struct TopicTotals
+	{
+		uint64_t messages = 0;
+		uint64_t bytes = 0;
+	};
+
+	struct light_disconnected { SlotRef ref; };
+
+	// plain subscriptions get a slot, the others an agent
+	Status StartSubscriber(SubscriberStream& stream, const ReceiveRequest& request)
+	{
+		return TryRegistering([&] {
+			if (m_lightSlots && IsLight(request))
+			{
+				return StartLight(stream, request);
+			}
+			StartAgent(stream, request);
+			return Status::OK;
+		});
+	}
+
+	// publishers and subscribers register topics (see TopicRegistry) and consumer groups (see ConsumerGroups) as long as there's room for them,
+	// then their calls fail instead of the broker
+	template<typename Action>
+	static Status TryRegistering(Action action)
+	{
+		try
+		{
+			return action();
+		}
+		catch (const std::length_error& ex)
+		{
+			spdlog::warn("A client can't register more topics or groups: {}", ex.what());
+			return Status{ StatusCode::RESOURCE_EXHAUSTED, ex.what() };
+		}
+	}
+
+	// what a slot can serve: the topics by name, each message as it is, nothing to replay or to pace (federation peers and conflation are fine, see WriteToLightSubscribers)
+	static bool IsLight(const ReceiveRequest& request)
+	{
+		return request.group().empty() && request.start_offsets().empty() && request.max_batch() <= 1 && request.compression() == ReceiveRequest::UNCOMPRESSED && !request.max_rate() && request.filters().empty() && GetPatternsFrom(request).empty();
+	}
+
+	// plain "Receive" subscriptions (topics by name, nothing else), unless BrokerOptions::lightSubscriptions is off
+	// no cooperation, no agent: the subscriber takes a slot and joins the fan-out of its topics, then publishers write to its stream
+	Status StartLight(SubscriberStream& stream, const ReceiveRequest& request)
+	{
+		spdlog::debug("A client subscribed to topics '{}' (lightweight)", request.topics());
+		LightSubscriber light{ &stream, m_stats->NewSubscriberId(), {}, GetInterestsFrom(request, request.topics()), !request.federation_peer().empty(), request.conflation() == ReceiveRequest::BY_TOPIC_AND_KEY };
+		for (const auto& name : request.topics())
+		{
+			ForEachPartition(m_topics->Intern(name), [&](const Topics::Topic& topic) {
+				if (std::ranges::find(light.topics, topic.id, &LightSubscriber::Topic::id) == end(light.topics))
+				{
+					light.topics.push_back({ topic.id, topic.channel.light, topic.channel.subscribers });
+				}
+			});
+		}
+		const auto acquired = m_lightSlots->Acquire(std::move(light));
+		if (!acquired)
+		{
+			spdlog::warn("A client can't subscribe: all the {} lightweight subscriber slots are taken", m_lightSlots->Capacity());
+			return Status{ StatusCode::RESOURCE_EXHAUSTED, "Too many subscribers" };
+		}
+		const auto ref = *acquired;
+		// the stream might notify this under its own lock, thus the slot is released by this agent (taking the lock of the slot there might deadlock with a publisher)
+		stream.NotifyDisconnection([mbox = so_direct_mbox(), ref] {
+			so_5::send<light_disconnected>(mbox, ref);
+		});
+		// publishers wait for the slot meanwhile: the retained values come first, and nothing published in between is missed
+		bool written = true;
+		m_lightSlots->Visit(ref, [&](LightSubscriber& subscriber) {
+			for (const auto& topic : subscriber.topics)
+			{
+				topic.fanout->Add(ref);
+				topic.subscribers->fetch_add(1, std::memory_order_relaxed);
+			}
+			for (const auto& topic : subscriber.topics)
+			{
+				if (!m_retained)
+				{
+					break;
+				}
+				// as for agents (see ReceiveAgent::DeliverRetained), retained values are never conflated by key
+				for (const auto& frame : m_retained->Get(topic.id))
+				{
+					written = written && stream.Write(subscriber.conflateByKey ? 0 : topic.id, frame);
+				}
+			}
+		});
+		if (!written)
+		{
+			ReleaseLight(ref);
+		}
+		return Status::OK;
+	}
+
+	// the first call closes the stream, the others do nothing: the subscriber goes away, it can't keep up, or the service finishes
+	void ReleaseLight(SlotRef ref)
+	{
+		auto subscriber = m_lightSlots->Release(ref);
+		if (!subscriber)
+		{
+			return;
+		}
+		for (const auto& topic : subscriber->topics)
+		{
+			topic.fanout->Remove(ref);
+			topic.subscribers->fetch_sub(1, std::memory_order_relaxed);
+		}
+		subscriber->interests.Clear();
+		const auto stats = subscriber->stream->QueueStats();
+		spdlog::debug("A lightweight subscriber finished. Outbound queue: depth={} max depth={} dropped={} conflated={}", stats.depth, stats.maxDepth, stats.dropped, stats.conflated);
+		subscriber->stream->Close(Status::OK);
+	}
+
+	// every "Receive" is handled by creating a new "ReceiveAgent" that will reside in its own "cooperation".
+	// The reason why every agent has its own coop_t is to ease deregistration.
+	void StartAgent(SubscriberStream& stream, const ReceiveRequest& request)
+	{
+		spdlog::debug("A client subscribed to topics '{}'", request.topics());
+		// topics are registered before the cooperation, which is not introduced if that fails
+		auto patterns = GetPatternsFrom(request);
+		auto groups = GetGroupsFrom(request);
+		auto subscriptions = patterns.empty() && groups.empty() ? GetSubscriptionsFrom(request) : std::vector<Subscription>{};
+		IntroduceAgentCoop([&](so_5::coop_t& coop, size_t shard) {
+			coop.make_agent<ReceiveAgent>(stream, std::move(subscriptions), std::move(patterns), m_wildcards, std::move(groups), GetDeliverySettingsFrom(request), AckedDelivery{}, GetInterestsFrom(request, request.topics()), m_stats, shard);
+		});
+	}
+
+	// the same for "Subscribe", the agent's mbox is where the next commands go to
+	so_5::mbox_t StartAgent(SubscriberStream& stream, const SubscribeRequest& request, AckedDelivery acks)
+	{
+		spdlog::debug("A client opened a subscription stream on topics '{}'", request.subscribe());
+		auto initial = GetSubscriptionChangeFrom(request);
+		so_5::mbox_t agent;
+		IntroduceAgentCoop([&](so_5::coop_t& coop, size_t shard) {
+			agent = coop.make_agent<ReceiveAgent>(stream, std::move(initial.subscribe), std::move(initial.subscribePatterns), m_wildcards, GroupsByTopic{}, GetDeliverySettingsFrom(request.delivery()), std::move(acks), GetInterestsFrom(request.delivery(), request.subscribe()), m_stats, shard)->so_direct_mbox();
+		});
+		return agent;
+	}
+
+	// the agent's coop is bound either to the thread pool or to the least loaded shard, "makeAgent" gets the coop and the shard
+	template<typename MakeAgent>
+	void IntroduceAgentCoop(MakeAgent makeAgent)
+	{
+		if (m_shards.empty())
+		{
+			introduce_child_coop(m_rootCoop, m_binder, [&](so_5::coop_t& coop) {
+				makeAgent(coop, 0);
+			});
+			return;
+		}
+		const auto shard = m_shardBalancer->Acquire();
+		introduce_child_coop(m_rootCoop, m_shards[shard], [&](so_5::coop_t& coop) {
+			coop.add_dereg_notificator([balancer = m_shardBalancer, shard](so_5::environment_t&, const so_5::coop_handle_t&, const so_5::coop_dereg_reason_t&) noexcept {
+				balancer->Release(shard);
+			});
+			makeAgent(coop, shard);
+		});
+	}
+
+	// shared by Send, Publish and federation links ("bridged" messages, which keep their origin), the messages are completed by the broker (see EncodeReceiveResponse)
+	Status SendAll(SendRequest& request, bool bridged = false)
+	{
+		// unknown ids (and topics beyond the capacity of the registry) are rejected before sending anything
+		std::vector<const Topics::Topic*> topics;
+		topics.reserve(request.messages().size());
+		if (auto status = TryRegistering([&] { return ResolveTopics(request, topics); }); !status.ok())
+		{
+			return status;
+		}
+		if (!bridged)
+		{
+			for (auto& message : *request.mutable_messages())
+			{
+				message.set_origin(m_brokerId);
+			}
+		}
+
+		for (auto i = 0; i < request.messages().size(); ++i)
+		{
+			auto& message = *request.mutable_messages(i);
+			const auto& topic = *topics[i];
+			if (topic.channel.log)
+			{
+				// consecutive messages on the same topic are logged as one batch
+				auto last = i + 1;
+				while (last < request.messages().size() && topics[last] == &topic)
+				{
+					++last;
+				}
+				if (const auto status = LogAndSend(topic, *request.mutable_messages(), i, last, bridged); !status.ok())
+				{
+					return status;
+				}
+				i = last - 1;
+			}
+			else
+			{
+				auto frame = EncodeReceiveResponse(message, topic.name, topic.id);
+				Retain(topic, message, frame);
+				Broadcast(topic, message, std::move(frame), 0, bridged);
+				spdlog::debug("A client dropped a message '{}' to topic '{}'", message.content(), topic.name);
+				SendToLocalSubscribers(topic, message);
+			}
+		}
+		return Status::OK;
+	}
+
+	// the topics (or the partitions) of the messages
+	Status ResolveTopics(const SendRequest& request, std::vector<const Topics::Topic*>& topics)
+	{
+		for (const auto& message : request.messages())
+		{
+			const Topics::Topic* topic = nullptr;
+			if (auto status = ResolveTopic(message, topic); !status.ok())
+			{
+				return status;
+			}
+			topics.push_back(topic);
+		}
+		return Status::OK;
+	}
+
+	// the topic (or the partition) a message goes to, registering it if it's new
+	Status ResolveTopic(const Message& message, const Topics::Topic*& topic)
+	{
+		if (!message.topic_id() && IsTopicPattern(message.topic()))
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, std::format("Can't send to '{}': wildcards are for subscriptions only", message.topic()) };
+		}
+		topic = message.topic_id() ? m_topics->Find(message.topic_id()) : &m_topics->Intern(message.topic());
+		if (!topic)
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, std::format("Unknown topic id {} (see Resolve)", message.topic_id()) };
+		}
+		if (topic->channel.partitions)
+		{
+			topic = &PartitionOf(*topic, topic->channel.partitions->PartitionOf(KeyHashOf(message.key())));
+		}
+		return Status::OK;
+	}
+
+	std::vector<Subscription> GetSubscriptionsFrom(const ReceiveRequest& request)
+	{
+		std::vector<Subscription> subscriptions;
+		for (const auto& name : request.topics())
+		{
+			AddSubscriptions(subscriptions, name, request.start_offsets(), request.filters());
+		}
+		return subscriptions;
+	}
+
+	// a partitioned topic is subscribed as all its partitions, each one with the filter of the topic (start offsets are by partition, e.g. orders[2])
+	void AddSubscriptions(std::vector<Subscription>& subscriptions, const std::string& name, const google::protobuf::Map<std::string, uint64_t>& startOffsets, const google::protobuf::Map<std::string, std::string>& filters)
+	{
+		const auto filter = filters.find(name);
+		ForEachPartition(m_topics->Intern(name), [&](const Topics::Topic& topic) {
+			subscriptions.push_back(MakeSubscription(topic, startOffsets, filter != filters.end() ? &filter->second : nullptr));
+		});
+	}
+
+	// the filter has been validated already (see ValidateFilters)
+	Subscription MakeSubscription(const Topics::Topic& topic, const google::protobuf::Map<std::string, uint64_t>& startOffsets, const std::string* filter)
+	{
+		Subscription subscription{ topic.channel.mbox, topic.id, topic.name, topic.channel.log };
+		subscription.shards = topic.channel.shards;
+		subscription.subscribers = topic.channel.subscribers;
+		if (const auto start = startOffsets.find(topic.name); subscription.log && start != startOffsets.end())
+		{
+			subscription.nextOffset = start->second;
+		}
+		else
+		{
+			subscription.retained = m_retained;
+		}
+		if (filter)
+		{
+			subscription.filter = MessageFilter::Compile(*filter);
+			subscription.filters = topic.channel.filters;
+		}
+		return subscription;
+	}
+
+	// a partitioned topic stands for all its partitions, any other topic for itself
+	template<typename Visitor>
+	void ForEachPartition(const Topics::Topic& topic, Visitor visit)
+	{
+		if (!topic.channel.partitions)
+		{
+			visit(topic);
+			return;
+		}
+		for (size_t partition = 0; partition < topic.channel.partitions->Count(); ++partition)
+		{
+			visit(PartitionOf(topic, partition));
+		}
+	}
+
+	const Topics::Topic& PartitionOf(const Topics::Topic& topic, size_t partition)
+	{
+		const auto id = topic.channel.partitions->Get(partition, [&](size_t index) {
+			return m_topics->Intern(PartitionName(topic.name, index)).id;
+		});
+		return *m_topics->Find(id);
+	}
+
+	// on "Subscribe" topics and patterns are kept apart, since the agent delivers once a topic that is subscribed both ways
+	ReceiveAgent::change_subscriptions GetSubscriptionChangeFrom(const SubscribeRequest& request)
+	{
+		ReceiveAgent::change_subscriptions change;
+		for (const auto& name : request.unsubscribe())
+		{
+			if (IsTopicPattern(name))
+			{
+				change.unsubscribePatterns.push_back(name);
+			}
+			else if (const auto* topic = m_topics->Find(name)) // a topic never registered can't be subscribed
+			{
+				ForEachPartition(*topic, [&](const Topics::Topic& partition) {
+					change.unsubscribe.push_back(partition.id);
+				});
+			}
+		}
+		// only the first command can fail the stream (see SubscribeReactor), thus a later one with broken filters subscribes no topics by name
+		const auto filtersValid = ValidateFilters(request.filters()).ok();
+		for (const auto& name : request.subscribe())
+		{
+			if (IsTopicPattern(name))
+			{
+				if (const auto status = ValidatePattern(name); !status.ok())
+				{
+					spdlog::warn("A subscriber asked for pattern '{}', the pattern is not subscribed: {}", name, status.error_message());
+					continue;
+				}
+				change.subscribePatterns.push_back(name);
+			}
+			else if (!filtersValid)
+			{
+				spdlog::warn("A subscriber asked for topic '{}' with invalid filters, the topic is not subscribed", name);
+			}
+			else if (const auto status = TryRegistering([&] { AddSubscriptions(change.subscribe, name, request.start_offsets(), request.filters()); return Status::OK; }); !status.ok())
+			{
+				spdlog::warn("A subscriber asked for topic '{}', the topic is not subscribed: {}", name, status.error_message());
+			}
+		}
+		return change;
+	}
+
+	// if any of the topics is a pattern, all the topics are handled as patterns (so that every message is delivered once)
+	static std::vector<std::string> GetPatternsFrom(const ReceiveRequest& request)
+	{
+		if (std::ranges::none_of(request.topics(), [](const auto& topic) { return IsTopicPattern(topic); }))
+		{
+			return {};
+		}
+		return { begin(request.topics()), end(request.topics()) };
+	}
+
+	GroupsByTopic GetGroupsFrom(const ReceiveRequest& request)
+	{
+		GroupsByTopic groups;
+		if (request.group().empty())
+		{
+			return groups;
+		}
+		const auto balancing = request.group_balancing() == ReceiveRequest::LEAST_OUTSTANDING ? GroupBalancing::least_outstanding : GroupBalancing::round_robin;
+		for (const auto& name : request.topics())
+		{
+			// messages are kept for groups without members (for a while, see ConsumerGroups), as many as a subscriber's outbound queue can hold
+			ForEachPartition(m_topics->Intern(name), [&](const Topics::Topic& topic) {
+				groups.emplace_back(topic.id, topic.channel.groups->Get(request.group(), balancing, m_maxOutboundQueue));
+			});
+		}
+		return groups;
+	}
+
+	// what can't be asked together
+	static Status Validate(const ReceiveRequest& request)
+	{
+		if (auto status = ValidatePatterns(request.topics()); !status.ok())
+		{
+			return status;
+		}
+		if (auto status = ValidateConflation(request); !status.ok())
+		{
+			return status;
+		}
+		if (auto status = ValidateFilters(request.filters()); !status.ok())
+		{
+			return status;
+		}
+		if (!request.filters().empty() && !GetPatternsFrom(request).empty())
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Filters do not support topic patterns" };
+		}
+		if (request.group().empty())
+		{
+			return Status::OK;
+		}
+		if (!request.federation_peer().empty())
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Consumer groups do not support federation peers" };
+		}
+		if (!GetPatternsFrom(request).empty())
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Consumer groups do not support topic patterns" };
+		}
+		if (request.max_batch() > 1 || !request.start_offsets().empty())
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Consumer groups do not support batched delivery and start offsets" };
+		}
+		if (request.compression() != ReceiveRequest::UNCOMPRESSED)
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Consumer groups do not support compressed delivery" };
+		}
+		if (request.conflation() != ReceiveRequest::NO_CONFLATION)
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Consumer groups do not support conflated delivery" };
+		}
+		if (!request.filters().empty())
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Consumer groups do not support filters" };
+		}
+		return Status::OK;
+	}
+
+	// matching is cheap whatever the pattern (see TopicTrie), still a pattern as deep as a topic ever gets is enough
+	static Status ValidatePattern(const std::string& pattern)
+	{
+		if (IsTopicPattern(pattern) && SegmentCountOf(pattern) > MaxPatternSegments)
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, std::format("Pattern '{}' has more than {} segments", pattern, MaxPatternSegments) };
+		}
+		return Status::OK;
+	}
+
+	static Status ValidatePatterns(const google::protobuf::RepeatedPtrField<std::string>& topics)
+	{
+		for (const auto& topic : topics)
+		{
+			if (auto status = ValidatePattern(topic); !status.ok())
+			{
+				return status;
+			}
+		}
+		return Status::OK;
+	}
+
+	// filters are compiled here to tell the subscriber what is wrong with them, then once more per subscription (see MakeSubscription)
+	static Status ValidateFilters(const google::protobuf::Map<std::string, std::string>& filters)
+	{
+		for (const auto& [topic, expression] : filters)
+		{
+			if (IsTopicPattern(topic))
+			{
+				return Status{ StatusCode::INVALID_ARGUMENT, std::format("Can't filter '{}': filters are for topics by name only", topic) };
+			}
+			try
+			{
+				MessageFilter::Compile(expression);
+			}
+			catch (const std::invalid_argument& ex)
+			{
+				return Status{ StatusCode::INVALID_ARGUMENT, std::format("Invalid filter for topic '{}': {}", topic, ex.what()) };
+			}
+		}
+		return Status::OK;
+	}
+
+	// batches mix topics and keys, thus they can't be conflated
+	static Status ValidateConflation(const ReceiveRequest& request)
+	{
+		if (request.conflation() == ReceiveRequest::NO_CONFLATION)
+		{
+			return request.max_rate() ? Status{ StatusCode::INVALID_ARGUMENT, "max_rate is for conflated delivery only" } : Status::OK;
+		}
+		if (request.max_batch() > 1)
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Conflated delivery does not support batched delivery" };
+		}
+		return Status::OK;
+	}
+
+	static Status Validate(const SubscribeRequest& request)
+	{
+		const auto& delivery = request.delivery();
+		if (!delivery.topics().empty() || !delivery.start_offsets().empty() || !delivery.filters().empty())
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Topics, start offsets and filters go to SubscribeRequest, not to its delivery settings" };
+		}
+		if (auto status = ValidatePatterns(request.subscribe()); !status.ok())
+		{
+			return status;
+		}
+		if (auto status = ValidateFilters(request.filters()); !status.ok())
+		{
+			return status;
+		}
+		if (!delivery.group().empty())
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Subscribe does not support consumer groups" };
+		}
+		// every acknowledged response must be delivered, while conflation drops them
+		if (delivery.conflation() != ReceiveRequest::NO_CONFLATION && request.acks().window())
+		{
+			return Status{ StatusCode::INVALID_ARGUMENT, "Acknowledged delivery does not support conflation" };
+		}
+		return ValidateConflation(delivery);
+	}
+
+	// the message instance is shared by the subscribers of the topic, by those whose patterns match the topic and by the consumer groups
+	// the delivery latency (see Stats) starts here, thus logging is not part of it
+	// the filters of the topic are evaluated here, on the decoded message, once for all the subscribers sharing each of them
+	void Broadcast(const Topics::Topic& topic, const Message& decoded, ByteBuffer frame, uint64_t offset, bool bridged)
+	{
+		m_stats->threads.Local().topics.Add(topic.id, frame.Length());
+		const auto keyHash = KeyHashOf(decoded.key());
+		const auto message = so_5::message_holder_t<EncodedMessage>::make(std::move(frame), topic.id, offset, keyHash, StatsClock::now(), bridged, topic.channel.filters->Evaluate(decoded));
+		WriteToLightSubscribers(topic, *message);
+		if (topic.channel.lane)
+		{
+			// the lane of the partition does the fan-out, in order (see PartitionLane)
+			so_5::send(m_lanes[*topic.channel.lane], message);
+		}
+		else
+		{
+			SendToAgents(topic.channel, message, m_relays);
+		}
+		m_wildcards->Match(topic.name, [&](const so_5::mbox_t& subscriber) {
+			so_5::send(subscriber, message);
+		});
+		topic.channel.groups->Dispatch(keyHash, message, SendToGroupMember);
+	}
+
+	// right here, on the publisher's thread: writing to a stream never blocks (see SubscriberStream), it just queues the frame
+	// the delivery latency is recorded once per message, when the last subscriber has got it
+	void WriteToLightSubscribers(const Topics::Topic& topic, const EncodedMessage& message)
+	{
+		const auto subscribers = topic.channel.light->Get();
+		if (!subscribers)
+		{
+			return;
+		}
+		for (const auto ref : *subscribers)
+		{
+			bool written = true;
+			m_lightSlots->Visit(ref, [&](const LightSubscriber& subscriber) {
+				if (!(subscriber.peer && message.bridged))
+				{
+					written = subscriber.stream->Write(ConflationKeyOf(topic.id, message.keyHash, subscriber.conflateByKey), message.frame);
+				}
+			});
+			if (!written)
+			{
+				ReleaseLight(ref);
+			}
+		}
+		m_stats->threads.Local().latency.Record(StatsClock::now() - message.publishedAt);
+	}
+
+	// before broadcasting, so that subscribers coming in the meantime get the value at least once (see ReceiveAgent::DeliverRetained)
+	void Retain(const Topics::Topic& topic, const Message& message, const ByteBuffer& frame)
+	{
+		if (!message.retain() || !m_retained)
+		{
+			return;
+		}
+		if (message.content().empty())
+		{
+			m_retained->Erase(topic.id, KeyHashOf(message.key()));
+		}
+		else
+		{
+			// the frame is shared with the subscribers, not copied
+			m_retained->Put(topic.id, KeyHashOf(message.key()), frame, frame.Length());
+		}
+	}
+
+	// messages [first, last) are logged and then sent, so that subscribers never get a message that is not in the log yet
+	Status LogAndSend(const Topics::Topic& topic, google::protobuf::RepeatedPtrField<Message>& messages, int first, int last, bool bridged)
+	{
+		std::vector<ByteBuffer> frames;
+		uint64_t firstOffset = 0;
+		try
+		{
+			firstOffset = topic.channel.log->Append(last - first, [&](size_t index, uint64_t offset) {
+				return EncodeReceiveResponse(messages[first + static_cast<int>(index)], topic.name, topic.id, offset);
+			}, frames);
+		}
+		catch (const std::exception& ex)
+		{
+			spdlog::error("Can't log to topic '{}': {}", topic.name, ex.what());
+			return Status{ StatusCode::INTERNAL, std::format("Can't log to topic '{}'", topic.name) };
+		}
+		for (size_t i = 0; i < frames.size(); ++i)
+		{
+			Retain(topic, messages[first + static_cast<int>(i)], frames[i]);
+			Broadcast(topic, messages[first + static_cast<int>(i)], frames[i], firstOffset + i, bridged);
+			spdlog::debug("A client dropped a message '{}' to topic '{}' (offset {})", messages[first + static_cast<int>(i)].content(), topic.name, firstOffset + i);
+			SendToLocalSubscribers(topic, messages[first + static_cast<int>(i)]);
+		}
+		return Status::OK;
+	}
+
+	// anything out of process or outliving the message needs it encoded: subscribers by gRPC (patterns and groups included), logs and retained values
+	bool NeedsEncoding(const Topics::Topic& topic, const Message& message) const
+	{
+		return topic.channel.log || (message.retain() && m_retained) || topic.channel.subscribers->load(std::memory_order_relaxed) || topic.channel.groups->Size() || m_wildcards->Size();
+	}
+
+	// after broadcasting, the message is not needed anymore (it has been completed while encoding it, see EncodeReceiveResponse) thus it is moved
+	static void SendToLocalSubscribers(const Topics::Topic& topic, Message& message)
+	{
+		if (topic.channel.localSubscribers->load(std::memory_order_relaxed))
+		{
+			so_5::send<LocalMessage>(topic.channel.mbox, std::move(message));
+		}
+	}
+
+	TopicChannel MakeChannel(const std::string& name)
+	{
+		TopicChannel channel{ so_environment().create_mbox(name), nullptr, std::make_shared<TopicGroups>() };
+		channel.dictionary = std::make_shared<TopicDictionary>(m_dictionarySize);
+		if (const auto partitions = m_partitions.find(name); partitions != m_partitions.end())
+		{
+			// messages go to the partitions, thus the topic itself needs neither shards nor a log
+			channel.partitions = std::make_shared<TopicPartitions>(partitions->second);
+			return channel;
+		}
+		if (const auto partition = SplitPartitionName(name))
+		{
+			// the partitions of a topic are spread over the lanes, starting from a lane of its own
+			if (const auto partitions = m_partitions.find(partition->first); partitions != m_partitions.end() && partition->second < partitions->second)
+			{
+				channel.lane = (std::hash<std::string_view>{}(partition->first) + partition->second) % m_lanes.size();
+			}
+		}
+		if (!m_relays.empty())
+		{
+			channel.shards = std::make_shared<TopicShards>();
+			channel.shards->subscribers = std::vector<std::atomic<size_t>>(m_relays.size());
+			for (size_t shard = 0; shard < m_relays.size(); ++shard)
+			{
+				channel.shards->mboxes.push_back(so_environment().create_mbox());
+			}
+		}
+		if (!m_logSettings.directory.empty())
+		{
+			channel.log = std::make_shared<TopicLog>(TopicLog::DirectoryFor(m_logSettings.directory, name), m_logSettings);
+		}
+		return channel;
+	}
+
+	// nothing if the session is in use by another subscriber. The window is never bigger than the outbound queue, the responses waiting for room
+	// in the window are as many as the outbound queue can hold (then the subscriber is given up)
+	std::optional<AckedDelivery> MakeAckedDeliveryFor(const AckSettings& settings, size_t queueCapacity)
+	{
+		if (!settings.window())
+		{
+			return AckedDelivery{};
+		}
+		auto window = m_ackSessions->Attach(settings.session(), std::min<size_t>(settings.window(), queueCapacity), queueCapacity, DeliveryWindow::Clock::now());
+		if (!window)
+		{
+			return std::nullopt;
+		}
+		const auto timeout = settings.timeout_ms() ? std::chrono::milliseconds(settings.timeout_ms()) : m_ackTimeout;
+		return AckedDelivery{ std::move(window), timeout, settings.session(), m_ackSessions };
+	}
+
+	DeliverySettings GetDeliverySettingsFrom(const ReceiveRequest& request) const
+	{
+		DeliverySettings settings{ std::max<size_t>(request.max_batch(), 1), std::chrono::microseconds(request.linger_us()) };
+		settings.peer = !request.federation_peer().empty();
+		settings.conflateByKey = request.conflation() == ReceiveRequest::BY_TOPIC_AND_KEY;
+		if (request.max_rate())
+		{
+			settings.writeInterval = std::chrono::nanoseconds(std::chrono::seconds(1)) / request.max_rate();
+		}
+		if (request.compression() == ReceiveRequest::DEFLATE)
+		{
+			// topics are never removed, thus every topic delivered to the agent is there
+			settings.compress = [topics = m_topics](const ByteBuffer& frame, TopicId id) {
+				return DeflateFrame(frame, *topics->Find(id)->channel.dictionary);
+			};
+		}
+		return settings;
+	}
+
+	// topics and patterns alike (the same name counts once), peers and brokers without federation links have no interests
+	SubscriberInterests GetInterestsFrom(const ReceiveRequest& delivery, const google::protobuf::RepeatedPtrField<std::string>& topics) const
+	{
+		SubscriberInterests interests{ delivery.federation_peer().empty() ? m_interest : nullptr };
+		for (const auto& topic : topics)
+		{
+			interests.Add(topic);
+		}
+		return interests;
+	}
+
+	OutboundQueue MakeOutboundQueueFor(const ReceiveRequest& request) const
+	{
+		const auto capacity = request.max_queue() ? std::min<size_t>(request.max_queue(), m_maxOutboundQueue) : m_maxOutboundQueue;
+		const auto conflating = request.conflation() != ReceiveRequest::NO_CONFLATION;
+		switch (request.overflow_policy())
+		{
+		case ReceiveRequest::DROP_NEWEST:
+			return { capacity, OverflowPolicy::drop_newest, conflating };
+		case ReceiveRequest::CONFLATE:
+			return { capacity, OverflowPolicy::conflate, conflating };
+		case ReceiveRequest::DISCONNECT:
+			return { capacity, OverflowPolicy::disconnect, conflating };
+		default:
+			return { capacity, OverflowPolicy::drop_oldest, conflating };
+		}
+	}
+
+	so_5::coop_handle_t m_rootCoop;
+	so_5::disp_binder_shptr_t m_binder; // thread pool dispatch
+	std::vector<so_5::disp_binder_shptr_t> m_shards; // sharded dispatch, with their relays
+	std::vector<so_5::mbox_t> m_relays;
+	std::shared_ptr<ShardBalancer> m_shardBalancer;
+	std::map<std::string, size_t, std::less<>> m_partitions; // the partitioned topics, by name
+	std::vector<so_5::mbox_t> m_lanes; // of the partitions (see PartitionLane)
+	size_t m_maxOutboundQueue;
+	TopicLogSettings m_logSettings;
+	uint64_t m_publishAckEvery;
+	std::chrono::milliseconds m_publishAckWindow;
+	AckWindowTimer m_publishAckTimer; // a single thread for the windows of all the Publish streams
+	std::chrono::milliseconds m_ackTimeout;
+	std::shared_ptr<DeliverySessions> m_ackSessions; // shared since agents might outlive the service on shutdown
+	std::shared_ptr<RetainedValues> m_retained; // null if retained values are off
+	ArenaMessageAllocator<SendRequest, SendResponse> m_sendArenas;
+	size_t m_dictionarySize;
+	std::string m_brokerId;
+	std::shared_ptr<InterestTable> m_interest; // null without federation links
+	std::shared_ptr<LightSlots> m_lightSlots; // null if light subscriptions are off
+	std::shared_ptr<BrokerStats> m_stats = std::make_shared<BrokerStats>(); // shared since agents might outlive the service on shutdown
+	std::mutex m_statsMutex; // "Stats" might be called concurrently, rates are computed since the previous call
+	std::vector<TopicTotals> m_previousTotals;
+	StatsClock::time_point m_previousStatsAt = StatsClock::now();
+	std::shared_ptr<Topics> m_topics = std::make_shared<Topics>([this](const std::string& name) { return MakeChannel(name); });
+	std::shared_ptr<WildcardSubscriptions> m_wildcards = std::make_shared<WildcardSubscriptions>(); // e.g. prices.eu.* or prices.#
+	std::vector<std::unique_ptr<FederationLink>> m_links; // last, thus stopped before anything they use goes away
+};
+
+EmbeddedBroker::EmbeddedBroker(const BrokerOptions& options)
+{
+	// every agent in SObjectizer resides in a cooperation
+	auto coop = m_env.environment().make_coop(so_5::disp::active_obj::make_dispatcher(m_env.environment()).binder());
+	m_service = coop->make_agent<ServiceImpl>(options);
+	m_env.environment().register_coop(std::move(coop));
+}
+
+EmbeddedBroker::~EmbeddedBroker()
+{
+	Stop();
+}
+
+MessageBroker::Service& EmbeddedBroker::Service()
+{
+	return *m_service;
+}
+
+so_5::environment_t& EmbeddedBroker::Environment()
+{
+	return m_env.environment();
+}
+
+Status EmbeddedBroker::Publish(Message message)
+{
+	return m_service->PublishLocal(std::move(message));
+}
+
+EmbeddedSubscription EmbeddedBroker::Subscribe(const std::vector<std::string>& topics, LocalHandler handler)
+{
+	auto guard = std::make_shared<LocalHandlerGuard>();
+	return { m_env.environment(), m_service->SubscribeLocal(topics, std::move(handler), guard), guard };
+}
+
+void EmbeddedBroker::Stop()
+{
+	if (!std::exchange(m_stopped, true))
+	{
+		m_env.stop_then_join();
+	}
+}
@@ -0,0 +1,511 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../generated/broker.pb.h"
+
+/* A subscriber's filter on the messages of a topic (see ReceiveRequest.filters), compiled once when subscribing.
+   The grammar is tiny:
+     filter     := and ("or" and)*
+     and        := unary ("and" unary)*
+     unary      := "not" unary | "(" filter ")" | comparison
+     comparison := field ("=" | "!=" | "^=") string     -- "^=" is "starts with"
+     field      := "key" | "content" | "headers." name  -- a missing header is an empty string
+     string     := "..." or '...', with \ escaping the next character
+   e.g. key ^= "EU." and (headers.venue = "XETR" or not headers.kind = "quote")
+   The expression is compiled into a flat postfix program, evaluated with a stack of bits: no allocations and no recursion per message.
+   Expressions are also normalized (see Canonical), thus the same filter written in different ways is recognized as one (see TopicFilters).
+*/
+class MessageFilter
+{
+public:
+	// the evaluation stack is a 64-bit word
+	static constexpr size_t MaxDepth = 64;
+	// every distinct filter costs every publisher of the topic on every message, thus filters are kept small
+	static constexpr size_t MaxLength = 4096;
+	static constexpr size_t MaxInstructions = 256; // comparisons and operators
+
+	// throws std::invalid_argument telling what is wrong and where
+	static std::shared_ptr<const MessageFilter> Compile(std::string_view expression)
+	{
+		if (expression.size() > MaxLength)
+		{
+			throw std::invalid_argument("Filter too long: " + std::to_string(expression.size()) + " characters, " + std::to_string(MaxLength) + " at most");
+		}
+		auto filter = std::make_shared<MessageFilter>(Private{});
+		Parser parser{ expression, *filter };
+		parser.Parse();
+		if (filter->m_maxDepth > MaxDepth)
+		{
+			throw std::invalid_argument("Filter too complex: '" + std::string(expression) + "'");
+		}
+		return filter;
+	}
+
+	[[nodiscard]] bool Matches(const Message& message) const
+	{
+		uint64_t stack = 0;
+		size_t depth = 0;
+		for (const auto& instruction : m_program)
+		{
+			bool value = false;
+			switch (instruction.op)
+			{
+			case Op::equal:
+				value = FieldOf(instruction, message) == instruction.operand;
+				break;
+			case Op::not_equal:
+				value = FieldOf(instruction, message) != instruction.operand;
+				break;
+			case Op::starts_with:
+				value = FieldOf(instruction, message).starts_with(instruction.operand);
+				break;
+			case Op::logical_not:
+				stack ^= uint64_t{ 1 } << (depth - 1);
+				continue;
+			case Op::logical_and:
+			case Op::logical_or:
+			{
+				const auto right = (stack >> --depth) & 1;
+				const auto left = (stack >> (depth - 1)) & 1;
+				value = instruction.op == Op::logical_and ? (left && right) : (left || right);
+				--depth;
+				break;
+			}
+			}
+			stack = (stack & ~(uint64_t{ 1 } << depth)) | (uint64_t{ value } << depth);
+			++depth;
+		}
+		return stack & 1;
+	}
+
+	// the same filter, however it was written, has the same canonical form
+	[[nodiscard]] const std::string& Canonical() const
+	{
+		return m_canonical;
+	}
+
+	struct Private {};
+	explicit MessageFilter(Private)
+	{
+	}
+private:
+	enum class Field { key, content, header };
+	enum class Op { equal, not_equal, starts_with, logical_not, logical_and, logical_or };
+
+	struct Instruction
+	{
+		Op op = Op::equal;
+		Field field = Field::key;
+		std::string header; // Field::header only
+		std::string operand;
+	};
+
+	static std::string_view FieldOf(const Instruction& instruction, const Message& message)
+	{
+		switch (instruction.field)
+		{
+		case Field::key:
+			return message.key();
+		case Field::content:
+			return message.content();
+		case Field::header:
+			if (const auto it = message.headers().find(instruction.header); it != message.headers().end())
+			{
+				return it->second;
+			}
+			return {};
+		}
+		return {};
+	}
+
+	void Emit(Instruction instruction)
+	{
+		if (m_program.size() == MaxInstructions)
+		{
+			throw std::invalid_argument("Filter too complex: more than " + std::to_string(MaxInstructions) + " comparisons and operators");
+		}
+		switch (instruction.op)
+		{
+		case Op::logical_not:
+			break;
+		case Op::logical_and:
+		case Op::logical_or:
+			--m_depth;
+			break;
+		default:
+			m_maxDepth = std::max<size_t>(m_maxDepth, ++m_depth);
+			break;
+		}
+		m_program.push_back(std::move(instruction));
+	}
+
+	void Emit(Op op)
+	{
+		Instruction instruction;
+		instruction.op = op;
+		Emit(std::move(instruction));
+	}
+
+	// recursive descent, emitting the program as it goes. Every rule appends its canonical form to the one of the filter:
+	// a chain of "or" (or "and") is enclosed in parentheses once, e.g. a or b or c is (a or b or c)
+	class Parser
+	{
+	public:
+		Parser(std::string_view text, MessageFilter& filter)
+			: m_text(text), m_filter(filter), m_canonical(filter.m_canonical)
+		{
+		}
+
+		void Parse()
+		{
+			m_canonical.reserve(m_text.size());
+			ParseOr();
+			SkipSpaces();
+			if (m_position != m_text.size())
+			{
+				Fail("unexpected text");
+			}
+		}
+	private:
+		void ParseOr()
+		{
+			const auto start = m_canonical.size();
+			ParseAnd();
+			auto chained = false;
+			while (AcceptWord("or"))
+			{
+				OpenChain(start, chained);
+				m_canonical += " or ";
+				ParseAnd();
+				m_filter.Emit(Op::logical_or);
+			}
+			CloseChain(chained);
+		}
+
+		void ParseAnd()
+		{
+			const auto start = m_canonical.size();
+			ParseUnary();
+			auto chained = false;
+			while (AcceptWord("and"))
+			{
+				OpenChain(start, chained);
+				m_canonical += " and ";
+				ParseUnary();
+				m_filter.Emit(Op::logical_and);
+			}
+			CloseChain(chained);
+		}
+
+		// only the first operand of the chain is after "start", thus inserting costs as much as appending it once more
+		void OpenChain(size_t start, bool& chained)
+		{
+			if (!std::exchange(chained, true))
+			{
+				m_canonical.insert(start, 1, '(');
+			}
+		}
+
+		void CloseChain(bool chained)
+		{
+			if (chained)
+			{
+				m_canonical += ')';
+			}
+		}
+
+		void ParseUnary()
+		{
+			if (AcceptWord("not"))
+			{
+				Nest();
+				m_canonical += "not ";
+				ParseUnary();
+				m_filter.Emit(Op::logical_not);
+				--m_nesting;
+				return;
+			}
+			if (Accept("("))
+			{
+				Nest();
+				ParseOr();
+				if (!Accept(")"))
+				{
+					Fail("')' expected");
+				}
+				--m_nesting;
+				return;
+			}
+			ParseComparison();
+		}
+
+		// "not" and "(" recurse: a filter nested deeper than the evaluation stack is refused while parsing, before running out of the thread's stack
+		void Nest()
+		{
+			if (++m_nesting > MaxDepth)
+			{
+				Fail("too deeply nested");
+			}
+		}
+
+		void ParseComparison()
+		{
+			Instruction instruction;
+			if (AcceptWord("key"))
+			{
+				instruction.field = Field::key;
+				m_canonical += "key";
+			}
+			else if (AcceptWord("content"))
+			{
+				instruction.field = Field::content;
+				m_canonical += "content";
+			}
+			else if (Accept("headers."))
+			{
+				instruction.field = Field::header;
+				instruction.header = Name();
+				m_canonical += "headers.";
+				m_canonical += instruction.header;
+			}
+			else
+			{
+				Fail("'key', 'content' or 'headers.NAME' expected");
+			}
+			if (Accept("!="))
+			{
+				instruction.op = Op::not_equal;
+				m_canonical += " != ";
+			}
+			else if (Accept("^="))
+			{
+				instruction.op = Op::starts_with;
+				m_canonical += " ^= ";
+			}
+			else if (Accept("="))
+			{
+				m_canonical += " = ";
+			}
+			else
+			{
+				Fail("'=', '!=' or '^=' expected");
+			}
+			instruction.operand = String();
+			AppendQuoted(instruction.operand);
+			m_filter.Emit(std::move(instruction));
+		}
+
+		std::string Name()
+		{
+			const auto start = m_position;
+			while (m_position < m_text.size() && (std::isalnum(static_cast<unsigned char>(m_text[m_position])) || m_text[m_position] == '_' || m_text[m_position] == '-'))
+			{
+				++m_position;
+			}
+			if (start == m_position)
+			{
+				Fail("header name expected");
+			}
+			return std::string(m_text.substr(start, m_position - start));
+		}
+
+		std::string String()
+		{
+			SkipSpaces();
+			if (m_position == m_text.size() || (m_text[m_position] != '"' && m_text[m_position] != '\''))
+			{
+				Fail("string expected");
+			}
+			const auto quote = m_text[m_position++];
+			std::string value;
+			while (m_position < m_text.size() && m_text[m_position] != quote)
+			{
+				if (m_text[m_position] == '\\' && m_position + 1 < m_text.size())
+				{
+					++m_position;
+				}
+				value += m_text[m_position++];
+			}
+			if (m_position == m_text.size())
+			{
+				Fail("unterminated string");
+			}
+			++m_position;
+			return value;
+		}
+
+		void AppendQuoted(const std::string& value)
+		{
+			m_canonical += '"';
+			for (const auto c : value)
+			{
+				if (c == '"' || c == '\\')
+				{
+					m_canonical += '\\';
+				}
+				m_canonical += c;
+			}
+			m_canonical += '"';
+		}
+
+		bool Accept(std::string_view token)
+		{
+			SkipSpaces();
+			if (!m_text.substr(m_position).starts_with(token))
+			{
+				return false;
+			}
+			m_position += token.size();
+			return true;
+		}
+
+		// a keyword, not the beginning of a longer name
+		bool AcceptWord(std::string_view word)
+		{
+			SkipSpaces();
+			const auto end = m_position + word.size();
+			if (!m_text.substr(m_position).starts_with(word) || (end < m_text.size() && (std::isalnum(static_cast<unsigned char>(m_text[end])) || m_text[end] == '_')))
+			{
+				return false;
+			}
+			m_position = end;
+			return true;
+		}
+
+		void SkipSpaces()
+		{
+			while (m_position < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_position])))
+			{
+				++m_position;
+			}
+		}
+
+		[[noreturn]] void Fail(std::string_view what) const
+		{
+			throw std::invalid_argument("Invalid filter '" + std::string(m_text) + "' at " + std::to_string(m_position) + ": " + std::string(what));
+		}
+
+		std::string_view m_text;
+		size_t m_position = 0;
+		size_t m_nesting = 0; // of "not" and "("
+		MessageFilter& m_filter;
+		std::string& m_canonical; // the filter's
+	};
+
+	std::vector<Instruction> m_program;
+	std::string m_canonical;
+	size_t m_depth = 0;
+	size_t m_maxDepth = 0;
+};
+
+/* The filters of the subscribers of a topic, every distinct filter once (see MessageFilter::Canonical), in a slot of its own.
+   Publishers evaluate every filter once per message (see Evaluate), no matter how many subscribers share it, and subscribers just read the result of their slot.
+   Slots are reused when their last subscriber goes, thus the results of a message tell which filters they are about (see FilterResults::Passed).
+   Publishers read an immutable snapshot of the slots, subscribing and unsubscribing replace it (filters change seldom, messages flow all the time).
+*/
+class TopicFilters
+{
+public:
+	using Snapshot = std::vector<std::shared_ptr<const MessageFilter>>; // by slot, null if free
+
+	// the slot of "filter" (or of an identical one, which is shared), until Release. "filter" becomes the shared one
+	size_t Acquire(std::shared_ptr<const MessageFilter>& filter)
+	{
+		std::lock_guard lock{ m_mutex };
+		auto slots = std::make_shared<Snapshot>(*m_snapshot);
+		for (size_t slot = 0; slot < slots->size(); ++slot)
+		{
+			if ((*slots)[slot] && (*slots)[slot]->Canonical() == filter->Canonical())
+			{
+				++m_references[slot];
+				filter = (*slots)[slot];
+				return slot;
+			}
+		}
+		auto slot = static_cast<size_t>(std::ranges::find(*slots, nullptr) - slots->begin());
+		if (slot == slots->size())
+		{
+			slots->emplace_back();
+			m_references.push_back(0);
+		}
+		(*slots)[slot] = filter;
+		m_references[slot] = 1;
+		m_snapshot = std::move(slots);
+		m_active.fetch_add(1, std::memory_order_release);
+		return slot;
+	}
+
+	void Release(size_t slot)
+	{
+		std::lock_guard lock{ m_mutex };
+		if (slot >= m_references.size() || !m_references[slot] || --m_references[slot])
+		{
+			return;
+		}
+		auto slots = std::make_shared<Snapshot>(*m_snapshot);
+		(*slots)[slot] = nullptr;
+		m_snapshot = std::move(slots);
+		m_active.fetch_sub(1, std::memory_order_release);
+	}
+
+	// every filter, once. Nothing (not even a lock) if the topic has no filters
+	struct Results
+	{
+		std::shared_ptr<const Snapshot> snapshot; // what has been evaluated
+		std::vector<bool> passed; // by slot
+
+		// nothing if "filter" was not in "slot" when the message was published (then the subscriber evaluates it on its own)
+		[[nodiscard]] std::optional<bool> Passed(size_t slot, const MessageFilter& filter) const
+		{
+			if (!snapshot || slot >= snapshot->size() || (*snapshot)[slot].get() != &filter)
+			{
+				return std::nullopt;
+			}
+			return passed[slot];
+		}
+	};
+
+	[[nodiscard]] Results Evaluate(const Message& message) const
+	{
+		if (!m_active.load(std::memory_order_acquire))
+		{
+			return {};
+		}
+		Results results;
+		{
+			std::lock_guard lock{ m_mutex };
+			results.snapshot = m_snapshot;
+		}
+		results.passed.resize(results.snapshot->size());
+		for (size_t slot = 0; slot < results.snapshot->size(); ++slot)
+		{
+			if (const auto& filter = (*results.snapshot)[slot])
+			{
+				results.passed[slot] = filter->Matches(message);
+			}
+		}
+		return results;
+	}
+
+	[[nodiscard]] size_t Active() const
+	{
+		return m_active.load(std::memory_order_acquire);
+	}
+private:
+	mutable std::mutex m_mutex;
+	std::shared_ptr<const Snapshot> m_snapshot = std::make_shared<const Snapshot>();
+	std::vector<size_t> m_references; // by slot
+	std::atomic<size_t> m_active = 0;
+};
+
+using FilterResults = TopicFilters::Results;
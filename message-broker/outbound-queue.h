@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <grpcpp/support/byte_buffer.h>
+
+// what to do when a subscriber does not keep up and its outbound queue is full
+enum class OverflowPolicy
+{
+	drop_oldest, // make room by dropping the oldest pending frame
+	drop_newest, // drop the incoming frame
+	conflate,    // the incoming frame replaces the pending one with the same key (e.g. same topic), otherwise the oldest is dropped
+	disconnect,  // give up on the subscriber
+};
+
+struct OutboundQueueStats
+{
+	size_t capacity = 0;
+	size_t depth = 0;
+	size_t maxDepth = 0;
+	uint64_t dropped = 0;
+	uint64_t conflated = 0;
+};
+
+/* The frames waiting to be written to a subscriber, bounded by "capacity".
+   Frames are pushed by the subscriber's agent and popped by whoever writes to the gRPC stream, so the agent never waits for a slow subscriber.
+   This class is not synchronized, streams protect it with their own locks.
+   "key" identifies what a frame is about (e.g. its topic), it is used only for conflation and 0 means "never conflate".
+   A conflating queue (see ReceiveRequest.conflation) conflates all the time, not only on overflow: a frame replaces the pending one with the same key,
+   in its place, thus a subscriber gets only the latest value of every key once its current write is over, and the queue never holds more than a frame per key.
+   Pending frames are found by key in constant time: the index maps a key to the (ever increasing) position of its latest pending frame.
+*/
+class OutboundQueue
+{
+public:
+	enum class PushResult { queued, dropped, conflated, overflow };
+
+	OutboundQueue(size_t capacity, OverflowPolicy policy, bool conflating = false)
+		: m_capacity(std::max<size_t>(capacity, 1)), m_policy(policy), m_conflating(conflating)
+	{
+	}
+
+	PushResult Push(uint64_t key, const grpc::ByteBuffer& frame)
+	{
+		if (m_conflating && Conflate(key, frame))
+		{
+			return PushResult::conflated;
+		}
+		if (m_frames.size() < m_capacity)
+		{
+			PushBack(key, frame);
+			m_stats.maxDepth = std::max<size_t>(m_stats.maxDepth, m_frames.size());
+			return PushResult::queued;
+		}
+
+		switch (m_policy)
+		{
+		case OverflowPolicy::drop_newest:
+			++m_stats.dropped;
+			return PushResult::dropped;
+		case OverflowPolicy::disconnect:
+			return PushResult::overflow;
+		case OverflowPolicy::conflate:
+			if (Conflate(key, frame))
+			{
+				return PushResult::conflated;
+			}
+			[[fallthrough]];
+		case OverflowPolicy::drop_oldest:
+			PopFront();
+			PushBack(key, frame);
+			++m_stats.dropped;
+			return PushResult::dropped;
+		}
+		return PushResult::dropped;
+	}
+
+	std::optional<grpc::ByteBuffer> Pop()
+	{
+		if (auto entry = PopWithKey())
+		{
+			return std::move(entry->second);
+		}
+		return std::nullopt;
+	}
+
+	// the same as Pop, for those who push the frame somewhere else
+	std::optional<std::pair<uint64_t, grpc::ByteBuffer>> PopWithKey()
+	{
+		if (m_frames.empty())
+		{
+			return std::nullopt;
+		}
+		std::pair entry{ m_frames.front().key, m_frames.front().frame };
+		PopFront();
+		return entry;
+	}
+
+	void Clear()
+	{
+		m_first += m_frames.size();
+		m_frames.clear();
+		m_index.clear();
+	}
+
+	// empties the queue, returning the frames (and their keys) in order
+	std::vector<std::pair<uint64_t, grpc::ByteBuffer>> TakeAll()
+	{
+		std::vector<std::pair<uint64_t, grpc::ByteBuffer>> frames;
+		frames.reserve(m_frames.size());
+		for (const auto& [key, frame] : m_frames)
+		{
+			frames.emplace_back(key, frame);
+		}
+		Clear();
+		return frames;
+	}
+
+	[[nodiscard]] bool Empty() const
+	{
+		return m_frames.empty();
+	}
+
+	[[nodiscard]] OutboundQueueStats Stats() const
+	{
+		auto stats = m_stats;
+		stats.capacity = m_capacity;
+		stats.depth = m_frames.size();
+		return stats;
+	}
+private:
+	struct Entry
+	{
+		uint64_t key;
+		grpc::ByteBuffer frame;
+	};
+
+	// the index is kept only if frames can be conflated
+	[[nodiscard]] bool Indexed() const
+	{
+		return m_conflating || m_policy == OverflowPolicy::conflate;
+	}
+
+	// true if "frame" has replaced the latest pending frame with the same key
+	bool Conflate(uint64_t key, const grpc::ByteBuffer& frame)
+	{
+		if (!key)
+		{
+			return false;
+		}
+		const auto it = m_index.find(key);
+		if (it == end(m_index))
+		{
+			return false;
+		}
+		m_frames[it->second - m_first].frame = frame;
+		++m_stats.conflated;
+		return true;
+	}
+
+	void PushBack(uint64_t key, const grpc::ByteBuffer& frame)
+	{
+		if (key && Indexed())
+		{
+			m_index[key] = m_first + m_frames.size();
+		}
+		m_frames.push_back({ key, frame });
+	}
+
+	void PopFront()
+	{
+		const auto key = m_frames.front().key;
+		if (const auto it = key ? m_index.find(key) : end(m_index); it != end(m_index) && it->second == m_first)
+		{
+			m_index.erase(it);
+		}
+		m_frames.pop_front();
+		++m_first;
+	}
+
+	size_t m_capacity;
+	OverflowPolicy m_policy;
+	bool m_conflating;
+	std::deque<Entry> m_frames;
+	uint64_t m_first = 0; // the position of the front frame
+	std::unordered_map<uint64_t, uint64_t> m_index; // key -> position of its latest pending frame
+	OutboundQueueStats m_stats;
+};
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include "../generated/broker.grpc.pb.h"
+#include "cumulative-acknowledger.h"
+
+/* Callback API for "Publish": requests are read one at a time and handed to "send", acks are written by CumulativeAcknowledger.
+   Acks never block anybody: only one write at a time is allowed, thus while an ack is written the next ones are coalesced into the latest
+   (they are cumulative, the latest tells everything). A producer that stops reading its acks just gets them late, the timer thread
+   of the windows (shared by all the streams, see AckWindowTimer) and the other producers don't notice.
+   When the producer closes the stream, or "send" fails, what has been accepted until then is acknowledged and then the stream is finished.
+   The reactor deletes itself when gRPC is done with the call.
+*/
+class PublishReactor final : public grpc::ServerBidiReactor<SendRequest, PublishAck>
+{
+public:
+	// the request is ours, "send" can complete its messages in place
+	using Sender = std::function<grpc::Status(SendRequest&)>;
+
+	PublishReactor(Sender send, uint64_t ackEvery, std::chrono::milliseconds ackWindow, AckWindowTimer& timer)
+		: m_send(std::move(send)), m_acknowledger(ackEvery, ackWindow, [this](uint64_t accepted) { return WriteAck(accepted); }, timer)
+	{
+		StartRead(&m_request);
+	}
+
+	void OnReadDone(bool ok) override
+	{
+		if (!ok)
+		{
+			// the producer has closed the stream (or it has gone, then the last ack just fails)
+			Close(grpc::Status::OK);
+			return;
+		}
+		if (auto status = m_send(m_request); !status.ok())
+		{
+			Close(std::move(status));
+			return;
+		}
+		m_acknowledger.Accepted(m_request.messages().size());
+		// not on an arena: reading into the same request reuses its messages and strings, while an arena would grow as long as the stream lasts
+		StartRead(&m_request);
+	}
+
+	void OnWriteDone(bool ok) override
+	{
+		std::lock_guard lock{ m_mutex };
+		m_writing = false;
+		if (!ok)
+		{
+			// the producer has gone, acks still to come are dropped
+			m_broken = true;
+		}
+		else if (m_pendingAck)
+		{
+			StartWriteOf(*std::exchange(m_pendingAck, std::nullopt));
+			return;
+		}
+		if (m_closeStatus)
+		{
+			Finish(*std::exchange(m_closeStatus, std::nullopt));
+		}
+	}
+
+	void OnDone() override
+	{
+		delete this;
+	}
+private:
+	// we finish only when no ack is in flight, otherwise OnWriteDone will do that
+	void Close(grpc::Status status)
+	{
+		m_acknowledger.Finish();
+		std::lock_guard lock{ m_mutex };
+		if (m_writing)
+		{
+			m_closeStatus = std::move(status);
+		}
+		else
+		{
+			Finish(std::move(status));
+		}
+	}
+
+	// called by the acknowledger under its lock, on the reading thread or on the thread of the timer: it just starts the write (or it queues the ack)
+	bool WriteAck(uint64_t accepted)
+	{
+		std::lock_guard lock{ m_mutex };
+		if (m_broken)
+		{
+			return false;
+		}
+		if (m_writing)
+		{
+			m_pendingAck = accepted;
+		}
+		else
+		{
+			StartWriteOf(accepted);
+		}
+		return true;
+	}
+
+	void StartWriteOf(uint64_t accepted)
+	{
+		m_writing = true;
+		m_ack.set_acknowledged(accepted);
+		StartWrite(&m_ack);
+	}
+
+	Sender m_send;
+	SendRequest m_request;
+	std::mutex m_mutex;
+	PublishAck m_ack; // the ack being written
+	bool m_writing = false;
+	std::optional<uint64_t> m_pendingAck;
+	std::optional<grpc::Status> m_closeStatus;
+	bool m_broken = false;
+	CumulativeAcknowledger m_acknowledger; // last, its window might expire until it is finished
+};
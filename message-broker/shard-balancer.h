@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/* The number of subscribers bound to every shard (see DispatchMode::sharded): a new subscriber goes to the least loaded shard
+   and it stays there for its whole life, so its state is always touched by the same thread.
+   Concurrent Acquire might pick the same shard, that's fine: the balance is approximate, it never blocks.
+*/
+class ShardBalancer
+{
+public:
+	explicit ShardBalancer(size_t shards)
+		: m_loads(shards ? shards : 1)
+	{
+	}
+
+	// picks a shard and counts a subscriber on it
+	size_t Acquire()
+	{
+		size_t best = 0;
+		auto fewest = m_loads[0].load(std::memory_order_relaxed);
+		for (size_t shard = 1; shard < m_loads.size() && fewest; ++shard)
+		{
+			if (const auto load = m_loads[shard].load(std::memory_order_relaxed); load < fewest)
+			{
+				best = shard;
+				fewest = load;
+			}
+		}
+		m_loads[best].fetch_add(1, std::memory_order_relaxed);
+		return best;
+	}
+
+	// the subscriber bound by Acquire has gone
+	void Release(size_t shard)
+	{
+		m_loads[shard].fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] size_t Load(size_t shard) const
+	{
+		return m_loads[shard].load(std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] size_t Size() const
+	{
+		return m_loads.size();
+	}
+private:
+	std::vector<std::atomic<size_t>> m_loads;
+};
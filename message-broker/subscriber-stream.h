@@ -0,0 +1,346 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include "../generated/broker.grpc.pb.h"
+#include "outbound-queue.h"
+
+// "Receive" writes pre-encoded ReceiveResponse frames (see EncodedMessage), hence the stream works on grpc::ByteBuffer
+using ReceiveStream = grpc::ServerSplitStreamer<ReceiveRequest, grpc::ByteBuffer>;
+
+/* Where a ReceiveAgent delivers its frames to.
+   The agent does not care whether the subscription is served by the synchronous API or by the callback API:
+   it just writes frames and closes the stream when it has done.
+   Writes never block: frames go to a bounded OutboundQueue and they are written to gRPC by someone else (not by the dispatcher threads),
+   thus a slow subscriber can't stall the other agents. When the queue is full, its OverflowPolicy applies.
+   Also, the stream tells the agent as soon as the subscriber goes away, so the agent does not need to poll for that.
+*/
+class SubscriberStream
+{
+public:
+	virtual ~SubscriberStream() = default;
+	// false means the subscriber has gone (or it has been given up) and no more frames can be delivered
+	// "key" is used for conflation (see OutboundQueue)
+	virtual bool Write(uint64_t key, const grpc::ByteBuffer& frame) = 0;
+	// called exactly once, when the agent has done with this stream (the stream must not be used afterwards)
+	virtual void Close(grpc::Status status) = 0;
+	virtual OutboundQueueStats QueueStats() = 0;
+	// the frames that have not been written (yet), they are removed from the stream (e.g. to hand them to another subscriber)
+	virtual std::vector<std::pair<uint64_t, grpc::ByteBuffer>> TakePending() = 0;
+
+	// "notify" is invoked (once) when the subscriber goes away, immediately if this has already happened
+	void NotifyDisconnection(std::function<void()> notify)
+	{
+		std::unique_lock lock{ m_disconnectionMutex };
+		if (m_disconnected)
+		{
+			lock.unlock();
+			notify();
+			return;
+		}
+		m_notifyDisconnection = std::move(notify);
+	}
+protected:
+	// implementations call this when they detect the subscriber has gone (repeated calls are ignored)
+	void Disconnected()
+	{
+		std::function<void()> notify;
+		{
+			std::lock_guard lock{ m_disconnectionMutex };
+			if (std::exchange(m_disconnected, true))
+			{
+				return;
+			}
+			notify = std::move(m_notifyDisconnection);
+		}
+		if (notify)
+		{
+			notify();
+		}
+	}
+
+	static grpc::Status SlowConsumerStatus()
+	{
+		return { grpc::StatusCode::RESOURCE_EXHAUSTED, "The subscriber can't keep up, its outbound queue is full" };
+	}
+private:
+	std::mutex m_disconnectionMutex;
+	std::function<void()> m_notifyDisconnection;
+	bool m_disconnected = false;
+};
+
+/* Synchronous API: the gRPC thread serving "Receive" is parked for the whole life of the subscription anyway,
+   thus it is the one writing the queued frames (see Serve).
+*/
+class SyncSubscriberStream final : public SubscriberStream
+{
+public:
+	// the synchronous API does not notify cancellations, thus the parked gRPC thread checks the context every now and then
+	// (as often as the broker used to poll from its agents: the callback API, the default, notifies them right away)
+	static constexpr std::chrono::seconds DisconnectionCheckInterval{ 5 };
+
+	SyncSubscriberStream(grpc::ServerContext* context, ReceiveStream* stream, OutboundQueue queue)
+		: m_context(context), m_stream(stream), m_queue(std::move(queue))
+	{
+	}
+
+	bool Write(uint64_t key, const grpc::ByteBuffer& frame) override
+	{
+		std::lock_guard lock{ m_mutex };
+		if (m_broken)
+		{
+			return false;
+		}
+		if (m_queue.Push(key, frame) == OutboundQueue::PushResult::overflow)
+		{
+			// pending frames are kept, the agent might want them back (see TakePending)
+			m_broken = true;
+			m_failure = SlowConsumerStatus();
+			return false;
+		}
+		m_wakeUp.notify_one();
+		return true;
+	}
+
+	void Close(grpc::Status status) override
+	{
+		std::lock_guard lock{ m_mutex };
+		m_closeStatus = std::move(status);
+		m_wakeUp.notify_one();
+	}
+
+	OutboundQueueStats QueueStats() override
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_queue.Stats();
+	}
+
+	std::vector<std::pair<uint64_t, grpc::ByteBuffer>> TakePending() override
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_queue.TakeAll();
+	}
+
+	// writes the queued frames until the stream is closed (frames still pending at that point are dropped)
+	grpc::Status Serve()
+	{
+		std::unique_lock lock{ m_mutex };
+		while (true)
+		{
+			if (!m_wakeUp.wait_for(lock, DisconnectionCheckInterval, [this] { return m_closeStatus || (!m_broken && !m_queue.Empty()); }))
+			{
+				if (m_context->IsCancelled())
+				{
+					lock.unlock();
+					Disconnected();
+					lock.lock();
+				}
+				continue;
+			}
+			if (m_closeStatus)
+			{
+				return m_failure.value_or(*m_closeStatus);
+			}
+			const auto frame = *m_queue.Pop();
+			lock.unlock();
+			const auto writeSuccessful = m_stream->Write(frame);
+			lock.lock();
+			if (!writeSuccessful)
+			{
+				// the client has possibly gone, frames still in the queue will never be written (but see TakePending)
+				m_broken = true;
+				lock.unlock();
+				Disconnected();
+				lock.lock();
+			}
+		}
+	}
+private:
+	grpc::ServerContext* m_context;
+	ReceiveStream* m_stream;
+	std::mutex m_mutex;
+	std::condition_variable m_wakeUp;
+	OutboundQueue m_queue;
+	std::optional<grpc::Status> m_closeStatus;
+	std::optional<grpc::Status> m_failure;
+	bool m_broken = false;
+};
+
+/* Callback API: no threads are held while the subscriber is idle and disconnections are notified by gRPC (OnCancel).
+   The callback API allows only one outstanding write per stream, thus frames are queued and written one at a time (OnWriteDone starts the next one).
+   The reactor deletes itself when gRPC is done with the call, that is after Close (aka: Finish) and after any pending write.
+   "Reactor" is the gRPC reactor of the call: ServerWriteReactor for "Receive" (see ReceiveReactor), ServerBidiReactor for "Subscribe" (see SubscribeReactor).
+*/
+template<typename Reactor>
+class ReactorSubscriberStream : public SubscriberStream, public Reactor
+{
+public:
+	explicit ReactorSubscriberStream(OutboundQueue queue)
+		: m_queue(std::move(queue))
+	{
+	}
+
+	bool Write(uint64_t key, const grpc::ByteBuffer& frame) override
+	{
+		std::lock_guard lock{ m_mutex };
+		if (m_broken)
+		{
+			return false;
+		}
+		if (!m_writing)
+		{
+			StartWriteOf(frame);
+			return true;
+		}
+		if (m_queue.Push(key, frame) == OutboundQueue::PushResult::overflow)
+		{
+			// pending frames are kept, the agent might want them back (see TakePending)
+			m_broken = true;
+			m_failure = SlowConsumerStatus();
+			return false;
+		}
+		return true;
+	}
+
+	void Close(grpc::Status status) override
+	{
+		std::lock_guard lock{ m_mutex };
+		m_closed = true;
+		status = m_failure.value_or(std::move(status));
+		// we finish only when nothing is in flight, otherwise OnWriteDone will do that
+		if (!m_writing)
+		{
+			this->Finish(std::move(status));
+		}
+		else
+		{
+			m_closeStatus = std::move(status);
+		}
+	}
+
+	OutboundQueueStats QueueStats() override
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_queue.Stats();
+	}
+
+	std::vector<std::pair<uint64_t, grpc::ByteBuffer>> TakePending() override
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_queue.TakeAll();
+	}
+
+	void OnWriteDone(bool ok) override
+	{
+		std::lock_guard lock{ m_mutex };
+		m_writing = false;
+		if (!ok)
+		{
+			// the client has possibly gone, frames still in the queue will never be written (but see TakePending)
+			m_broken = true;
+			Disconnected();
+		}
+		if (const auto next = m_broken ? std::nullopt : m_queue.Pop(); next && !m_closeStatus)
+		{
+			StartWriteOf(*next);
+		}
+		else if (m_closeStatus)
+		{
+			this->Finish(*std::exchange(m_closeStatus, std::nullopt));
+		}
+	}
+
+	void OnCancel() override
+	{
+		Disconnected();
+	}
+
+	void OnDone() override
+	{
+		delete this;
+	}
+protected:
+	// only before anything has been written (e.g. when the settings of the subscriber are known later than the reactor is made)
+	void ResetQueue(OutboundQueue queue)
+	{
+		std::lock_guard lock{ m_mutex };
+		m_queue = std::move(queue);
+	}
+
+	// bidi streams only: a read is started under the same lock as Close, thus never once the stream is finished (or about to be)
+	template<typename Request>
+	void StartReadUnlessClosed(Request* request)
+	{
+		std::lock_guard lock{ m_mutex };
+		if (!m_closed)
+		{
+			this->StartRead(request);
+		}
+	}
+private:
+	void StartWriteOf(const grpc::ByteBuffer& frame)
+	{
+		m_writing = true;
+		m_current = frame; // it's just a reference count increment
+		this->StartWrite(&m_current);
+	}
+
+	std::mutex m_mutex;
+	grpc::ByteBuffer m_current; // the frame being written
+	bool m_writing = false;
+	OutboundQueue m_queue;
+	std::optional<grpc::Status> m_closeStatus;
+	std::optional<grpc::Status> m_failure;
+	bool m_broken = false;
+	bool m_closed = false;
+};
+
+using ReceiveReactor = ReactorSubscriberStream<grpc::ServerWriteReactor<grpc::ByteBuffer>>;
+
+/* Callback API for "Subscribe": while frames are written, commands are read one at a time and handed to "onCommand", in order.
+   The first command opens the subscription and it tells how frames are delivered, thus the outbound queue is reset only then (see ResetQueue).
+   If "onCommand" fails, the stream is closed with its status: this can happen only with the first command, since afterwards
+   the stream is closed by the agent. Half-closing the stream does not end the subscription.
+*/
+class SubscribeReactor final : public ReactorSubscriberStream<grpc::ServerBidiReactor<SubscribeRequest, grpc::ByteBuffer>>
+{
+public:
+	using CommandHandler = std::function<grpc::Status(SubscribeReactor&, const SubscribeRequest&)>;
+
+	explicit SubscribeReactor(CommandHandler onCommand)
+		: ReactorSubscriberStream(OutboundQueue{ 1, OverflowPolicy::disconnect }), m_onCommand(std::move(onCommand))
+	{
+		StartRead(&m_command);
+	}
+
+	using ReactorSubscriberStream::ResetQueue;
+
+	void OnReadDone(bool ok) override
+	{
+		if (!ok)
+		{
+			// the client has half-closed the stream (or it has gone, then OnCancel tells the agent)
+			if (!m_opened)
+			{
+				Close({ grpc::StatusCode::INVALID_ARGUMENT, "Missing SubscribeRequest" });
+			}
+			return;
+		}
+		if (auto status = m_onCommand(*this, m_command); !status.ok())
+		{
+			Close(std::move(status));
+			return;
+		}
+		m_opened = true;
+		m_command.Clear();
+		// the command might have closed the stream (e.g. the agent has gone meanwhile)
+		StartReadUnlessClosed(&m_command);
+	}
+private:
+	CommandHandler m_onCommand;
+	SubscribeRequest m_command;
+	bool m_opened = false; // reads are sequential, no need to synchronize this
+};
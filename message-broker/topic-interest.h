@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/* What the subscribers of this broker are interested in (topic names and patterns), as seen by federation links (see FederationLink):
+   listeners are notified only when the first subscriber shows interest in a topic and when the last one loses it,
+   thus a link subscribes and unsubscribes a remote topic once, no matter how many local subscribers come and go.
+   Listeners are called under the lock (thus in order), they must not call back into the table.
+*/
+class InterestTable
+{
+public:
+	// "interested" is false when the last subscriber has gone
+	using Listener = std::function<void(const std::string& topic, bool interested)>;
+
+	// "listener" is called with the current interests first, then with every change. Returns the id to stop listening
+	uint64_t Listen(Listener listener)
+	{
+		std::lock_guard lock{ m_mutex };
+		for (const auto& [topic, _] : m_counts)
+		{
+			listener(topic, true);
+		}
+		m_listeners.emplace_back(++m_lastListener, std::move(listener));
+		return m_lastListener;
+	}
+
+	void StopListening(uint64_t id)
+	{
+		std::lock_guard lock{ m_mutex };
+		std::erase_if(m_listeners, [=](const auto& listener) { return listener.first == id; });
+	}
+
+	void Add(const std::string& topic)
+	{
+		std::lock_guard lock{ m_mutex };
+		if (++m_counts[topic] == 1)
+		{
+			Notify(topic, true);
+		}
+	}
+
+	void Remove(const std::string& topic)
+	{
+		std::lock_guard lock{ m_mutex };
+		const auto it = m_counts.find(topic);
+		if (it != end(m_counts) && --it->second == 0)
+		{
+			m_counts.erase(it);
+			Notify(topic, false);
+		}
+	}
+
+	[[nodiscard]] size_t Size() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_counts.size();
+	}
+private:
+	void Notify(const std::string& topic, bool interested)
+	{
+		for (const auto& [_, listener] : m_listeners)
+		{
+			listener(topic, interested);
+		}
+	}
+
+	mutable std::mutex m_mutex;
+	std::unordered_map<std::string, size_t> m_counts;
+	std::vector<std::pair<uint64_t, Listener>> m_listeners;
+	uint64_t m_lastListener = 0;
+};
+
+/* The interests of a single subscriber: the same topic (or pattern) counts once, and everything left is withdrawn on Clear.
+   Without a table, this does nothing: subscribers from other brokers (see ReceiveRequest.federation_peer) do not count,
+   otherwise two brokers bridging each other would keep each other interested forever.
+*/
+class SubscriberInterests
+{
+public:
+	explicit SubscriberInterests(std::shared_ptr<InterestTable> table = nullptr)
+		: m_table(std::move(table))
+	{
+	}
+
+	SubscriberInterests(SubscriberInterests&&) = default;
+	SubscriberInterests& operator=(SubscriberInterests&&) = delete;
+
+	~SubscriberInterests()
+	{
+		Clear();
+	}
+
+	void Add(std::string_view topic)
+	{
+		if (m_table)
+		{
+			if (const auto [it, added] = m_topics.emplace(topic); added)
+			{
+				m_table->Add(*it);
+			}
+		}
+	}
+
+	void Remove(std::string_view topic)
+	{
+		if (m_table)
+		{
+			if (const auto it = m_topics.find(topic); it != end(m_topics))
+			{
+				m_table->Remove(*it);
+				m_topics.erase(it);
+			}
+		}
+	}
+
+	void Clear()
+	{
+		if (m_table)
+		{
+			for (const auto& topic : m_topics)
+			{
+				m_table->Remove(topic);
+			}
+		}
+		m_topics.clear();
+	}
+private:
+	std::shared_ptr<InterestTable> m_table;
+	std::set<std::string, std::less<>> m_topics;
+};
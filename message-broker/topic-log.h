@@ -0,0 +1,400 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <grpcpp/support/byte_buffer.h>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// when the topic log is flushed to disk (until then, it survives a crash of the broker but not a crash of the machine)
+enum class FsyncPolicy
+{
+	none,     // let the OS decide
+	interval, // at most every TopicLogSettings::fsyncInterval (checked when appending)
+	batch,    // after every appended batch (i.e. every Send), the slowest
+};
+
+struct TopicLogSettings
+{
+	std::filesystem::path directory; // empty means "topics are not logged"
+	size_t segmentSize = 64 * 1024 * 1024;
+	size_t retainedSegments = 16; // per topic, the oldest segments are deleted
+	FsyncPolicy fsync = FsyncPolicy::interval;
+	std::chrono::milliseconds fsyncInterval{ 1000 };
+};
+
+/* A read/write memory mapping of a whole file.
+   The file is created if it does not exist and it is extended with zeros up to "size" bytes.
+*/
+class MappedFile
+{
+public:
+	MappedFile(const std::filesystem::path& path, size_t size)
+	{
+	#ifdef _WIN32
+		m_file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		LARGE_INTEGER currentSize{};
+		if (m_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_file, &currentSize))
+		{
+			Fail(path);
+		}
+		m_size = std::max<size_t>(size, static_cast<size_t>(currentSize.QuadPart));
+		const auto mappingSize = static_cast<uint64_t>(m_size);
+		m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READWRITE, static_cast<DWORD>(mappingSize >> 32), static_cast<DWORD>(mappingSize), nullptr);
+		if (!m_mapping)
+		{
+			Fail(path);
+		}
+		m_data = static_cast<char*>(MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, m_size));
+	#else
+		m_file = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+		struct stat info{};
+		if (m_file < 0 || fstat(m_file, &info) != 0)
+		{
+			Fail(path);
+		}
+		m_size = std::max<size_t>(size, static_cast<size_t>(info.st_size));
+		if (static_cast<size_t>(info.st_size) < m_size && ftruncate(m_file, static_cast<off_t>(m_size)) != 0)
+		{
+			Fail(path);
+		}
+		auto* data = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0);
+		m_data = data == MAP_FAILED ? nullptr : static_cast<char*>(data);
+	#endif
+		if (!m_data)
+		{
+			Fail(path);
+		}
+	}
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	~MappedFile()
+	{
+		Release();
+	}
+
+	[[nodiscard]] char* Data() const
+	{
+		return m_data;
+	}
+
+	[[nodiscard]] size_t Size() const
+	{
+		return m_size;
+	}
+
+	// writes [offset, offset + length) to disk and waits for it
+	void Flush(size_t offset, size_t length) const
+	{
+	#ifdef _WIN32
+		FlushViewOfFile(m_data + offset, length);
+		FlushFileBuffers(m_file);
+	#else
+		// msync wants a page-aligned address
+		static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+		const auto alignedOffset = offset / pageSize * pageSize;
+		msync(m_data + alignedOffset, length + offset - alignedOffset, MS_SYNC);
+	#endif
+	}
+private:
+	[[noreturn]] void Fail(const std::filesystem::path& path)
+	{
+		Release();
+		throw std::runtime_error("Can't map file '" + path.string() + "'");
+	}
+
+	void Release()
+	{
+	#ifdef _WIN32
+		if (m_data)
+			UnmapViewOfFile(m_data);
+		if (m_mapping)
+			CloseHandle(m_mapping);
+		if (m_file != INVALID_HANDLE_VALUE)
+			CloseHandle(m_file);
+		m_mapping = nullptr;
+		m_file = INVALID_HANDLE_VALUE;
+	#else
+		if (m_data)
+			munmap(m_data, m_size);
+		if (m_file >= 0)
+			close(m_file);
+		m_file = -1;
+	#endif
+		m_data = nullptr;
+	}
+
+#ifdef _WIN32
+	HANDLE m_file = INVALID_HANDLE_VALUE;
+	HANDLE m_mapping = nullptr;
+#else
+	int m_file = -1;
+#endif
+	char* m_data = nullptr;
+	size_t m_size = 0;
+};
+
+/* A file of the topic log, holding the frames from "base offset" on. Every record is [uint32 length][frame bytes].
+   The file is allocated upfront (it is full of zeros), thus the first zero length marks the end of the records.
+   The payload of a record is written before its length, so a torn record is never read back after a crash.
+   The file is deleted on destruction if it has been removed from the log (readers might be still using it).
+*/
+class LogSegment
+{
+public:
+	static constexpr size_t RecordHeaderSize = sizeof(uint32_t);
+
+	LogSegment(std::filesystem::path path, uint64_t baseOffset, size_t size)
+		: m_path(std::move(path)), m_baseOffset(baseOffset), m_file(std::in_place, m_path, size)
+	{
+		// an existing segment is scanned to find its records
+		while (m_position + RecordHeaderSize <= m_file->Size())
+		{
+			const auto length = LengthAt(m_position);
+			if (!length || m_position + RecordHeaderSize + length > m_file->Size())
+			{
+				break;
+			}
+			m_records.push_back(m_position);
+			m_position += RecordHeaderSize + length;
+		}
+		m_flushed = m_position;
+	}
+
+	LogSegment(const LogSegment&) = delete;
+	LogSegment& operator=(const LogSegment&) = delete;
+
+	~LogSegment()
+	{
+		if (m_removed)
+		{
+			m_file.reset(); // the file can't be deleted while it is mapped (on Windows)
+			std::error_code error;
+			std::filesystem::remove(m_path, error);
+		}
+	}
+
+	[[nodiscard]] uint64_t BaseOffset() const
+	{
+		return m_baseOffset;
+	}
+
+	[[nodiscard]] uint64_t EndOffset() const
+	{
+		return m_baseOffset + m_records.size();
+	}
+
+	// false if there is no room left for the frame
+	bool Append(const grpc::ByteBuffer& frame)
+	{
+		const auto length = frame.Length();
+		if (m_position + RecordHeaderSize + length > m_file->Size())
+		{
+			return false;
+		}
+		std::vector<grpc::Slice> slices;
+		frame.Dump(&slices);
+		auto* payload = m_file->Data() + m_position + RecordHeaderSize;
+		for (const auto& slice : slices)
+		{
+			std::memcpy(payload, slice.begin(), slice.size());
+			payload += slice.size();
+		}
+		const auto header = static_cast<uint32_t>(length);
+		std::memcpy(m_file->Data() + m_position, &header, RecordHeaderSize);
+		m_records.push_back(m_position);
+		m_position += RecordHeaderSize + length;
+		return true;
+	}
+
+	// "offset" must be in [BaseOffset, EndOffset)
+	[[nodiscard]] grpc::ByteBuffer Read(uint64_t offset) const
+	{
+		const auto position = m_records[offset - m_baseOffset];
+		const grpc::Slice slice{ m_file->Data() + position + RecordHeaderSize, LengthAt(position) };
+		return grpc::ByteBuffer{ &slice, 1 };
+	}
+
+	// writes to disk what has been appended since the last flush
+	void Flush()
+	{
+		if (m_position > m_flushed)
+		{
+			m_file->Flush(m_flushed, m_position - m_flushed);
+			m_flushed = m_position;
+		}
+	}
+
+	void Remove()
+	{
+		m_removed = true;
+	}
+private:
+	[[nodiscard]] uint32_t LengthAt(size_t position) const
+	{
+		uint32_t length;
+		std::memcpy(&length, m_file->Data() + position, RecordHeaderSize);
+		return length;
+	}
+
+	std::filesystem::path m_path;
+	uint64_t m_baseOffset;
+	std::optional<MappedFile> m_file;
+	std::vector<size_t> m_records; // the position of every record
+	size_t m_position = 0;
+	size_t m_flushed = 0;
+	bool m_removed = false;
+};
+
+/* The append-only log of a topic: every published frame gets the next offset (starting from 0) and it is stored in memory-mapped segment files,
+   so subscribers can replay the topic from a given offset and the messages survive a restart.
+   Segments are named after their base offset (e.g. 00000000000000004096.log) and they are rolled when full, the oldest ones are deleted
+   according to TopicLogSettings::retainedSegments.
+   Appending and reading are serialized by a mutex (reads are done in chunks, see Read).
+*/
+class TopicLog
+{
+public:
+	TopicLog(std::filesystem::path directory, const TopicLogSettings& settings)
+		: m_directory(std::move(directory)), m_settings(settings), m_lastFsync(std::chrono::steady_clock::now())
+	{
+		m_settings.retainedSegments = std::max<size_t>(m_settings.retainedSegments, 1);
+		std::filesystem::create_directories(m_directory);
+		std::vector<std::pair<uint64_t, std::filesystem::path>> existing;
+		for (const auto& entry : std::filesystem::directory_iterator(m_directory))
+		{
+			if (entry.path().extension() == ".log")
+			{
+				existing.emplace_back(std::stoull(entry.path().stem().string()), entry.path());
+			}
+		}
+		std::ranges::sort(existing);
+		for (const auto& [baseOffset, path] : existing)
+		{
+			// only the last segment is written, thus it is the only one that needs the full size
+			const auto size = baseOffset == existing.back().first ? m_settings.segmentSize : LogSegment::RecordHeaderSize;
+			m_segments.push_back(std::make_shared<LogSegment>(path, baseOffset, size));
+		}
+		if (m_segments.empty())
+		{
+			Roll(0, 0);
+		}
+	}
+
+	TopicLog(const TopicLog&) = delete;
+	TopicLog& operator=(const TopicLog&) = delete;
+
+	// the directory of the log of "topic" under "root" (names are hex-encoded, since topics can contain any character)
+	static std::filesystem::path DirectoryFor(const std::filesystem::path& root, std::string_view topic)
+	{
+		static constexpr char digits[] = "0123456789abcdef";
+		std::string name;
+		for (const auto c : topic)
+		{
+			name += digits[static_cast<unsigned char>(c) >> 4];
+			name += digits[static_cast<unsigned char>(c) & 0xF];
+		}
+		return root / (name.empty() ? "_" : name);
+	}
+
+	/* Appends a batch of "count" frames, produced by "encode(index, offset)" (the frames usually contain their own offset).
+	   The frames are also added to "frames", the return value is the offset of the first one.
+	*/
+	template<typename Encode>
+	uint64_t Append(size_t count, Encode encode, std::vector<grpc::ByteBuffer>& frames)
+	{
+		std::lock_guard lock{ m_mutex };
+		const auto first = m_segments.back()->EndOffset();
+		for (size_t i = 0; i < count; ++i)
+		{
+			const auto offset = first + i;
+			auto frame = encode(i, offset);
+			if (!m_segments.back()->Append(frame))
+			{
+				Roll(offset, LogSegment::RecordHeaderSize + frame.Length());
+				m_segments.back()->Append(frame);
+			}
+			frames.push_back(std::move(frame));
+		}
+
+		if (m_settings.fsync == FsyncPolicy::batch || (m_settings.fsync == FsyncPolicy::interval && std::chrono::steady_clock::now() - m_lastFsync >= m_settings.fsyncInterval))
+		{
+			m_segments.back()->Flush();
+			m_lastFsync = std::chrono::steady_clock::now();
+		}
+		return first;
+	}
+
+	/* Reads up to "max" frames from "offset" on (without crossing a segment), appending them to "frames".
+	   If "offset" is not retained anymore, reading starts from the oldest retained frame: the return value is the offset of the first frame read.
+	   Nothing is read if "offset" is at (or beyond) the end of the log.
+	*/
+	uint64_t Read(uint64_t offset, size_t max, std::vector<grpc::ByteBuffer>& frames) const
+	{
+		std::lock_guard lock{ m_mutex };
+		offset = std::max<uint64_t>(offset, m_segments.front()->BaseOffset());
+		const auto segment = std::ranges::upper_bound(m_segments, offset, {}, &LogSegment::BaseOffset);
+		const auto& current = **prev(segment);
+		const auto end = std::min<uint64_t>(current.EndOffset(), offset + max);
+		for (auto i = offset; i < end; ++i)
+		{
+			frames.push_back(current.Read(i));
+		}
+		return offset;
+	}
+
+	[[nodiscard]] uint64_t StartOffset() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_segments.front()->BaseOffset();
+	}
+
+	[[nodiscard]] uint64_t EndOffset() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_segments.back()->EndOffset();
+	}
+private:
+	// starts a new segment from "baseOffset" (big enough for at least "minSize" bytes) and applies the retention
+	void Roll(uint64_t baseOffset, size_t minSize)
+	{
+		if (!m_segments.empty() && m_settings.fsync != FsyncPolicy::none)
+		{
+			m_segments.back()->Flush();
+		}
+		auto name = std::to_string(baseOffset);
+		name.insert(0, 20 - name.size(), '0');
+		const auto size = std::max<size_t>(m_settings.segmentSize, minSize + LogSegment::RecordHeaderSize);
+		m_segments.push_back(std::make_shared<LogSegment>(m_directory / (name + ".log"), baseOffset, size));
+		while (m_segments.size() > m_settings.retainedSegments)
+		{
+			m_segments.front()->Remove();
+			m_segments.pop_front();
+		}
+	}
+
+	std::filesystem::path m_directory;
+	TopicLogSettings m_settings;
+	mutable std::mutex m_mutex;
+	std::deque<std::shared_ptr<LogSegment>> m_segments; // sorted by base offset, the last one is written
+	std::chrono::steady_clock::time_point m_lastFsync;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "topic-registry.h"
+
+// partition N of a topic is a topic of its own, named "topic[N]" (e.g. orders[2])
+inline std::string PartitionName(std::string_view topic, size_t partition)
+{
+	return std::string(topic) + "[" + std::to_string(partition) + "]";
+}
+
+// the topic and the partition of a partition's name, nothing if the name is not like "topic[N]"
+inline std::optional<std::pair<std::string_view, size_t>> SplitPartitionName(std::string_view name)
+{
+	const auto open = name.rfind('[');
+	if (open == std::string_view::npos || open == 0 || !name.ends_with(']') || open + 2 >= name.size())
+	{
+		return std::nullopt;
+	}
+	const auto digits = name.substr(open + 1, name.size() - open - 2);
+	size_t partition = 0;
+	if (const auto [end, error] = std::from_chars(digits.data(), digits.data() + digits.size(), partition); error != std::errc{} || end != digits.data() + digits.size())
+	{
+		return std::nullopt;
+	}
+	return std::pair{ name.substr(0, open), partition };
+}
+
+/* A partitioned topic (see BrokerOptions::partitions) is just the name for its partitions: messages sent to the topic go to one of them,
+   subscribing to the topic means subscribing to all of them (while "topic[N]" is partition N only).
+   Messages with the same key always go to the same partition, thus they are delivered in order; the ones without a key take turns.
+   The partitions are registered as topics the first time they are needed, not while the topic itself is being registered (see Get).
+*/
+class TopicPartitions
+{
+public:
+	explicit TopicPartitions(size_t count)
+		: m_ids(count ? count : 1)
+	{
+	}
+
+	[[nodiscard]] size_t Count() const
+	{
+		return m_ids.size();
+	}
+
+	// "keyHash" is KeyHashOf the key, whose lowest bit is always set (see KeyHashOf)
+	size_t PartitionOf(uint64_t keyHash)
+	{
+		if (keyHash)
+		{
+			return (keyHash >> 1) % m_ids.size();
+		}
+		return m_next.fetch_add(1, std::memory_order_relaxed) % m_ids.size();
+	}
+
+	// the id of the partition, "intern(partition)" registers every partition (returning its id) on first use
+	template<typename Intern>
+	TopicId Get(size_t partition, Intern intern)
+	{
+		std::call_once(m_internOnce, [&] {
+			for (size_t index = 0; index < m_ids.size(); ++index)
+			{
+				m_ids[index] = intern(index);
+			}
+		});
+		return m_ids[partition];
+	}
+private:
+	std::once_flag m_internOnce;
+	std::vector<TopicId> m_ids;
+	std::atomic<uint64_t> m_next = 0;
+};
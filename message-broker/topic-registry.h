@@ -0,0 +1,177 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// a numeric handle of a topic, 0 means "no topic"
+using TopicId = uint64_t;
+
+/* Interns topic names: every topic gets a numeric id and a "channel" (e.g. a so_5::mbox_t) that live as long as the registry.
+   Lookups (both by name and by id) never take locks, only registering a new topic does:
+   - by name: an open addressing hash table of pointers, insert-only. When it grows, the new table is published atomically and
+     the old ones are kept around (readers might still be probing them, they just miss the newest topics and fall back to the slow path);
+   - by id: ids are dense, thus they index a segmented array whose segments never move.
+   Topics are never removed, as it happens to named mboxes in SObjectizer.
+*/
+template<typename Channel>
+class TopicRegistry
+{
+public:
+	struct Topic
+	{
+		std::string name;
+		size_t hash;
+		TopicId id;
+		Channel channel;
+	};
+
+	explicit TopicRegistry(std::function<Channel(const std::string&)> makeChannel)
+		: m_makeChannel(std::move(makeChannel))
+	{
+		auto table = std::make_unique<Table>(InitialCapacity);
+		m_table.store(table.get(), std::memory_order_release);
+		m_tables.push_back(std::move(table));
+	}
+
+	TopicRegistry(const TopicRegistry&) = delete;
+	TopicRegistry& operator=(const TopicRegistry&) = delete;
+
+	// lock-free lookup, nullptr if the topic is not registered
+	const Topic* Find(std::string_view name) const
+	{
+		return Lookup(*m_table.load(std::memory_order_acquire), name, std::hash<std::string_view>{}(name));
+	}
+
+	// lock-free lookup, nullptr if the id is unknown
+	const Topic* Find(TopicId id) const
+	{
+		if (id == 0 || id > m_count.load(std::memory_order_acquire))
+		{
+			return nullptr;
+		}
+		const auto index = id - 1;
+		return m_segments[index / SegmentSize][index % SegmentSize];
+	}
+
+	// returns the topic, registering it on first use (only this case takes a lock)
+	const Topic& Intern(std::string_view name)
+	{
+		const auto hash = std::hash<std::string_view>{}(name);
+		if (const auto* topic = Lookup(*m_table.load(std::memory_order_acquire), name, hash))
+		{
+			return *topic;
+		}
+
+		std::lock_guard lock{ m_mutex };
+		// somebody else might have registered it in the meantime
+		if (const auto* topic = Lookup(*m_table.load(std::memory_order_relaxed), name, hash))
+		{
+			return *topic;
+		}
+		const auto count = m_count.load(std::memory_order_relaxed);
+		if (count == MaxTopics)
+		{
+			throw std::length_error("Too many topics");
+		}
+		// tables are at most half full
+		auto* table = m_table.load(std::memory_order_relaxed);
+		if ((count + 1) * 2 > table->capacity)
+		{
+			table = Grow(*table);
+		}
+
+		std::string topicName{ name };
+		auto channel = m_makeChannel(topicName);
+		const auto& topic = m_topics.emplace_back(Topic{ std::move(topicName), hash, count + 1, std::move(channel) });
+
+		// by id (the segment and the slot are visible to readers once m_count is)
+		auto& segment = m_segments[count / SegmentSize];
+		if (!segment)
+		{
+			segment = std::make_unique<const Topic*[]>(SegmentSize);
+		}
+		segment[count % SegmentSize] = &topic;
+
+		// by name
+		Insert(*table, topic);
+
+		m_count.store(count + 1, std::memory_order_release);
+		return topic;
+	}
+
+	[[nodiscard]] size_t Size() const
+	{
+		return m_count.load(std::memory_order_acquire);
+	}
+private:
+	static constexpr size_t InitialCapacity = 1024;
+	static constexpr size_t SegmentSize = 4096;
+	static constexpr size_t MaxSegments = 1024;
+	static constexpr size_t MaxTopics = SegmentSize * MaxSegments;
+
+	struct Table
+	{
+		explicit Table(size_t size)
+			: capacity(size), slots(std::make_unique<std::atomic<const Topic*>[]>(size))
+		{
+		}
+
+		size_t capacity; // a power of 2
+		std::unique_ptr<std::atomic<const Topic*>[]> slots;
+	};
+
+	static const Topic* Lookup(const Table& table, std::string_view name, size_t hash)
+	{
+		for (auto i = hash & (table.capacity - 1);; i = (i + 1) & (table.capacity - 1))
+		{
+			const auto* topic = table.slots[i].load(std::memory_order_acquire);
+			if (!topic)
+			{
+				return nullptr;
+			}
+			if (topic->hash == hash && topic->name == name)
+			{
+				return topic;
+			}
+		}
+	}
+
+	static void Insert(Table& table, const Topic& topic)
+	{
+		auto i = topic.hash & (table.capacity - 1);
+		while (table.slots[i].load(std::memory_order_relaxed))
+		{
+			i = (i + 1) & (table.capacity - 1);
+		}
+		table.slots[i].store(&topic, std::memory_order_release);
+	}
+
+	Table* Grow(const Table& current)
+	{
+		auto table = std::make_unique<Table>(current.capacity * 2);
+		for (const auto& topic : m_topics)
+		{
+			Insert(*table, topic);
+		}
+		auto* grown = table.get();
+		m_tables.push_back(std::move(table));
+		m_table.store(grown, std::memory_order_release);
+		return grown;
+	}
+
+	std::function<Channel(const std::string&)> m_makeChannel;
+	std::mutex m_mutex; // serializes registrations
+	std::deque<Topic> m_topics; // stable addresses
+	std::unique_ptr<const Topic*[]> m_segments[MaxSegments];
+	std::atomic<size_t> m_count = 0;
+	std::atomic<Table*> m_table;
+	std::vector<std::unique_ptr<Table>> m_tables; // every table ever published (readers might still use old ones)
+};
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/* Topics are hierarchical, segments are separated by dots (e.g. prices.eu.XETR.SAP).
+   A subscription pattern is a topic where some segments are wildcards:
+   - "*" matches exactly one segment (e.g. prices.eu.* matches prices.eu.XETR but not prices.eu.XETR.SAP);
+   - "#" matches zero or more segments (e.g. prices.# matches prices, prices.eu and prices.eu.XETR.SAP).
+   Wildcards must be whole segments, otherwise they are just characters (e.g. prices.eu* is not a pattern).
+*/
+inline bool IsTopicPattern(std::string_view topic)
+{
+	size_t start = 0;
+	while (true)
+	{
+		const auto end = topic.find('.', start);
+		const auto segment = topic.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start);
+		if (segment == "*" || segment == "#")
+		{
+			return true;
+		}
+		if (end == std::string_view::npos)
+		{
+			return false;
+		}
+		start = end + 1;
+	}
+}
+
+// patterns with more segments are refused (see ServiceImpl)
+inline constexpr size_t MaxPatternSegments = 32;
+
+inline size_t SegmentCountOf(std::string_view topic)
+{
+	return static_cast<size_t>(std::ranges::count(topic, '.')) + 1;
+}
+
+/* The subscriptions to topic patterns, indexed by a trie of segments: matching a topic costs work proportional to its depth
+   times the trie nodes still matching at each segment (plus the matching subscribers), no matter how many subscribers there are.
+   Consecutive "#" segments are the same as one (e.g. prices.#.# is prices.#), thus they are stored as one.
+   Every subscriber is identified by an id and it is matched at most once, even when several of its patterns match the same topic.
+   Matching takes a shared lock, only adding and removing subscriptions are exclusive.
+*/
+template<typename Subscriber>
+class TopicTrie
+{
+public:
+	void Add(std::string_view pattern, uint64_t subscriberId, Subscriber subscriber)
+	{
+		std::unique_lock lock{ m_mutex };
+		auto* node = &m_root;
+		ForEachPatternSegment(pattern, [&](std::string_view segment) {
+			auto& child = ChildOf(*node, segment);
+			if (!child)
+			{
+				child = std::make_unique<Node>();
+				child->repeats = segment == "#";
+			}
+			node = child.get();
+		});
+		node->subscribers.emplace_back(subscriberId, std::move(subscriber));
+		m_subscriptions.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// removes what Add(pattern, subscriberId, ...) added, nodes left empty are dropped
+	void Remove(std::string_view pattern, uint64_t subscriberId)
+	{
+		std::vector<std::string_view> segments;
+		ForEachPatternSegment(pattern, [&](std::string_view segment) { segments.push_back(segment); });
+		std::unique_lock lock{ m_mutex };
+		if (Remove(m_root, segments, 0, subscriberId))
+		{
+			m_subscriptions.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	// invokes "deliver" once for every subscriber with at least one pattern matching "topic"
+	template<typename Deliver>
+	void Match(std::string_view topic, Deliver deliver) const
+	{
+		// no patterns at all is the common case, it costs nothing
+		if (!m_subscriptions.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+		std::vector<std::string_view> segments;
+		ForEachSegment(topic, [&](std::string_view segment) { segments.push_back(segment); });
+
+		std::vector<const Entry*> matches;
+		std::shared_lock lock{ m_mutex };
+		Collect(segments, matches);
+		// a subscriber might be matched by several patterns
+		std::ranges::sort(matches, {}, &Entry::first);
+		const auto duplicates = std::ranges::unique(matches, {}, &Entry::first);
+		matches.erase(duplicates.begin(), duplicates.end());
+		for (const auto* match : matches)
+		{
+			deliver(match->second);
+		}
+	}
+
+	[[nodiscard]] size_t Size() const
+	{
+		return m_subscriptions.load(std::memory_order_relaxed);
+	}
+private:
+	using Entry = std::pair<uint64_t, Subscriber>;
+
+	struct StringHash
+	{
+		using is_transparent = void;
+
+		size_t operator()(std::string_view value) const
+		{
+			return std::hash<std::string_view>{}(value);
+		}
+	};
+
+	struct Node
+	{
+		std::unordered_map<std::string, std::unique_ptr<Node>, StringHash, std::equal_to<>> children;
+		std::unique_ptr<Node> anyOne;  // "*"
+		std::unique_ptr<Node> anyMany; // "#"
+		std::vector<Entry> subscribers; // the ones whose pattern ends here
+		bool repeats = false; // a "#" node, it consumes any number of segments
+
+		[[nodiscard]] bool Empty() const
+		{
+			return children.empty() && !anyOne && !anyMany && subscribers.empty();
+		}
+	};
+
+	template<typename Action>
+	static void ForEachSegment(std::string_view topic, Action action)
+	{
+		size_t start = 0;
+		while (true)
+		{
+			const auto end = topic.find('.', start);
+			if (end == std::string_view::npos)
+			{
+				action(topic.substr(start));
+				return;
+			}
+			action(topic.substr(start, end - start));
+			start = end + 1;
+		}
+	}
+
+	// as ForEachSegment, skipping a "#" right after another one
+	template<typename Action>
+	static void ForEachPatternSegment(std::string_view pattern, Action action)
+	{
+		auto previousIsHash = false;
+		ForEachSegment(pattern, [&](std::string_view segment) {
+			const auto hash = segment == "#";
+			if (!hash || !previousIsHash)
+			{
+				action(segment);
+			}
+			previousIsHash = hash;
+		});
+	}
+
+	static std::unique_ptr<Node>& ChildOf(Node& node, std::string_view segment)
+	{
+		if (segment == "*")
+			return node.anyOne;
+		if (segment == "#")
+			return node.anyMany;
+		if (const auto it = node.children.find(segment); it != end(node.children))
+			return it->second;
+		return node.children[std::string(segment)];
+	}
+
+	// the nodes alive after every segment are kept once each (a pattern might reach the same node in many ways, e.g. #.x.#),
+	// thus matching costs at most segments * nodes, instead of trying every way "#" segments can split the topic
+	void Collect(const std::vector<std::string_view>& segments, std::vector<const Entry*>& matches) const
+	{
+		std::vector<const Node*> alive;
+		Enter(m_root, alive);
+		std::vector<const Node*> next;
+		for (const auto segment : segments)
+		{
+			next.clear();
+			for (const auto* node : alive)
+			{
+				if (node->repeats)
+				{
+					Enter(*node, next);
+				}
+				if (const auto it = node->children.find(segment); it != end(node->children))
+				{
+					Enter(*it->second, next);
+				}
+				if (node->anyOne)
+				{
+					Enter(*node->anyOne, next);
+				}
+			}
+			std::ranges::sort(next);
+			const auto duplicates = std::ranges::unique(next);
+			next.erase(duplicates.begin(), duplicates.end());
+			std::swap(alive, next);
+			if (alive.empty())
+			{
+				return;
+			}
+		}
+		for (const auto* node : alive)
+		{
+			for (const auto& subscriber : node->subscribers)
+			{
+				matches.push_back(&subscriber);
+			}
+		}
+	}
+
+	// "#" matches no segments as well, thus reaching a node reaches its "#" child too
+	static void Enter(const Node& node, std::vector<const Node*>& alive)
+	{
+		alive.push_back(&node);
+		if (node.anyMany)
+		{
+			alive.push_back(node.anyMany.get());
+		}
+	}
+
+	// true if the subscription has been found
+	static bool Remove(Node& node, const std::vector<std::string_view>& segments, size_t index, uint64_t subscriberId)
+	{
+		if (index == segments.size())
+		{
+			const auto it = std::ranges::find(node.subscribers, subscriberId, &Entry::first);
+			if (it == end(node.subscribers))
+			{
+				return false;
+			}
+			node.subscribers.erase(it);
+			return true;
+		}
+
+		const auto segment = segments[index];
+		const auto literal = node.children.find(segment);
+		auto* child = segment == "*" ? &node.anyOne : segment == "#" ? &node.anyMany : literal != end(node.children) ? &literal->second : nullptr;
+		if (!child || !*child || !Remove(**child, segments, index + 1, subscriberId))
+		{
+			return false;
+		}
+		if ((*child)->Empty())
+		{
+			if (child == &node.anyOne || child == &node.anyMany)
+				child->reset();
+			else
+				node.children.erase(literal);
+		}
+		return true;
+	}
+
+	mutable std::shared_mutex m_mutex;
+	Node m_root;
+	std::atomic<size_t> m_subscriptions = 0;
+};